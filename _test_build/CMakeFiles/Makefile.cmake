@@ -0,0 +1,210 @@
+# CMAKE generated file: DO NOT EDIT!
+# Generated by "Unix Makefiles" Generator, CMake Version 3.25
+
+# The generator used is:
+set(CMAKE_DEPENDS_GENERATOR "Unix Makefiles")
+
+# The top level Makefile was generated from the following files:
+set(CMAKE_MAKEFILE_DEPENDS
+  "CMakeCache.txt"
+  "/root/repo/CMakeLists.txt"
+  "CMakeFiles/3.25.1/CMakeCCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeCXXCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeSystem.cmake"
+  "CMakeFiles/VerifyGlobs.cmake"
+  "CMakeFiles/cmake.verify_globs"
+  "/root/repo/cmake/dependencies.cmake"
+  "/root/repo/cmake/dynaplex_settings.cmake"
+  "/root/repo/src/executables/CMakeLists.txt"
+  "/root/repo/src/executables/action_label_test/CMakeLists.txt"
+  "/root/repo/src/executables/binpacking_evaluate/CMakeLists.txt"
+  "/root/repo/src/executables/collaborative_picking/CMakeLists.txt"
+  "/root/repo/src/executables/dcl_example/CMakeLists.txt"
+  "/root/repo/src/executables/executable_example/CMakeLists.txt"
+  "/root/repo/src/executables/executable_order_picking/CMakeLists.txt"
+  "/root/repo/src/executables/lostsales_exact/CMakeLists.txt"
+  "/root/repo/src/executables/lostsales_paper_results/CMakeLists.txt"
+  "/root/repo/src/executables/memory_checks/CMakeLists.txt"
+  "/root/repo/src/executables/mm1_baseline/CMakeLists.txt"
+  "/root/repo/src/executables/mm1_sensitivity/CMakeLists.txt"
+  "/root/repo/src/executables/parametric_policy_opt/CMakeLists.txt"
+  "/root/repo/src/executables/perishables_paper_results/CMakeLists.txt"
+  "/root/repo/src/executables/ppo_test/CMakeLists.txt"
+  "/root/repo/src/executables/ppo_validate/CMakeLists.txt"
+  "/root/repo/src/executables/queue_ablation/CMakeLists.txt"
+  "/root/repo/src/executables/queue_analysis1/CMakeLists.txt"
+  "/root/repo/src/executables/queue_analysis2/CMakeLists.txt"
+  "/root/repo/src/executables/queue_cont_sim/CMakeLists.txt"
+  "/root/repo/src/executables/queue_dcl/CMakeLists.txt"
+  "/root/repo/src/executables/queue_dcl_probe/CMakeLists.txt"
+  "/root/repo/src/executables/queue_depth_study/CMakeLists.txt"
+  "/root/repo/src/executables/queue_dsweep/CMakeLists.txt"
+  "/root/repo/src/executables/queue_example/CMakeLists.txt"
+  "/root/repo/src/executables/queue_matrix/CMakeLists.txt"
+  "/root/repo/src/executables/queue_prequel/CMakeLists.txt"
+  "/root/repo/src/executables/queue_rvi/CMakeLists.txt"
+  "/root/repo/src/executables/queue_rvi_validate/CMakeLists.txt"
+  "/root/repo/src/executables/queue_scale_study/CMakeLists.txt"
+  "/root/repo/src/executables/queue_trace/CMakeLists.txt"
+  "/root/repo/src/executables/resource_allocation/CMakeLists.txt"
+  "/root/repo/src/executables/stochastic_fifo_test/CMakeLists.txt"
+  "/root/repo/src/extern/googletest/CMakeLists.txt"
+  "/root/repo/src/extern/googletest/googletest/CMakeLists.txt"
+  "/root/repo/src/extern/googletest/googletest/cmake/Config.cmake.in"
+  "/root/repo/src/extern/googletest/googletest/cmake/gtest.pc.in"
+  "/root/repo/src/extern/googletest/googletest/cmake/gtest_main.pc.in"
+  "/root/repo/src/extern/googletest/googletest/cmake/internal_utils.cmake"
+  "/root/repo/src/lib/CMakeLists.txt"
+  "/root/repo/src/lib/algorithms/CMakeLists.txt"
+  "/root/repo/src/lib/boost_math/CMakeLists.txt"
+  "/root/repo/src/lib/core/CMakeLists.txt"
+  "/root/repo/src/lib/dp/CMakeLists.txt"
+  "/root/repo/src/lib/models/CMakeLists.txt"
+  "/root/repo/src/lib/nn/CMakeLists.txt"
+  "/root/repo/src/lib/utilities/CMakeLists.txt"
+  "/root/repo/src/tests/CMakeLists.txt"
+  "/root/repo/src/tests/mdp_unit_tests/CMakeLists.txt"
+  "/root/repo/src/tests/new_tests/CMakeLists.txt"
+  "/root/repo/src/tests/other_unit_tests/CMakeLists.txt"
+  "/usr/share/cmake-3.25/Modules/BasicConfigVersion-AnyNewerVersion.cmake.in"
+  "/usr/share/cmake-3.25/Modules/CMakeCInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCXXInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCommonLanguageInclude.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeDependentOption.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeGenericSystem.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeInitializeConfigs.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeLanguageInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakePackageConfigHelpers.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInitialize.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckIncludeFile.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckLibraryExists.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/CMakeCommonCompilerMacros.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageHandleStandardArgs.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageMessage.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPython.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPython/Support.cmake"
+  "/usr/share/cmake-3.25/Modules/FindThreads.cmake"
+  "/usr/share/cmake-3.25/Modules/GNUInstallDirs.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/UnixPaths.cmake"
+  "/usr/share/cmake-3.25/Modules/WriteBasicConfigVersionFile.cmake"
+  )
+
+# The corresponding makefile is:
+set(CMAKE_MAKEFILE_OUTPUTS
+  "Makefile"
+  "CMakeFiles/cmake.check_cache"
+  )
+
+# Byproducts of CMake generate step:
+set(CMAKE_MAKEFILE_PRODUCTS
+  "CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/lib/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/lib/core/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/lib/models/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/lib/nn/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/lib/utilities/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/lib/dp/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/lib/algorithms/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/lib/boost_math/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/executables/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/executables/memory_checks/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/executables/executable_example/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/executables/executable_order_picking/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/executables/parametric_policy_opt/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/executables/dcl_example/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/executables/lostsales_paper_results/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/executables/lostsales_exact/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/executables/binpacking_evaluate/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/executables/perishables_paper_results/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/executables/resource_allocation/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/executables/collaborative_picking/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/executables/queue_example/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/executables/queue_dcl/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/executables/queue_rvi/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/executables/queue_analysis1/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/executables/queue_analysis2/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/executables/queue_rvi_validate/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/executables/queue_trace/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/executables/queue_prequel/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/executables/queue_depth_study/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/executables/queue_cont_sim/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/executables/mm1_baseline/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/executables/mm1_sensitivity/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/executables/stochastic_fifo_test/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/executables/action_label_test/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/executables/queue_dcl_probe/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/executables/queue_ablation/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/executables/ppo_test/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/executables/ppo_validate/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/executables/queue_matrix/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/executables/queue_dsweep/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/executables/queue_scale_study/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/extern/googletest/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/extern/googletest/googletest/generated/GTestConfigVersion.cmake"
+  "src/extern/googletest/googletest/generated/GTestConfig.cmake"
+  "src/extern/googletest/googletest/generated/gtest.pc"
+  "src/extern/googletest/googletest/generated/gtest_main.pc"
+  "src/extern/googletest/googletest/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/tests/other_unit_tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/tests/mdp_unit_tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/tests/new_tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  )
+
+# Dependency information for all targets:
+set(CMAKE_DEPEND_INFO_FILES
+  "src/lib/core/CMakeFiles/DP_Core.dir/DependInfo.cmake"
+  "src/lib/models/CMakeFiles/DP_Models.dir/DependInfo.cmake"
+  "src/lib/models/CMakeFiles/DP_copy_model_config_files.dir/DependInfo.cmake"
+  "src/lib/nn/CMakeFiles/DP_NN.dir/DependInfo.cmake"
+  "src/lib/utilities/CMakeFiles/DP_Utilities.dir/DependInfo.cmake"
+  "src/lib/dp/CMakeFiles/DP_DynaPlex.dir/DependInfo.cmake"
+  "src/lib/algorithms/CMakeFiles/DP_Algorithms.dir/DependInfo.cmake"
+  "src/executables/memory_checks/CMakeFiles/memory_checks.dir/DependInfo.cmake"
+  "src/executables/executable_example/CMakeFiles/executable_example.dir/DependInfo.cmake"
+  "src/executables/executable_order_picking/CMakeFiles/executable_order_picking.dir/DependInfo.cmake"
+  "src/executables/parametric_policy_opt/CMakeFiles/parametric_policy_opt.dir/DependInfo.cmake"
+  "src/executables/dcl_example/CMakeFiles/dcl_example.dir/DependInfo.cmake"
+  "src/executables/lostsales_paper_results/CMakeFiles/lostsales_paper_results.dir/DependInfo.cmake"
+  "src/executables/lostsales_exact/CMakeFiles/lostsales_exact.dir/DependInfo.cmake"
+  "src/executables/binpacking_evaluate/CMakeFiles/binpacking_evaluate.dir/DependInfo.cmake"
+  "src/executables/perishables_paper_results/CMakeFiles/perishables_paper_results.dir/DependInfo.cmake"
+  "src/executables/resource_allocation/CMakeFiles/resource_allocation.dir/DependInfo.cmake"
+  "src/executables/collaborative_picking/CMakeFiles/collaborative_picking.dir/DependInfo.cmake"
+  "src/executables/queue_example/CMakeFiles/queue_example.dir/DependInfo.cmake"
+  "src/executables/queue_dcl/CMakeFiles/queue_dcl.dir/DependInfo.cmake"
+  "src/executables/queue_rvi/CMakeFiles/queue_rvi.dir/DependInfo.cmake"
+  "src/executables/queue_analysis1/CMakeFiles/queue_analysis1.dir/DependInfo.cmake"
+  "src/executables/queue_analysis2/CMakeFiles/queue_analysis2.dir/DependInfo.cmake"
+  "src/executables/queue_rvi_validate/CMakeFiles/queue_rvi_validate.dir/DependInfo.cmake"
+  "src/executables/queue_trace/CMakeFiles/queue_trace.dir/DependInfo.cmake"
+  "src/executables/queue_prequel/CMakeFiles/queue_prequel.dir/DependInfo.cmake"
+  "src/executables/queue_depth_study/CMakeFiles/queue_depth_study.dir/DependInfo.cmake"
+  "src/executables/queue_cont_sim/CMakeFiles/queue_cont_sim.dir/DependInfo.cmake"
+  "src/executables/mm1_baseline/CMakeFiles/mm1_baseline.dir/DependInfo.cmake"
+  "src/executables/mm1_sensitivity/CMakeFiles/mm1_sensitivity.dir/DependInfo.cmake"
+  "src/executables/stochastic_fifo_test/CMakeFiles/stochastic_fifo_test.dir/DependInfo.cmake"
+  "src/executables/action_label_test/CMakeFiles/action_label_test.dir/DependInfo.cmake"
+  "src/executables/queue_dcl_probe/CMakeFiles/queue_dcl_probe.dir/DependInfo.cmake"
+  "src/executables/queue_ablation/CMakeFiles/queue_ablation.dir/DependInfo.cmake"
+  "src/executables/ppo_test/CMakeFiles/ppo_test.dir/DependInfo.cmake"
+  "src/executables/ppo_validate/CMakeFiles/ppo_validate.dir/DependInfo.cmake"
+  "src/executables/queue_matrix/CMakeFiles/queue_matrix.dir/DependInfo.cmake"
+  "src/executables/queue_dsweep/CMakeFiles/queue_dsweep.dir/DependInfo.cmake"
+  "src/executables/queue_scale_study/CMakeFiles/queue_scale_study.dir/DependInfo.cmake"
+  "src/extern/googletest/googletest/CMakeFiles/gtest.dir/DependInfo.cmake"
+  "src/extern/googletest/googletest/CMakeFiles/gtest_main.dir/DependInfo.cmake"
+  "src/tests/other_unit_tests/CMakeFiles/DP_other_unit_tests.dir/DependInfo.cmake"
+  "src/tests/mdp_unit_tests/CMakeFiles/DP_mdp_unit_tests.dir/DependInfo.cmake"
+  "src/tests/new_tests/CMakeFiles/DP_new_tests.dir/DependInfo.cmake"
+  )
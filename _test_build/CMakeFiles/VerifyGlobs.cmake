@@ -0,0 +1,994 @@
+# CMAKE generated file: DO NOT EDIT!
+# Generated by CMake Version 3.25
+cmake_policy(SET CMP0009 NEW)
+
+# sources at src/executables/action_label_test/CMakeLists.txt:6 (file)
+file(GLOB_RECURSE NEW_GLOB LIST_DIRECTORIES false "/root/repo/src/executables/action_label_test/*.cpp")
+set(OLD_GLOB
+  "/root/repo/src/executables/action_label_test/action_label_test.cpp"
+  )
+if(NOT "${NEW_GLOB}" STREQUAL "${OLD_GLOB}")
+  message("-- GLOB mismatch!")
+  file(TOUCH_NOCREATE "/root/repo/_test_build/CMakeFiles/cmake.verify_globs")
+endif()
+
+# headers at src/executables/action_label_test/CMakeLists.txt:7 (file)
+file(GLOB_RECURSE NEW_GLOB LIST_DIRECTORIES false "/root/repo/src/executables/action_label_test/*.h")
+set(OLD_GLOB
+  )
+if(NOT "${NEW_GLOB}" STREQUAL "${OLD_GLOB}")
+  message("-- GLOB mismatch!")
+  file(TOUCH_NOCREATE "/root/repo/_test_build/CMakeFiles/cmake.verify_globs")
+endif()
+
+# sources at src/executables/binpacking_evaluate/CMakeLists.txt:6 (file)
+file(GLOB_RECURSE NEW_GLOB LIST_DIRECTORIES false "/root/repo/src/executables/binpacking_evaluate/*.cpp")
+set(OLD_GLOB
+  "/root/repo/src/executables/binpacking_evaluate/binpacking_evaluate.cpp"
+  )
+if(NOT "${NEW_GLOB}" STREQUAL "${OLD_GLOB}")
+  message("-- GLOB mismatch!")
+  file(TOUCH_NOCREATE "/root/repo/_test_build/CMakeFiles/cmake.verify_globs")
+endif()
+
+# headers at src/executables/binpacking_evaluate/CMakeLists.txt:7 (file)
+file(GLOB_RECURSE NEW_GLOB LIST_DIRECTORIES false "/root/repo/src/executables/binpacking_evaluate/*.h")
+set(OLD_GLOB
+  )
+if(NOT "${NEW_GLOB}" STREQUAL "${OLD_GLOB}")
+  message("-- GLOB mismatch!")
+  file(TOUCH_NOCREATE "/root/repo/_test_build/CMakeFiles/cmake.verify_globs")
+endif()
+
+# sources at src/executables/collaborative_picking/CMakeLists.txt:5 (file)
+file(GLOB_RECURSE NEW_GLOB LIST_DIRECTORIES false "/root/repo/src/executables/collaborative_picking/*.cpp")
+set(OLD_GLOB
+  "/root/repo/src/executables/collaborative_picking/collaborative_picking.cpp"
+  )
+if(NOT "${NEW_GLOB}" STREQUAL "${OLD_GLOB}")
+  message("-- GLOB mismatch!")
+  file(TOUCH_NOCREATE "/root/repo/_test_build/CMakeFiles/cmake.verify_globs")
+endif()
+
+# headers at src/executables/collaborative_picking/CMakeLists.txt:6 (file)
+file(GLOB_RECURSE NEW_GLOB LIST_DIRECTORIES false "/root/repo/src/executables/collaborative_picking/*.h")
+set(OLD_GLOB
+  )
+if(NOT "${NEW_GLOB}" STREQUAL "${OLD_GLOB}")
+  message("-- GLOB mismatch!")
+  file(TOUCH_NOCREATE "/root/repo/_test_build/CMakeFiles/cmake.verify_globs")
+endif()
+
+# sources at src/executables/dcl_example/CMakeLists.txt:6 (file)
+file(GLOB_RECURSE NEW_GLOB LIST_DIRECTORIES false "/root/repo/src/executables/dcl_example/*.cpp")
+set(OLD_GLOB
+  "/root/repo/src/executables/dcl_example/dcl_example.cpp"
+  )
+if(NOT "${NEW_GLOB}" STREQUAL "${OLD_GLOB}")
+  message("-- GLOB mismatch!")
+  file(TOUCH_NOCREATE "/root/repo/_test_build/CMakeFiles/cmake.verify_globs")
+endif()
+
+# headers at src/executables/dcl_example/CMakeLists.txt:7 (file)
+file(GLOB_RECURSE NEW_GLOB LIST_DIRECTORIES false "/root/repo/src/executables/dcl_example/*.h")
+set(OLD_GLOB
+  )
+if(NOT "${NEW_GLOB}" STREQUAL "${OLD_GLOB}")
+  message("-- GLOB mismatch!")
+  file(TOUCH_NOCREATE "/root/repo/_test_build/CMakeFiles/cmake.verify_globs")
+endif()
+
+# sources at src/executables/executable_example/CMakeLists.txt:4 (file)
+file(GLOB_RECURSE NEW_GLOB LIST_DIRECTORIES false "/root/repo/src/executables/executable_example/*.cpp")
+set(OLD_GLOB
+  "/root/repo/src/executables/executable_example/executable_example.cpp"
+  )
+if(NOT "${NEW_GLOB}" STREQUAL "${OLD_GLOB}")
+  message("-- GLOB mismatch!")
+  file(TOUCH_NOCREATE "/root/repo/_test_build/CMakeFiles/cmake.verify_globs")
+endif()
+
+# headers at src/executables/executable_example/CMakeLists.txt:5 (file)
+file(GLOB_RECURSE NEW_GLOB LIST_DIRECTORIES false "/root/repo/src/executables/executable_example/*.h")
+set(OLD_GLOB
+  )
+if(NOT "${NEW_GLOB}" STREQUAL "${OLD_GLOB}")
+  message("-- GLOB mismatch!")
+  file(TOUCH_NOCREATE "/root/repo/_test_build/CMakeFiles/cmake.verify_globs")
+endif()
+
+# sources at src/executables/executable_order_picking/CMakeLists.txt:6 (file)
+file(GLOB_RECURSE NEW_GLOB LIST_DIRECTORIES false "/root/repo/src/executables/executable_order_picking/*.cpp")
+set(OLD_GLOB
+  "/root/repo/src/executables/executable_order_picking/executable_order_picking.cpp"
+  )
+if(NOT "${NEW_GLOB}" STREQUAL "${OLD_GLOB}")
+  message("-- GLOB mismatch!")
+  file(TOUCH_NOCREATE "/root/repo/_test_build/CMakeFiles/cmake.verify_globs")
+endif()
+
+# headers at src/executables/executable_order_picking/CMakeLists.txt:7 (file)
+file(GLOB_RECURSE NEW_GLOB LIST_DIRECTORIES false "/root/repo/src/executables/executable_order_picking/*.h")
+set(OLD_GLOB
+  )
+if(NOT "${NEW_GLOB}" STREQUAL "${OLD_GLOB}")
+  message("-- GLOB mismatch!")
+  file(TOUCH_NOCREATE "/root/repo/_test_build/CMakeFiles/cmake.verify_globs")
+endif()
+
+# sources at src/executables/lostsales_exact/CMakeLists.txt:6 (file)
+file(GLOB_RECURSE NEW_GLOB LIST_DIRECTORIES false "/root/repo/src/executables/lostsales_exact/*.cpp")
+set(OLD_GLOB
+  "/root/repo/src/executables/lostsales_exact/lostsales_exact.cpp"
+  )
+if(NOT "${NEW_GLOB}" STREQUAL "${OLD_GLOB}")
+  message("-- GLOB mismatch!")
+  file(TOUCH_NOCREATE "/root/repo/_test_build/CMakeFiles/cmake.verify_globs")
+endif()
+
+# headers at src/executables/lostsales_exact/CMakeLists.txt:7 (file)
+file(GLOB_RECURSE NEW_GLOB LIST_DIRECTORIES false "/root/repo/src/executables/lostsales_exact/*.h")
+set(OLD_GLOB
+  )
+if(NOT "${NEW_GLOB}" STREQUAL "${OLD_GLOB}")
+  message("-- GLOB mismatch!")
+  file(TOUCH_NOCREATE "/root/repo/_test_build/CMakeFiles/cmake.verify_globs")
+endif()
+
+# sources at src/executables/lostsales_paper_results/CMakeLists.txt:6 (file)
+file(GLOB_RECURSE NEW_GLOB LIST_DIRECTORIES false "/root/repo/src/executables/lostsales_paper_results/*.cpp")
+set(OLD_GLOB
+  "/root/repo/src/executables/lostsales_paper_results/lostsales_paper_results.cpp"
+  )
+if(NOT "${NEW_GLOB}" STREQUAL "${OLD_GLOB}")
+  message("-- GLOB mismatch!")
+  file(TOUCH_NOCREATE "/root/repo/_test_build/CMakeFiles/cmake.verify_globs")
+endif()
+
+# headers at src/executables/lostsales_paper_results/CMakeLists.txt:7 (file)
+file(GLOB_RECURSE NEW_GLOB LIST_DIRECTORIES false "/root/repo/src/executables/lostsales_paper_results/*.h")
+set(OLD_GLOB
+  )
+if(NOT "${NEW_GLOB}" STREQUAL "${OLD_GLOB}")
+  message("-- GLOB mismatch!")
+  file(TOUCH_NOCREATE "/root/repo/_test_build/CMakeFiles/cmake.verify_globs")
+endif()
+
+# sources at src/executables/memory_checks/CMakeLists.txt:6 (file)
+file(GLOB_RECURSE NEW_GLOB LIST_DIRECTORIES false "/root/repo/src/executables/memory_checks/*.cpp")
+set(OLD_GLOB
+  "/root/repo/src/executables/memory_checks/memory_checks.cpp"
+  )
+if(NOT "${NEW_GLOB}" STREQUAL "${OLD_GLOB}")
+  message("-- GLOB mismatch!")
+  file(TOUCH_NOCREATE "/root/repo/_test_build/CMakeFiles/cmake.verify_globs")
+endif()
+
+# headers at src/executables/memory_checks/CMakeLists.txt:7 (file)
+file(GLOB_RECURSE NEW_GLOB LIST_DIRECTORIES false "/root/repo/src/executables/memory_checks/*.h")
+set(OLD_GLOB
+  )
+if(NOT "${NEW_GLOB}" STREQUAL "${OLD_GLOB}")
+  message("-- GLOB mismatch!")
+  file(TOUCH_NOCREATE "/root/repo/_test_build/CMakeFiles/cmake.verify_globs")
+endif()
+
+# sources at src/executables/mm1_baseline/CMakeLists.txt:5 (file)
+file(GLOB_RECURSE NEW_GLOB LIST_DIRECTORIES false "/root/repo/src/executables/mm1_baseline/*.cpp")
+set(OLD_GLOB
+  "/root/repo/src/executables/mm1_baseline/mm1_baseline.cpp"
+  )
+if(NOT "${NEW_GLOB}" STREQUAL "${OLD_GLOB}")
+  message("-- GLOB mismatch!")
+  file(TOUCH_NOCREATE "/root/repo/_test_build/CMakeFiles/cmake.verify_globs")
+endif()
+
+# headers at src/executables/mm1_baseline/CMakeLists.txt:6 (file)
+file(GLOB_RECURSE NEW_GLOB LIST_DIRECTORIES false "/root/repo/src/executables/mm1_baseline/*.h")
+set(OLD_GLOB
+  )
+if(NOT "${NEW_GLOB}" STREQUAL "${OLD_GLOB}")
+  message("-- GLOB mismatch!")
+  file(TOUCH_NOCREATE "/root/repo/_test_build/CMakeFiles/cmake.verify_globs")
+endif()
+
+# sources at src/executables/mm1_sensitivity/CMakeLists.txt:5 (file)
+file(GLOB_RECURSE NEW_GLOB LIST_DIRECTORIES false "/root/repo/src/executables/mm1_sensitivity/*.cpp")
+set(OLD_GLOB
+  "/root/repo/src/executables/mm1_sensitivity/mm1_sensitivity.cpp"
+  )
+if(NOT "${NEW_GLOB}" STREQUAL "${OLD_GLOB}")
+  message("-- GLOB mismatch!")
+  file(TOUCH_NOCREATE "/root/repo/_test_build/CMakeFiles/cmake.verify_globs")
+endif()
+
+# headers at src/executables/mm1_sensitivity/CMakeLists.txt:6 (file)
+file(GLOB_RECURSE NEW_GLOB LIST_DIRECTORIES false "/root/repo/src/executables/mm1_sensitivity/*.h")
+set(OLD_GLOB
+  )
+if(NOT "${NEW_GLOB}" STREQUAL "${OLD_GLOB}")
+  message("-- GLOB mismatch!")
+  file(TOUCH_NOCREATE "/root/repo/_test_build/CMakeFiles/cmake.verify_globs")
+endif()
+
+# sources at src/executables/parametric_policy_opt/CMakeLists.txt:6 (file)
+file(GLOB_RECURSE NEW_GLOB LIST_DIRECTORIES false "/root/repo/src/executables/parametric_policy_opt/*.cpp")
+set(OLD_GLOB
+  "/root/repo/src/executables/parametric_policy_opt/parametric_policy_opt.cpp"
+  )
+if(NOT "${NEW_GLOB}" STREQUAL "${OLD_GLOB}")
+  message("-- GLOB mismatch!")
+  file(TOUCH_NOCREATE "/root/repo/_test_build/CMakeFiles/cmake.verify_globs")
+endif()
+
+# headers at src/executables/parametric_policy_opt/CMakeLists.txt:7 (file)
+file(GLOB_RECURSE NEW_GLOB LIST_DIRECTORIES false "/root/repo/src/executables/parametric_policy_opt/*.h")
+set(OLD_GLOB
+  )
+if(NOT "${NEW_GLOB}" STREQUAL "${OLD_GLOB}")
+  message("-- GLOB mismatch!")
+  file(TOUCH_NOCREATE "/root/repo/_test_build/CMakeFiles/cmake.verify_globs")
+endif()
+
+# sources at src/executables/perishables_paper_results/CMakeLists.txt:5 (file)
+file(GLOB_RECURSE NEW_GLOB LIST_DIRECTORIES false "/root/repo/src/executables/perishables_paper_results/*.cpp")
+set(OLD_GLOB
+  "/root/repo/src/executables/perishables_paper_results/perishables_paper_results.cpp"
+  )
+if(NOT "${NEW_GLOB}" STREQUAL "${OLD_GLOB}")
+  message("-- GLOB mismatch!")
+  file(TOUCH_NOCREATE "/root/repo/_test_build/CMakeFiles/cmake.verify_globs")
+endif()
+
+# headers at src/executables/perishables_paper_results/CMakeLists.txt:6 (file)
+file(GLOB_RECURSE NEW_GLOB LIST_DIRECTORIES false "/root/repo/src/executables/perishables_paper_results/*.h")
+set(OLD_GLOB
+  )
+if(NOT "${NEW_GLOB}" STREQUAL "${OLD_GLOB}")
+  message("-- GLOB mismatch!")
+  file(TOUCH_NOCREATE "/root/repo/_test_build/CMakeFiles/cmake.verify_globs")
+endif()
+
+# sources at src/executables/ppo_test/CMakeLists.txt:6 (file)
+file(GLOB_RECURSE NEW_GLOB LIST_DIRECTORIES false "/root/repo/src/executables/ppo_test/*.cpp")
+set(OLD_GLOB
+  "/root/repo/src/executables/ppo_test/ppo_test.cpp"
+  )
+if(NOT "${NEW_GLOB}" STREQUAL "${OLD_GLOB}")
+  message("-- GLOB mismatch!")
+  file(TOUCH_NOCREATE "/root/repo/_test_build/CMakeFiles/cmake.verify_globs")
+endif()
+
+# headers at src/executables/ppo_test/CMakeLists.txt:7 (file)
+file(GLOB_RECURSE NEW_GLOB LIST_DIRECTORIES false "/root/repo/src/executables/ppo_test/*.h")
+set(OLD_GLOB
+  )
+if(NOT "${NEW_GLOB}" STREQUAL "${OLD_GLOB}")
+  message("-- GLOB mismatch!")
+  file(TOUCH_NOCREATE "/root/repo/_test_build/CMakeFiles/cmake.verify_globs")
+endif()
+
+# sources at src/executables/ppo_validate/CMakeLists.txt:6 (file)
+file(GLOB_RECURSE NEW_GLOB LIST_DIRECTORIES false "/root/repo/src/executables/ppo_validate/*.cpp")
+set(OLD_GLOB
+  "/root/repo/src/executables/ppo_validate/ppo_validate.cpp"
+  )
+if(NOT "${NEW_GLOB}" STREQUAL "${OLD_GLOB}")
+  message("-- GLOB mismatch!")
+  file(TOUCH_NOCREATE "/root/repo/_test_build/CMakeFiles/cmake.verify_globs")
+endif()
+
+# headers at src/executables/ppo_validate/CMakeLists.txt:7 (file)
+file(GLOB_RECURSE NEW_GLOB LIST_DIRECTORIES false "/root/repo/src/executables/ppo_validate/*.h")
+set(OLD_GLOB
+  )
+if(NOT "${NEW_GLOB}" STREQUAL "${OLD_GLOB}")
+  message("-- GLOB mismatch!")
+  file(TOUCH_NOCREATE "/root/repo/_test_build/CMakeFiles/cmake.verify_globs")
+endif()
+
+# sources at src/executables/queue_ablation/CMakeLists.txt:5 (file)
+file(GLOB_RECURSE NEW_GLOB LIST_DIRECTORIES false "/root/repo/src/executables/queue_ablation/*.cpp")
+set(OLD_GLOB
+  "/root/repo/src/executables/queue_ablation/queue_ablation.cpp"
+  )
+if(NOT "${NEW_GLOB}" STREQUAL "${OLD_GLOB}")
+  message("-- GLOB mismatch!")
+  file(TOUCH_NOCREATE "/root/repo/_test_build/CMakeFiles/cmake.verify_globs")
+endif()
+
+# headers at src/executables/queue_ablation/CMakeLists.txt:6 (file)
+file(GLOB_RECURSE NEW_GLOB LIST_DIRECTORIES false "/root/repo/src/executables/queue_ablation/*.h")
+set(OLD_GLOB
+  )
+if(NOT "${NEW_GLOB}" STREQUAL "${OLD_GLOB}")
+  message("-- GLOB mismatch!")
+  file(TOUCH_NOCREATE "/root/repo/_test_build/CMakeFiles/cmake.verify_globs")
+endif()
+
+# sources at src/executables/queue_analysis1/CMakeLists.txt:5 (file)
+file(GLOB_RECURSE NEW_GLOB LIST_DIRECTORIES false "/root/repo/src/executables/queue_analysis1/*.cpp")
+set(OLD_GLOB
+  "/root/repo/src/executables/queue_analysis1/queue_analysis1.cpp"
+  )
+if(NOT "${NEW_GLOB}" STREQUAL "${OLD_GLOB}")
+  message("-- GLOB mismatch!")
+  file(TOUCH_NOCREATE "/root/repo/_test_build/CMakeFiles/cmake.verify_globs")
+endif()
+
+# headers at src/executables/queue_analysis1/CMakeLists.txt:6 (file)
+file(GLOB_RECURSE NEW_GLOB LIST_DIRECTORIES false "/root/repo/src/executables/queue_analysis1/*.h")
+set(OLD_GLOB
+  )
+if(NOT "${NEW_GLOB}" STREQUAL "${OLD_GLOB}")
+  message("-- GLOB mismatch!")
+  file(TOUCH_NOCREATE "/root/repo/_test_build/CMakeFiles/cmake.verify_globs")
+endif()
+
+# sources at src/executables/queue_analysis2/CMakeLists.txt:5 (file)
+file(GLOB_RECURSE NEW_GLOB LIST_DIRECTORIES false "/root/repo/src/executables/queue_analysis2/*.cpp")
+set(OLD_GLOB
+  "/root/repo/src/executables/queue_analysis2/queue_analysis2.cpp"
+  )
+if(NOT "${NEW_GLOB}" STREQUAL "${OLD_GLOB}")
+  message("-- GLOB mismatch!")
+  file(TOUCH_NOCREATE "/root/repo/_test_build/CMakeFiles/cmake.verify_globs")
+endif()
+
+# headers at src/executables/queue_analysis2/CMakeLists.txt:6 (file)
+file(GLOB_RECURSE NEW_GLOB LIST_DIRECTORIES false "/root/repo/src/executables/queue_analysis2/*.h")
+set(OLD_GLOB
+  )
+if(NOT "${NEW_GLOB}" STREQUAL "${OLD_GLOB}")
+  message("-- GLOB mismatch!")
+  file(TOUCH_NOCREATE "/root/repo/_test_build/CMakeFiles/cmake.verify_globs")
+endif()
+
+# sources at src/executables/queue_cont_sim/CMakeLists.txt:6 (file)
+file(GLOB_RECURSE NEW_GLOB LIST_DIRECTORIES false "/root/repo/src/executables/queue_cont_sim/*.cpp")
+set(OLD_GLOB
+  "/root/repo/src/executables/queue_cont_sim/queue_cont_sim.cpp"
+  )
+if(NOT "${NEW_GLOB}" STREQUAL "${OLD_GLOB}")
+  message("-- GLOB mismatch!")
+  file(TOUCH_NOCREATE "/root/repo/_test_build/CMakeFiles/cmake.verify_globs")
+endif()
+
+# headers at src/executables/queue_cont_sim/CMakeLists.txt:7 (file)
+file(GLOB_RECURSE NEW_GLOB LIST_DIRECTORIES false "/root/repo/src/executables/queue_cont_sim/*.h")
+set(OLD_GLOB
+  )
+if(NOT "${NEW_GLOB}" STREQUAL "${OLD_GLOB}")
+  message("-- GLOB mismatch!")
+  file(TOUCH_NOCREATE "/root/repo/_test_build/CMakeFiles/cmake.verify_globs")
+endif()
+
+# sources at src/executables/queue_dcl/CMakeLists.txt:6 (file)
+file(GLOB_RECURSE NEW_GLOB LIST_DIRECTORIES false "/root/repo/src/executables/queue_dcl/*.cpp")
+set(OLD_GLOB
+  "/root/repo/src/executables/queue_dcl/queue_dcl.cpp"
+  )
+if(NOT "${NEW_GLOB}" STREQUAL "${OLD_GLOB}")
+  message("-- GLOB mismatch!")
+  file(TOUCH_NOCREATE "/root/repo/_test_build/CMakeFiles/cmake.verify_globs")
+endif()
+
+# headers at src/executables/queue_dcl/CMakeLists.txt:7 (file)
+file(GLOB_RECURSE NEW_GLOB LIST_DIRECTORIES false "/root/repo/src/executables/queue_dcl/*.h")
+set(OLD_GLOB
+  )
+if(NOT "${NEW_GLOB}" STREQUAL "${OLD_GLOB}")
+  message("-- GLOB mismatch!")
+  file(TOUCH_NOCREATE "/root/repo/_test_build/CMakeFiles/cmake.verify_globs")
+endif()
+
+# sources at src/executables/queue_dcl_probe/CMakeLists.txt:6 (file)
+file(GLOB_RECURSE NEW_GLOB LIST_DIRECTORIES false "/root/repo/src/executables/queue_dcl_probe/*.cpp")
+set(OLD_GLOB
+  "/root/repo/src/executables/queue_dcl_probe/queue_dcl_probe.cpp"
+  )
+if(NOT "${NEW_GLOB}" STREQUAL "${OLD_GLOB}")
+  message("-- GLOB mismatch!")
+  file(TOUCH_NOCREATE "/root/repo/_test_build/CMakeFiles/cmake.verify_globs")
+endif()
+
+# headers at src/executables/queue_dcl_probe/CMakeLists.txt:7 (file)
+file(GLOB_RECURSE NEW_GLOB LIST_DIRECTORIES false "/root/repo/src/executables/queue_dcl_probe/*.h")
+set(OLD_GLOB
+  )
+if(NOT "${NEW_GLOB}" STREQUAL "${OLD_GLOB}")
+  message("-- GLOB mismatch!")
+  file(TOUCH_NOCREATE "/root/repo/_test_build/CMakeFiles/cmake.verify_globs")
+endif()
+
+# sources at src/executables/queue_depth_study/CMakeLists.txt:5 (file)
+file(GLOB_RECURSE NEW_GLOB LIST_DIRECTORIES false "/root/repo/src/executables/queue_depth_study/*.cpp")
+set(OLD_GLOB
+  "/root/repo/src/executables/queue_depth_study/queue_depth_study.cpp"
+  )
+if(NOT "${NEW_GLOB}" STREQUAL "${OLD_GLOB}")
+  message("-- GLOB mismatch!")
+  file(TOUCH_NOCREATE "/root/repo/_test_build/CMakeFiles/cmake.verify_globs")
+endif()
+
+# headers at src/executables/queue_depth_study/CMakeLists.txt:6 (file)
+file(GLOB_RECURSE NEW_GLOB LIST_DIRECTORIES false "/root/repo/src/executables/queue_depth_study/*.h")
+set(OLD_GLOB
+  )
+if(NOT "${NEW_GLOB}" STREQUAL "${OLD_GLOB}")
+  message("-- GLOB mismatch!")
+  file(TOUCH_NOCREATE "/root/repo/_test_build/CMakeFiles/cmake.verify_globs")
+endif()
+
+# sources at src/executables/queue_dsweep/CMakeLists.txt:6 (file)
+file(GLOB_RECURSE NEW_GLOB LIST_DIRECTORIES false "/root/repo/src/executables/queue_dsweep/*.cpp")
+set(OLD_GLOB
+  "/root/repo/src/executables/queue_dsweep/queue_dsweep.cpp"
+  )
+if(NOT "${NEW_GLOB}" STREQUAL "${OLD_GLOB}")
+  message("-- GLOB mismatch!")
+  file(TOUCH_NOCREATE "/root/repo/_test_build/CMakeFiles/cmake.verify_globs")
+endif()
+
+# headers at src/executables/queue_dsweep/CMakeLists.txt:7 (file)
+file(GLOB_RECURSE NEW_GLOB LIST_DIRECTORIES false "/root/repo/src/executables/queue_dsweep/*.h")
+set(OLD_GLOB
+  )
+if(NOT "${NEW_GLOB}" STREQUAL "${OLD_GLOB}")
+  message("-- GLOB mismatch!")
+  file(TOUCH_NOCREATE "/root/repo/_test_build/CMakeFiles/cmake.verify_globs")
+endif()
+
+# sources at src/executables/queue_example/CMakeLists.txt:6 (file)
+file(GLOB_RECURSE NEW_GLOB LIST_DIRECTORIES false "/root/repo/src/executables/queue_example/*.cpp")
+set(OLD_GLOB
+  "/root/repo/src/executables/queue_example/queue_example.cpp"
+  )
+if(NOT "${NEW_GLOB}" STREQUAL "${OLD_GLOB}")
+  message("-- GLOB mismatch!")
+  file(TOUCH_NOCREATE "/root/repo/_test_build/CMakeFiles/cmake.verify_globs")
+endif()
+
+# headers at src/executables/queue_example/CMakeLists.txt:7 (file)
+file(GLOB_RECURSE NEW_GLOB LIST_DIRECTORIES false "/root/repo/src/executables/queue_example/*.h")
+set(OLD_GLOB
+  )
+if(NOT "${NEW_GLOB}" STREQUAL "${OLD_GLOB}")
+  message("-- GLOB mismatch!")
+  file(TOUCH_NOCREATE "/root/repo/_test_build/CMakeFiles/cmake.verify_globs")
+endif()
+
+# sources at src/executables/queue_matrix/CMakeLists.txt:6 (file)
+file(GLOB_RECURSE NEW_GLOB LIST_DIRECTORIES false "/root/repo/src/executables/queue_matrix/*.cpp")
+set(OLD_GLOB
+  "/root/repo/src/executables/queue_matrix/queue_matrix.cpp"
+  )
+if(NOT "${NEW_GLOB}" STREQUAL "${OLD_GLOB}")
+  message("-- GLOB mismatch!")
+  file(TOUCH_NOCREATE "/root/repo/_test_build/CMakeFiles/cmake.verify_globs")
+endif()
+
+# headers at src/executables/queue_matrix/CMakeLists.txt:7 (file)
+file(GLOB_RECURSE NEW_GLOB LIST_DIRECTORIES false "/root/repo/src/executables/queue_matrix/*.h")
+set(OLD_GLOB
+  )
+if(NOT "${NEW_GLOB}" STREQUAL "${OLD_GLOB}")
+  message("-- GLOB mismatch!")
+  file(TOUCH_NOCREATE "/root/repo/_test_build/CMakeFiles/cmake.verify_globs")
+endif()
+
+# sources at src/executables/queue_prequel/CMakeLists.txt:5 (file)
+file(GLOB_RECURSE NEW_GLOB LIST_DIRECTORIES false "/root/repo/src/executables/queue_prequel/*.cpp")
+set(OLD_GLOB
+  "/root/repo/src/executables/queue_prequel/queue_prequel.cpp"
+  )
+if(NOT "${NEW_GLOB}" STREQUAL "${OLD_GLOB}")
+  message("-- GLOB mismatch!")
+  file(TOUCH_NOCREATE "/root/repo/_test_build/CMakeFiles/cmake.verify_globs")
+endif()
+
+# headers at src/executables/queue_prequel/CMakeLists.txt:6 (file)
+file(GLOB_RECURSE NEW_GLOB LIST_DIRECTORIES false "/root/repo/src/executables/queue_prequel/*.h")
+set(OLD_GLOB
+  )
+if(NOT "${NEW_GLOB}" STREQUAL "${OLD_GLOB}")
+  message("-- GLOB mismatch!")
+  file(TOUCH_NOCREATE "/root/repo/_test_build/CMakeFiles/cmake.verify_globs")
+endif()
+
+# sources at src/executables/queue_rvi/CMakeLists.txt:6 (file)
+file(GLOB_RECURSE NEW_GLOB LIST_DIRECTORIES false "/root/repo/src/executables/queue_rvi/*.cpp")
+set(OLD_GLOB
+  "/root/repo/src/executables/queue_rvi/queue_rvi.cpp"
+  )
+if(NOT "${NEW_GLOB}" STREQUAL "${OLD_GLOB}")
+  message("-- GLOB mismatch!")
+  file(TOUCH_NOCREATE "/root/repo/_test_build/CMakeFiles/cmake.verify_globs")
+endif()
+
+# headers at src/executables/queue_rvi/CMakeLists.txt:7 (file)
+file(GLOB_RECURSE NEW_GLOB LIST_DIRECTORIES false "/root/repo/src/executables/queue_rvi/*.h")
+set(OLD_GLOB
+  )
+if(NOT "${NEW_GLOB}" STREQUAL "${OLD_GLOB}")
+  message("-- GLOB mismatch!")
+  file(TOUCH_NOCREATE "/root/repo/_test_build/CMakeFiles/cmake.verify_globs")
+endif()
+
+# sources at src/executables/queue_rvi_validate/CMakeLists.txt:5 (file)
+file(GLOB_RECURSE NEW_GLOB LIST_DIRECTORIES false "/root/repo/src/executables/queue_rvi_validate/*.cpp")
+set(OLD_GLOB
+  "/root/repo/src/executables/queue_rvi_validate/queue_rvi_validate.cpp"
+  )
+if(NOT "${NEW_GLOB}" STREQUAL "${OLD_GLOB}")
+  message("-- GLOB mismatch!")
+  file(TOUCH_NOCREATE "/root/repo/_test_build/CMakeFiles/cmake.verify_globs")
+endif()
+
+# headers at src/executables/queue_rvi_validate/CMakeLists.txt:6 (file)
+file(GLOB_RECURSE NEW_GLOB LIST_DIRECTORIES false "/root/repo/src/executables/queue_rvi_validate/*.h")
+set(OLD_GLOB
+  )
+if(NOT "${NEW_GLOB}" STREQUAL "${OLD_GLOB}")
+  message("-- GLOB mismatch!")
+  file(TOUCH_NOCREATE "/root/repo/_test_build/CMakeFiles/cmake.verify_globs")
+endif()
+
+# sources at src/executables/queue_scale_study/CMakeLists.txt:5 (file)
+file(GLOB_RECURSE NEW_GLOB LIST_DIRECTORIES false "/root/repo/src/executables/queue_scale_study/*.cpp")
+set(OLD_GLOB
+  "/root/repo/src/executables/queue_scale_study/queue_scale_study.cpp"
+  )
+if(NOT "${NEW_GLOB}" STREQUAL "${OLD_GLOB}")
+  message("-- GLOB mismatch!")
+  file(TOUCH_NOCREATE "/root/repo/_test_build/CMakeFiles/cmake.verify_globs")
+endif()
+
+# sources at src/executables/queue_trace/CMakeLists.txt:6 (file)
+file(GLOB_RECURSE NEW_GLOB LIST_DIRECTORIES false "/root/repo/src/executables/queue_trace/*.cpp")
+set(OLD_GLOB
+  "/root/repo/src/executables/queue_trace/queue_trace.cpp"
+  )
+if(NOT "${NEW_GLOB}" STREQUAL "${OLD_GLOB}")
+  message("-- GLOB mismatch!")
+  file(TOUCH_NOCREATE "/root/repo/_test_build/CMakeFiles/cmake.verify_globs")
+endif()
+
+# headers at src/executables/queue_trace/CMakeLists.txt:7 (file)
+file(GLOB_RECURSE NEW_GLOB LIST_DIRECTORIES false "/root/repo/src/executables/queue_trace/*.h")
+set(OLD_GLOB
+  )
+if(NOT "${NEW_GLOB}" STREQUAL "${OLD_GLOB}")
+  message("-- GLOB mismatch!")
+  file(TOUCH_NOCREATE "/root/repo/_test_build/CMakeFiles/cmake.verify_globs")
+endif()
+
+# sources at src/executables/resource_allocation/CMakeLists.txt:5 (file)
+file(GLOB_RECURSE NEW_GLOB LIST_DIRECTORIES false "/root/repo/src/executables/resource_allocation/*.cpp")
+set(OLD_GLOB
+  "/root/repo/src/executables/resource_allocation/resource_allocation.cpp"
+  )
+if(NOT "${NEW_GLOB}" STREQUAL "${OLD_GLOB}")
+  message("-- GLOB mismatch!")
+  file(TOUCH_NOCREATE "/root/repo/_test_build/CMakeFiles/cmake.verify_globs")
+endif()
+
+# headers at src/executables/resource_allocation/CMakeLists.txt:6 (file)
+file(GLOB_RECURSE NEW_GLOB LIST_DIRECTORIES false "/root/repo/src/executables/resource_allocation/*.h")
+set(OLD_GLOB
+  )
+if(NOT "${NEW_GLOB}" STREQUAL "${OLD_GLOB}")
+  message("-- GLOB mismatch!")
+  file(TOUCH_NOCREATE "/root/repo/_test_build/CMakeFiles/cmake.verify_globs")
+endif()
+
+# sources at src/executables/stochastic_fifo_test/CMakeLists.txt:5 (file)
+file(GLOB_RECURSE NEW_GLOB LIST_DIRECTORIES false "/root/repo/src/executables/stochastic_fifo_test/*.cpp")
+set(OLD_GLOB
+  "/root/repo/src/executables/stochastic_fifo_test/stochastic_fifo_test.cpp"
+  )
+if(NOT "${NEW_GLOB}" STREQUAL "${OLD_GLOB}")
+  message("-- GLOB mismatch!")
+  file(TOUCH_NOCREATE "/root/repo/_test_build/CMakeFiles/cmake.verify_globs")
+endif()
+
+# headers at src/executables/stochastic_fifo_test/CMakeLists.txt:6 (file)
+file(GLOB_RECURSE NEW_GLOB LIST_DIRECTORIES false "/root/repo/src/executables/stochastic_fifo_test/*.h")
+set(OLD_GLOB
+  )
+if(NOT "${NEW_GLOB}" STREQUAL "${OLD_GLOB}")
+  message("-- GLOB mismatch!")
+  file(TOUCH_NOCREATE "/root/repo/_test_build/CMakeFiles/cmake.verify_globs")
+endif()
+
+# sources at src/lib/algorithms/CMakeLists.txt:6 (file)
+file(GLOB_RECURSE NEW_GLOB LIST_DIRECTORIES false "/root/repo/src/lib/algorithms/*.cpp")
+set(OLD_GLOB
+  "/root/repo/src/lib/algorithms/dcl/dcl.cpp"
+  "/root/repo/src/lib/algorithms/dcl/samplegenerator.cpp"
+  "/root/repo/src/lib/algorithms/dcl/sequentialhalving.cpp"
+  "/root/repo/src/lib/algorithms/dcl/uniformactionselector.cpp"
+  "/root/repo/src/lib/algorithms/exactsolver/exactsolver.cpp"
+  "/root/repo/src/lib/algorithms/ppo/ppo.cpp"
+  )
+if(NOT "${NEW_GLOB}" STREQUAL "${OLD_GLOB}")
+  message("-- GLOB mismatch!")
+  file(TOUCH_NOCREATE "/root/repo/_test_build/CMakeFiles/cmake.verify_globs")
+endif()
+
+# headers at src/lib/algorithms/CMakeLists.txt:7 (file)
+file(GLOB_RECURSE NEW_GLOB LIST_DIRECTORIES false "/root/repo/src/lib/algorithms/*.h")
+set(OLD_GLOB
+  "/root/repo/src/lib/algorithms/exactsolver/statestore.h"
+  "/root/repo/src/lib/algorithms/include/dynaplex/dcl.h"
+  "/root/repo/src/lib/algorithms/include/dynaplex/exactsolver.h"
+  "/root/repo/src/lib/algorithms/include/dynaplex/ppo.h"
+  "/root/repo/src/lib/algorithms/include/dynaplex/samplegenerator.h"
+  "/root/repo/src/lib/algorithms/include/dynaplex/sequentialhalving.h"
+  "/root/repo/src/lib/algorithms/include/dynaplex/uniformactionselector.h"
+  )
+if(NOT "${NEW_GLOB}" STREQUAL "${OLD_GLOB}")
+  message("-- GLOB mismatch!")
+  file(TOUCH_NOCREATE "/root/repo/_test_build/CMakeFiles/cmake.verify_globs")
+endif()
+
+# sources at src/lib/core/CMakeLists.txt:6 (file)
+file(GLOB_RECURSE NEW_GLOB LIST_DIRECTORIES false "/root/repo/src/lib/core/*.cpp")
+set(OLD_GLOB
+  "/root/repo/src/lib/core/parallel_execute.cpp"
+  "/root/repo/src/lib/core/registry.cpp"
+  "/root/repo/src/lib/core/rng.cpp"
+  "/root/repo/src/lib/core/rngprovider.cpp"
+  "/root/repo/src/lib/core/system.cpp"
+  "/root/repo/src/lib/core/trajectory.cpp"
+  "/root/repo/src/lib/core/vargroup.cpp"
+  "/root/repo/src/lib/core/vargroup/vargroup_private_support_funcs.cpp"
+  )
+if(NOT "${NEW_GLOB}" STREQUAL "${OLD_GLOB}")
+  message("-- GLOB mismatch!")
+  file(TOUCH_NOCREATE "/root/repo/_test_build/CMakeFiles/cmake.verify_globs")
+endif()
+
+# headers at src/lib/core/CMakeLists.txt:7 (file)
+file(GLOB_RECURSE NEW_GLOB LIST_DIRECTORIES false "/root/repo/src/lib/core/*.h")
+set(OLD_GLOB
+  "/root/repo/src/lib/core/include/dynaplex/dynaplex_model_includes.h"
+  "/root/repo/src/lib/core/include/dynaplex/error.h"
+  "/root/repo/src/lib/core/include/dynaplex/features.h"
+  "/root/repo/src/lib/core/include/dynaplex/mdp.h"
+  "/root/repo/src/lib/core/include/dynaplex/parallel_execute.h"
+  "/root/repo/src/lib/core/include/dynaplex/policy.h"
+  "/root/repo/src/lib/core/include/dynaplex/registry.h"
+  "/root/repo/src/lib/core/include/dynaplex/rng.h"
+  "/root/repo/src/lib/core/include/dynaplex/rngprovider.h"
+  "/root/repo/src/lib/core/include/dynaplex/state.h"
+  "/root/repo/src/lib/core/include/dynaplex/statecategory.h"
+  "/root/repo/src/lib/core/include/dynaplex/system.h"
+  "/root/repo/src/lib/core/include/dynaplex/trajectory.h"
+  "/root/repo/src/lib/core/include/dynaplex/vargroup.h"
+  "/root/repo/src/lib/core/vargroup/nlohmann/json.h"
+  "/root/repo/src/lib/core/vargroup/nlohmann/json_fwd.h"
+  "/root/repo/src/lib/core/vargroup/picosha2.h"
+  "/root/repo/src/lib/core/vargroup/pybind11_json.h"
+  "/root/repo/src/lib/core/vargroup/vargroup_private_support_funcs.h"
+  )
+if(NOT "${NEW_GLOB}" STREQUAL "${OLD_GLOB}")
+  message("-- GLOB mismatch!")
+  file(TOUCH_NOCREATE "/root/repo/_test_build/CMakeFiles/cmake.verify_globs")
+endif()
+
+# sources at src/lib/dp/CMakeLists.txt:6 (file)
+file(GLOB_RECURSE NEW_GLOB LIST_DIRECTORIES false "/root/repo/src/lib/dp/*.cpp")
+set(OLD_GLOB
+  "/root/repo/src/lib/dp/dynaplexprovider.cpp"
+  )
+if(NOT "${NEW_GLOB}" STREQUAL "${OLD_GLOB}")
+  message("-- GLOB mismatch!")
+  file(TOUCH_NOCREATE "/root/repo/_test_build/CMakeFiles/cmake.verify_globs")
+endif()
+
+# headers at src/lib/dp/CMakeLists.txt:7 (file)
+file(GLOB_RECURSE NEW_GLOB LIST_DIRECTORIES false "/root/repo/src/lib/dp/*.h")
+set(OLD_GLOB
+  "/root/repo/src/lib/dp/include/dynaplex/dynaplexprovider.h"
+  )
+if(NOT "${NEW_GLOB}" STREQUAL "${OLD_GLOB}")
+  message("-- GLOB mismatch!")
+  file(TOUCH_NOCREATE "/root/repo/_test_build/CMakeFiles/cmake.verify_globs")
+endif()
+
+# sources at src/lib/models/CMakeLists.txt:6 (file)
+file(GLOB_RECURSE NEW_GLOB LIST_DIRECTORIES false "/root/repo/src/lib/models/*.cpp")
+set(OLD_GLOB
+  "/root/repo/src/lib/models/modelling/discretedist.cpp"
+  "/root/repo/src/lib/models/modelling/graph.cpp"
+  "/root/repo/src/lib/models/modelling/jointdiscretedist.cpp"
+  "/root/repo/src/lib/models/models/bin_packing/mdp.cpp"
+  "/root/repo/src/lib/models/models/collaborative_picking/mdp.cpp"
+  "/root/repo/src/lib/models/models/collaborative_picking/policies.cpp"
+  "/root/repo/src/lib/models/models/empty_example/mdp.cpp"
+  "/root/repo/src/lib/models/models/empty_example/policies.cpp"
+  "/root/repo/src/lib/models/models/exact_test_case/mdp.cpp"
+  "/root/repo/src/lib/models/models/exact_test_case/policies.cpp"
+  "/root/repo/src/lib/models/models/lost_sales/mdp.cpp"
+  "/root/repo/src/lib/models/models/lost_sales/policies.cpp"
+  "/root/repo/src/lib/models/models/order_picking/mdp.cpp"
+  "/root/repo/src/lib/models/models/order_picking/policies.cpp"
+  "/root/repo/src/lib/models/models/order_picking/state.cpp"
+  "/root/repo/src/lib/models/models/perishable_systems/mdp.cpp"
+  "/root/repo/src/lib/models/models/perishable_systems/policies.cpp"
+  "/root/repo/src/lib/models/models/queue_mdp/batch_sim.cpp"
+  "/root/repo/src/lib/models/models/queue_mdp/continuous_sim.cpp"
+  "/root/repo/src/lib/models/models/queue_mdp/kernels.cpp"
+  "/root/repo/src/lib/models/models/queue_mdp/mdp.cpp"
+  "/root/repo/src/lib/models/models/queue_mdp/policies.cpp"
+  "/root/repo/src/lib/models/models/queue_mdp/rvi.cpp"
+  "/root/repo/src/lib/models/models/queue_mdp/rvi_cache.cpp"
+  "/root/repo/src/lib/models/models/queue_mdp/rvi_scratch.cpp"
+  "/root/repo/src/lib/models/models/registrationmanager.cpp"
+  "/root/repo/src/lib/models/models/resource_allocation/mdp.cpp"
+  "/root/repo/src/lib/models/models/resource_allocation/policies.cpp"
+  )
+if(NOT "${NEW_GLOB}" STREQUAL "${OLD_GLOB}")
+  message("-- GLOB mismatch!")
+  file(TOUCH_NOCREATE "/root/repo/_test_build/CMakeFiles/cmake.verify_globs")
+endif()
+
+# headers at src/lib/models/CMakeLists.txt:7 (file)
+file(GLOB_RECURSE NEW_GLOB LIST_DIRECTORIES false "/root/repo/src/lib/models/*.h")
+set(OLD_GLOB
+  "/root/repo/src/lib/models/include/dynaplex/erasure/actionrangeprovider.h"
+  "/root/repo/src/lib/models/include/dynaplex/erasure/erasure_concepts.h"
+  "/root/repo/src/lib/models/include/dynaplex/erasure/greedypolicy.h"
+  "/root/repo/src/lib/models/include/dynaplex/erasure/makegeneric.h"
+  "/root/repo/src/lib/models/include/dynaplex/erasure/mdpadapter.h"
+  "/root/repo/src/lib/models/include/dynaplex/erasure/mdpadapter_tostate.h"
+  "/root/repo/src/lib/models/include/dynaplex/erasure/mdpregistrar.h"
+  "/root/repo/src/lib/models/include/dynaplex/erasure/policyadapter.h"
+  "/root/repo/src/lib/models/include/dynaplex/erasure/policyregistry.h"
+  "/root/repo/src/lib/models/include/dynaplex/erasure/randompolicy.h"
+  "/root/repo/src/lib/models/include/dynaplex/erasure/stateadapter.h"
+  "/root/repo/src/lib/models/include/dynaplex/modelling/discretedist.h"
+  "/root/repo/src/lib/models/include/dynaplex/modelling/eventheap.h"
+  "/root/repo/src/lib/models/include/dynaplex/modelling/fixedvector.h"
+  "/root/repo/src/lib/models/include/dynaplex/modelling/graph.h"
+  "/root/repo/src/lib/models/include/dynaplex/modelling/idcontainer.h"
+  "/root/repo/src/lib/models/include/dynaplex/modelling/idkeycontainer.h"
+  "/root/repo/src/lib/models/include/dynaplex/modelling/jointdiscretedist.h"
+  "/root/repo/src/lib/models/include/dynaplex/modelling/matrix.h"
+  "/root/repo/src/lib/models/include/dynaplex/modelling/queue.h"
+  "/root/repo/src/lib/models/include/dynaplex/modelling/ratetree.h"
+  "/root/repo/src/lib/models/include/dynaplex/modelling/scheduledevent.h"
+  "/root/repo/src/lib/models/include/dynaplex/models/bin_packing/mdp.h"
+  "/root/repo/src/lib/models/include/dynaplex/models/collaborative_picking/collaborative_picking_adaptor.h"
+  "/root/repo/src/lib/models/include/dynaplex/models/collaborative_picking/mdp.h"
+  "/root/repo/src/lib/models/include/dynaplex/models/collaborative_picking/mdp_helper_classes.h"
+  "/root/repo/src/lib/models/include/dynaplex/models/collaborative_picking/state_helper_classes.h"
+  "/root/repo/src/lib/models/include/dynaplex/models/registrationmanager.h"
+  "/root/repo/src/lib/models/include/dynaplex/retrievemdp.h"
+  "/root/repo/src/lib/models/include/dynaplex/retrievestate.h"
+  "/root/repo/src/lib/models/models/collaborative_picking/policies.h"
+  "/root/repo/src/lib/models/models/empty_example/mdp.h"
+  "/root/repo/src/lib/models/models/empty_example/policies.h"
+  "/root/repo/src/lib/models/models/exact_test_case/mdp.h"
+  "/root/repo/src/lib/models/models/exact_test_case/policies.h"
+  "/root/repo/src/lib/models/models/lost_sales/mdp.h"
+  "/root/repo/src/lib/models/models/lost_sales/policies.h"
+  "/root/repo/src/lib/models/models/order_picking/mdp.h"
+  "/root/repo/src/lib/models/models/order_picking/policies.h"
+  "/root/repo/src/lib/models/models/order_picking/state.h"
+  "/root/repo/src/lib/models/models/perishable_systems/mdp.h"
+  "/root/repo/src/lib/models/models/perishable_systems/policies.h"
+  "/root/repo/src/lib/models/models/queue_mdp/mdp.h"
+  "/root/repo/src/lib/models/models/queue_mdp/policies.h"
+  "/root/repo/src/lib/models/models/queue_mdp/rvi_scratch.h"
+  "/root/repo/src/lib/models/models/resource_allocation/mdp.h"
+  "/root/repo/src/lib/models/models/resource_allocation/mdp_helper_classes.h"
+  "/root/repo/src/lib/models/models/resource_allocation/policies.h"
+  "/root/repo/src/lib/models/models/resource_allocation/state_helper_classes.h"
+  )
+if(NOT "${NEW_GLOB}" STREQUAL "${OLD_GLOB}")
+  message("-- GLOB mismatch!")
+  file(TOUCH_NOCREATE "/root/repo/_test_build/CMakeFiles/cmake.verify_globs")
+endif()
+
+# sources at src/lib/nn/CMakeLists.txt:6 (file)
+file(GLOB_RECURSE NEW_GLOB LIST_DIRECTORIES false "/root/repo/src/lib/nn/*.cpp")
+set(OLD_GLOB
+  "/root/repo/src/lib/nn/neuralnetworkprovider.cpp"
+  "/root/repo/src/lib/nn/nn_policy.cpp"
+  "/root/repo/src/lib/nn/policytrainer.cpp"
+  "/root/repo/src/lib/nn/sample.cpp"
+  "/root/repo/src/lib/nn/sampledata.cpp"
+  "/root/repo/src/lib/nn/torchavailability.cpp"
+  "/root/repo/src/lib/nn/trainedpolicyprovider.cpp"
+  )
+if(NOT "${NEW_GLOB}" STREQUAL "${OLD_GLOB}")
+  message("-- GLOB mismatch!")
+  file(TOUCH_NOCREATE "/root/repo/_test_build/CMakeFiles/cmake.verify_globs")
+endif()
+
+# headers at src/lib/nn/CMakeLists.txt:7 (file)
+file(GLOB_RECURSE NEW_GLOB LIST_DIRECTORIES false "/root/repo/src/lib/nn/*.h")
+set(OLD_GLOB
+  "/root/repo/src/lib/nn/include/dynaplex/policytrainer.h"
+  "/root/repo/src/lib/nn/include/dynaplex/sample.h"
+  "/root/repo/src/lib/nn/include/dynaplex/sampledata.h"
+  "/root/repo/src/lib/nn/include/dynaplex/torchavailability.h"
+  "/root/repo/src/lib/nn/include/dynaplex/trainedpolicyprovider.h"
+  "/root/repo/src/lib/nn/neuralnetworkprovider.h"
+  "/root/repo/src/lib/nn/nn_policy.h"
+  "/root/repo/src/lib/nn/torchscriptwrapper.h"
+  )
+if(NOT "${NEW_GLOB}" STREQUAL "${OLD_GLOB}")
+  message("-- GLOB mismatch!")
+  file(TOUCH_NOCREATE "/root/repo/_test_build/CMakeFiles/cmake.verify_globs")
+endif()
+
+# sources at src/lib/utilities/CMakeLists.txt:6 (file)
+file(GLOB_RECURSE NEW_GLOB LIST_DIRECTORIES false "/root/repo/src/lib/utilities/*.cpp")
+set(OLD_GLOB
+  "/root/repo/src/lib/utilities/demonstrator.cpp"
+  "/root/repo/src/lib/utilities/policycomparer.cpp"
+  "/root/repo/src/lib/utilities/policycomparison.cpp"
+  )
+if(NOT "${NEW_GLOB}" STREQUAL "${OLD_GLOB}")
+  message("-- GLOB mismatch!")
+  file(TOUCH_NOCREATE "/root/repo/_test_build/CMakeFiles/cmake.verify_globs")
+endif()
+
+# headers at src/lib/utilities/CMakeLists.txt:7 (file)
+file(GLOB_RECURSE NEW_GLOB LIST_DIRECTORIES false "/root/repo/src/lib/utilities/*.h")
+set(OLD_GLOB
+  "/root/repo/src/lib/utilities/include/dynaplex/demonstrator.h"
+  "/root/repo/src/lib/utilities/include/dynaplex/policycomparer.h"
+  "/root/repo/src/lib/utilities/include/dynaplex/policycomparison.h"
+  )
+if(NOT "${NEW_GLOB}" STREQUAL "${OLD_GLOB}")
+  message("-- GLOB mismatch!")
+  file(TOUCH_NOCREATE "/root/repo/_test_build/CMakeFiles/cmake.verify_globs")
+endif()
+
+# sources at src/tests/mdp_unit_tests/CMakeLists.txt:11 (file)
+file(GLOB_RECURSE NEW_GLOB LIST_DIRECTORIES false "/root/repo/src/tests/mdp_unit_tests/*.cpp")
+set(OLD_GLOB
+  "/root/repo/src/tests/mdp_unit_tests/t_bin_packing.cpp"
+  "/root/repo/src/tests/mdp_unit_tests/t_collaborative_picking.cpp"
+  "/root/repo/src/tests/mdp_unit_tests/t_lost_sales.cpp"
+  "/root/repo/src/tests/mdp_unit_tests/t_order_picking.cpp"
+  "/root/repo/src/tests/mdp_unit_tests/t_perishables.cpp"
+  "/root/repo/src/tests/mdp_unit_tests/t_queue_model.cpp"
+  "/root/repo/src/tests/mdp_unit_tests/t_resource_allocation.cpp"
+  "/root/repo/src/tests/mdp_unit_tests/testutils.cpp"
+  )
+if(NOT "${NEW_GLOB}" STREQUAL "${OLD_GLOB}")
+  message("-- GLOB mismatch!")
+  file(TOUCH_NOCREATE "/root/repo/_test_build/CMakeFiles/cmake.verify_globs")
+endif()
+
+# headers at src/tests/mdp_unit_tests/CMakeLists.txt:12 (file)
+file(GLOB_RECURSE NEW_GLOB LIST_DIRECTORIES false "/root/repo/src/tests/mdp_unit_tests/*.h")
+set(OLD_GLOB
+  "/root/repo/src/tests/mdp_unit_tests/include/testutils.h"
+  )
+if(NOT "${NEW_GLOB}" STREQUAL "${OLD_GLOB}")
+  message("-- GLOB mismatch!")
+  file(TOUCH_NOCREATE "/root/repo/_test_build/CMakeFiles/cmake.verify_globs")
+endif()
+
+# sources at src/tests/new_tests/CMakeLists.txt:11 (file)
+file(GLOB_RECURSE NEW_GLOB LIST_DIRECTORIES false "/root/repo/src/tests/new_tests/*.cpp")
+set(OLD_GLOB
+  "/root/repo/src/tests/new_tests/t_some_test.cpp"
+  )
+if(NOT "${NEW_GLOB}" STREQUAL "${OLD_GLOB}")
+  message("-- GLOB mismatch!")
+  file(TOUCH_NOCREATE "/root/repo/_test_build/CMakeFiles/cmake.verify_globs")
+endif()
+
+# headers at src/tests/new_tests/CMakeLists.txt:12 (file)
+file(GLOB_RECURSE NEW_GLOB LIST_DIRECTORIES false "/root/repo/src/tests/new_tests/*.h")
+set(OLD_GLOB
+  )
+if(NOT "${NEW_GLOB}" STREQUAL "${OLD_GLOB}")
+  message("-- GLOB mismatch!")
+  file(TOUCH_NOCREATE "/root/repo/_test_build/CMakeFiles/cmake.verify_globs")
+endif()
+
+# sources at src/tests/other_unit_tests/CMakeLists.txt:11 (file)
+file(GLOB_RECURSE NEW_GLOB LIST_DIRECTORIES false "/root/repo/src/tests/other_unit_tests/*.cpp")
+set(OLD_GLOB
+  "/root/repo/src/tests/other_unit_tests/basic_components/t_discretedist.cpp"
+  "/root/repo/src/tests/other_unit_tests/basic_components/t_jointdiscretedist.cpp"
+  "/root/repo/src/tests/other_unit_tests/basic_components/t_matrix.cpp"
+  "/root/repo/src/tests/other_unit_tests/basic_components/t_queue.cpp"
+  "/root/repo/src/tests/other_unit_tests/basic_components/t_vargroup.cpp"
+  "/root/repo/src/tests/other_unit_tests/include/smallclass.cpp"
+  "/root/repo/src/tests/other_unit_tests/include/someclass.cpp"
+  "/root/repo/src/tests/other_unit_tests/t_dcl.cpp"
+  "/root/repo/src/tests/other_unit_tests/t_demonstrator.cpp"
+  "/root/repo/src/tests/other_unit_tests/t_eventheap.cpp"
+  "/root/repo/src/tests/other_unit_tests/t_exact_solver_tests.cpp"
+  "/root/repo/src/tests/other_unit_tests/t_features.cpp"
+  "/root/repo/src/tests/other_unit_tests/t_graph.cpp"
+  "/root/repo/src/tests/other_unit_tests/t_idcontainer.cpp"
+  "/root/repo/src/tests/other_unit_tests/t_initiateclasswithvargroup.cpp"
+  "/root/repo/src/tests/other_unit_tests/t_mdp_actions.cpp"
+  "/root/repo/src/tests/other_unit_tests/t_model_provider.cpp"
+  "/root/repo/src/tests/other_unit_tests/t_policycomparer.cpp"
+  "/root/repo/src/tests/other_unit_tests/t_pytorch.cpp"
+  "/root/repo/src/tests/other_unit_tests/t_rngprovider.cpp"
+  "/root/repo/src/tests/other_unit_tests/t_sampledata.cpp"
+  "/root/repo/src/tests/other_unit_tests/t_state_retrieval.cpp"
+  "/root/repo/src/tests/other_unit_tests/t_statecategory.cpp"
+  "/root/repo/src/tests/other_unit_tests/t_vargroup_dict.cpp"
+  )
+if(NOT "${NEW_GLOB}" STREQUAL "${OLD_GLOB}")
+  message("-- GLOB mismatch!")
+  file(TOUCH_NOCREATE "/root/repo/_test_build/CMakeFiles/cmake.verify_globs")
+endif()
+
+# headers at src/tests/other_unit_tests/CMakeLists.txt:12 (file)
+file(GLOB_RECURSE NEW_GLOB LIST_DIRECTORIES false "/root/repo/src/tests/other_unit_tests/*.h")
+set(OLD_GLOB
+  "/root/repo/src/tests/other_unit_tests/include/smallclass.h"
+  "/root/repo/src/tests/other_unit_tests/include/someclass.h"
+  )
+if(NOT "${NEW_GLOB}" STREQUAL "${OLD_GLOB}")
+  message("-- GLOB mismatch!")
+  file(TOUCH_NOCREATE "/root/repo/_test_build/CMakeFiles/cmake.verify_globs")
+endif()
+
+# MODEL_JSON_FILES at src/lib/models/CMakeLists.txt:37 (file)
+file(GLOB_RECURSE NEW_GLOB LIST_DIRECTORIES false RELATIVE "/root/repo/src/lib/models/models" "/root/repo/src/lib/models/models/*/*.json")
+set(OLD_GLOB
+  "bin_packing/mdp_config_0.json"
+  "collaborative_picking/mdp_config_0.json"
+  "collaborative_picking/mdp_config_1.json"
+  "collaborative_picking/mdp_config_2.json"
+  "collaborative_picking/mdp_config_3.json"
+  "collaborative_picking/mdp_config_3_1.json"
+  "collaborative_picking/mdp_config_4.json"
+  "collaborative_picking/mdp_config_5.json"
+  "collaborative_picking/mdp_config_6.json"
+  "collaborative_picking/mdp_config_7.json"
+  "collaborative_picking/mdp_config_8.json"
+  "collaborative_picking/policy_config_0.json"
+  "empty_example/mdp_config_0.json"
+  "empty_example/policy_config_0.json"
+  "exact_test_case/mdp_config_0.json"
+  "exact_test_case/policy_config_0.json"
+  "lost_sales/mdp_config_0.json"
+  "lost_sales/mdp_config_1.json"
+  "lost_sales/mdp_config_2.json"
+  "lost_sales/policy_config_1.json"
+  "order_picking/mdp_config_0.json"
+  "order_picking/policy_config_0.json"
+  "perishable_systems/mdp_config_0.json"
+  "perishable_systems/mdp_config_1.json"
+  "perishable_systems/mdp_config_2.json"
+  "perishable_systems/policy_config_1.json"
+  "queue_mdp/mdp_config_0.json"
+  "queue_mdp/mdp_config_1.json"
+  "queue_mdp/mdp_config_asym_cost_2s.json"
+  "queue_mdp/mdp_config_cand_a4.json"
+  "queue_mdp/mdp_config_cand_a6.json"
+  "queue_mdp/mdp_config_cand_a_antidue.json"
+  "queue_mdp/mdp_config_cand_b_purefrac.json"
+  "queue_mdp/mdp_config_cand_c_wnet.json"
+  "queue_mdp/mdp_config_cand_d_bottleneck.json"
+  "queue_mdp/mdp_config_exp2_specialist_gen.json"
+  "queue_mdp/mdp_config_flex_2s.json"
+  "queue_mdp/mdp_config_flex_loaded_2s.json"
+  "queue_mdp/mdp_config_large_6j5s.json"
+  "queue_mdp/mdp_config_simple.json"
+  "queue_mdp/mdp_config_simple_asym.json"
+  "queue_mdp/policy_config_0.json"
+  "resource_allocation/mdp_config_0.json"
+  "resource_allocation/mdp_config_1.json"
+  "resource_allocation/policy_config_0.json"
+  )
+if(NOT "${NEW_GLOB}" STREQUAL "${OLD_GLOB}")
+  message("-- GLOB mismatch!")
+  file(TOUCH_NOCREATE "/root/repo/_test_build/CMakeFiles/cmake.verify_globs")
+endif()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/action_label_test"
+  "../../../bin/action_label_test.pdb"
+  "CMakeFiles/action_label_test.dir/action_label_test.cpp.o"
+  "CMakeFiles/action_label_test.dir/action_label_test.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/action_label_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/binpacking_evaluate"
+  "../../../bin/binpacking_evaluate.pdb"
+  "CMakeFiles/binpacking_evaluate.dir/binpacking_evaluate.cpp.o"
+  "CMakeFiles/binpacking_evaluate.dir/binpacking_evaluate.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/binpacking_evaluate.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
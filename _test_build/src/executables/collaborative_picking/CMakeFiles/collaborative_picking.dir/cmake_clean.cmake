@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/collaborative_picking"
+  "../../../bin/collaborative_picking.pdb"
+  "CMakeFiles/collaborative_picking.dir/collaborative_picking.cpp.o"
+  "CMakeFiles/collaborative_picking.dir/collaborative_picking.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/collaborative_picking.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
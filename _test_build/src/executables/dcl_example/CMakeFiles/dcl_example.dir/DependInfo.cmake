@@ -0,0 +1,25 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/executables/dcl_example/dcl_example.cpp" "src/executables/dcl_example/CMakeFiles/dcl_example.dir/dcl_example.cpp.o" "gcc" "src/executables/dcl_example/CMakeFiles/dcl_example.dir/dcl_example.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_test_build/src/lib/dp/CMakeFiles/DP_DynaPlex.dir/DependInfo.cmake"
+  "/root/repo/_test_build/src/lib/models/CMakeFiles/DP_Models.dir/DependInfo.cmake"
+  "/root/repo/_test_build/src/lib/algorithms/CMakeFiles/DP_Algorithms.dir/DependInfo.cmake"
+  "/root/repo/_test_build/src/lib/nn/CMakeFiles/DP_NN.dir/DependInfo.cmake"
+  "/root/repo/_test_build/src/lib/utilities/CMakeFiles/DP_Utilities.dir/DependInfo.cmake"
+  "/root/repo/_test_build/src/lib/core/CMakeFiles/DP_Core.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/dcl_example"
+  "../../../bin/dcl_example.pdb"
+  "CMakeFiles/dcl_example.dir/dcl_example.cpp.o"
+  "CMakeFiles/dcl_example.dir/dcl_example.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/dcl_example.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
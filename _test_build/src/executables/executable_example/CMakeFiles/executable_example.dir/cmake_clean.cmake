@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/executable_example"
+  "../../../bin/executable_example.pdb"
+  "CMakeFiles/executable_example.dir/executable_example.cpp.o"
+  "CMakeFiles/executable_example.dir/executable_example.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/executable_example.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/executable_order_picking"
+  "../../../bin/executable_order_picking.pdb"
+  "CMakeFiles/executable_order_picking.dir/executable_order_picking.cpp.o"
+  "CMakeFiles/executable_order_picking.dir/executable_order_picking.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/executable_order_picking.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/lostsales_exact"
+  "../../../bin/lostsales_exact.pdb"
+  "CMakeFiles/lostsales_exact.dir/lostsales_exact.cpp.o"
+  "CMakeFiles/lostsales_exact.dir/lostsales_exact.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/lostsales_exact.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/lostsales_paper_results"
+  "../../../bin/lostsales_paper_results.pdb"
+  "CMakeFiles/lostsales_paper_results.dir/lostsales_paper_results.cpp.o"
+  "CMakeFiles/lostsales_paper_results.dir/lostsales_paper_results.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/lostsales_paper_results.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
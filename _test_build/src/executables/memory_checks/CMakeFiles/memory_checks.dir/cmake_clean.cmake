@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/memory_checks"
+  "../../../bin/memory_checks.pdb"
+  "CMakeFiles/memory_checks.dir/memory_checks.cpp.o"
+  "CMakeFiles/memory_checks.dir/memory_checks.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/memory_checks.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
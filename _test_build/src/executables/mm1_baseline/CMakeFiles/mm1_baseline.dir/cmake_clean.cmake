@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/mm1_baseline"
+  "../../../bin/mm1_baseline.pdb"
+  "CMakeFiles/mm1_baseline.dir/mm1_baseline.cpp.o"
+  "CMakeFiles/mm1_baseline.dir/mm1_baseline.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/mm1_baseline.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/mm1_sensitivity"
+  "../../../bin/mm1_sensitivity.pdb"
+  "CMakeFiles/mm1_sensitivity.dir/mm1_sensitivity.cpp.o"
+  "CMakeFiles/mm1_sensitivity.dir/mm1_sensitivity.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/mm1_sensitivity.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/parametric_policy_opt"
+  "../../../bin/parametric_policy_opt.pdb"
+  "CMakeFiles/parametric_policy_opt.dir/parametric_policy_opt.cpp.o"
+  "CMakeFiles/parametric_policy_opt.dir/parametric_policy_opt.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/parametric_policy_opt.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/perishables_paper_results"
+  "../../../bin/perishables_paper_results.pdb"
+  "CMakeFiles/perishables_paper_results.dir/perishables_paper_results.cpp.o"
+  "CMakeFiles/perishables_paper_results.dir/perishables_paper_results.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/perishables_paper_results.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/ppo_test"
+  "../../../bin/ppo_test.pdb"
+  "CMakeFiles/ppo_test.dir/ppo_test.cpp.o"
+  "CMakeFiles/ppo_test.dir/ppo_test.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ppo_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/ppo_validate"
+  "../../../bin/ppo_validate.pdb"
+  "CMakeFiles/ppo_validate.dir/ppo_validate.cpp.o"
+  "CMakeFiles/ppo_validate.dir/ppo_validate.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ppo_validate.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/queue_ablation"
+  "../../../bin/queue_ablation.pdb"
+  "CMakeFiles/queue_ablation.dir/queue_ablation.cpp.o"
+  "CMakeFiles/queue_ablation.dir/queue_ablation.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/queue_ablation.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
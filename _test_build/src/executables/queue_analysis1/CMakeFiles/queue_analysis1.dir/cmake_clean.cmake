@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/queue_analysis1"
+  "../../../bin/queue_analysis1.pdb"
+  "CMakeFiles/queue_analysis1.dir/queue_analysis1.cpp.o"
+  "CMakeFiles/queue_analysis1.dir/queue_analysis1.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/queue_analysis1.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
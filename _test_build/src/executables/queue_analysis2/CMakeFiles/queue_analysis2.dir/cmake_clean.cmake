@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/queue_analysis2"
+  "../../../bin/queue_analysis2.pdb"
+  "CMakeFiles/queue_analysis2.dir/queue_analysis2.cpp.o"
+  "CMakeFiles/queue_analysis2.dir/queue_analysis2.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/queue_analysis2.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/queue_cont_sim"
+  "../../../bin/queue_cont_sim.pdb"
+  "CMakeFiles/queue_cont_sim.dir/queue_cont_sim.cpp.o"
+  "CMakeFiles/queue_cont_sim.dir/queue_cont_sim.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/queue_cont_sim.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
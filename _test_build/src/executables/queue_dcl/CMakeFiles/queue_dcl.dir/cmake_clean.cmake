@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/queue_dcl"
+  "../../../bin/queue_dcl.pdb"
+  "CMakeFiles/queue_dcl.dir/queue_dcl.cpp.o"
+  "CMakeFiles/queue_dcl.dir/queue_dcl.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/queue_dcl.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/queue_dcl_probe"
+  "../../../bin/queue_dcl_probe.pdb"
+  "CMakeFiles/queue_dcl_probe.dir/queue_dcl_probe.cpp.o"
+  "CMakeFiles/queue_dcl_probe.dir/queue_dcl_probe.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/queue_dcl_probe.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/queue_depth_study"
+  "../../../bin/queue_depth_study.pdb"
+  "CMakeFiles/queue_depth_study.dir/queue_depth_study.cpp.o"
+  "CMakeFiles/queue_depth_study.dir/queue_depth_study.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/queue_depth_study.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/queue_dsweep"
+  "../../../bin/queue_dsweep.pdb"
+  "CMakeFiles/queue_dsweep.dir/queue_dsweep.cpp.o"
+  "CMakeFiles/queue_dsweep.dir/queue_dsweep.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/queue_dsweep.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
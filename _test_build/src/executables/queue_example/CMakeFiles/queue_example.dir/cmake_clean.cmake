@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/queue_example"
+  "../../../bin/queue_example.pdb"
+  "CMakeFiles/queue_example.dir/queue_example.cpp.o"
+  "CMakeFiles/queue_example.dir/queue_example.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/queue_example.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/queue_matrix"
+  "../../../bin/queue_matrix.pdb"
+  "CMakeFiles/queue_matrix.dir/queue_matrix.cpp.o"
+  "CMakeFiles/queue_matrix.dir/queue_matrix.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/queue_matrix.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
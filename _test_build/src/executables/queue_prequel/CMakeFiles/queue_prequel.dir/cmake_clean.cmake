@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/queue_prequel"
+  "../../../bin/queue_prequel.pdb"
+  "CMakeFiles/queue_prequel.dir/queue_prequel.cpp.o"
+  "CMakeFiles/queue_prequel.dir/queue_prequel.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/queue_prequel.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
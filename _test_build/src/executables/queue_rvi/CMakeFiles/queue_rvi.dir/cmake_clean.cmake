@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/queue_rvi"
+  "../../../bin/queue_rvi.pdb"
+  "CMakeFiles/queue_rvi.dir/queue_rvi.cpp.o"
+  "CMakeFiles/queue_rvi.dir/queue_rvi.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/queue_rvi.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
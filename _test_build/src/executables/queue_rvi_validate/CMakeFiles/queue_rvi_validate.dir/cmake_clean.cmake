@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/queue_rvi_validate"
+  "../../../bin/queue_rvi_validate.pdb"
+  "CMakeFiles/queue_rvi_validate.dir/queue_rvi_validate.cpp.o"
+  "CMakeFiles/queue_rvi_validate.dir/queue_rvi_validate.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/queue_rvi_validate.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/queue_scale_study"
+  "../../../bin/queue_scale_study.pdb"
+  "CMakeFiles/queue_scale_study.dir/queue_scale_study.cpp.o"
+  "CMakeFiles/queue_scale_study.dir/queue_scale_study.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/queue_scale_study.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
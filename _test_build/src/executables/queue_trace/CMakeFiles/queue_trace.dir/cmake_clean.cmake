@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/queue_trace"
+  "../../../bin/queue_trace.pdb"
+  "CMakeFiles/queue_trace.dir/queue_trace.cpp.o"
+  "CMakeFiles/queue_trace.dir/queue_trace.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/queue_trace.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
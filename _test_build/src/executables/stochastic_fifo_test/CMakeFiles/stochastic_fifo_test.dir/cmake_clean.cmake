@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/stochastic_fifo_test"
+  "../../../bin/stochastic_fifo_test.pdb"
+  "CMakeFiles/stochastic_fifo_test.dir/stochastic_fifo_test.cpp.o"
+  "CMakeFiles/stochastic_fifo_test.dir/stochastic_fifo_test.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/stochastic_fifo_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
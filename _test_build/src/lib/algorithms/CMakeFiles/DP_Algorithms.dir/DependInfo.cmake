@@ -0,0 +1,27 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/lib/algorithms/dcl/dcl.cpp" "src/lib/algorithms/CMakeFiles/DP_Algorithms.dir/dcl/dcl.cpp.o" "gcc" "src/lib/algorithms/CMakeFiles/DP_Algorithms.dir/dcl/dcl.cpp.o.d"
+  "/root/repo/src/lib/algorithms/dcl/samplegenerator.cpp" "src/lib/algorithms/CMakeFiles/DP_Algorithms.dir/dcl/samplegenerator.cpp.o" "gcc" "src/lib/algorithms/CMakeFiles/DP_Algorithms.dir/dcl/samplegenerator.cpp.o.d"
+  "/root/repo/src/lib/algorithms/dcl/sequentialhalving.cpp" "src/lib/algorithms/CMakeFiles/DP_Algorithms.dir/dcl/sequentialhalving.cpp.o" "gcc" "src/lib/algorithms/CMakeFiles/DP_Algorithms.dir/dcl/sequentialhalving.cpp.o.d"
+  "/root/repo/src/lib/algorithms/dcl/uniformactionselector.cpp" "src/lib/algorithms/CMakeFiles/DP_Algorithms.dir/dcl/uniformactionselector.cpp.o" "gcc" "src/lib/algorithms/CMakeFiles/DP_Algorithms.dir/dcl/uniformactionselector.cpp.o.d"
+  "/root/repo/src/lib/algorithms/exactsolver/exactsolver.cpp" "src/lib/algorithms/CMakeFiles/DP_Algorithms.dir/exactsolver/exactsolver.cpp.o" "gcc" "src/lib/algorithms/CMakeFiles/DP_Algorithms.dir/exactsolver/exactsolver.cpp.o.d"
+  "/root/repo/src/lib/algorithms/ppo/ppo.cpp" "src/lib/algorithms/CMakeFiles/DP_Algorithms.dir/ppo/ppo.cpp.o" "gcc" "src/lib/algorithms/CMakeFiles/DP_Algorithms.dir/ppo/ppo.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_test_build/src/lib/core/CMakeFiles/DP_Core.dir/DependInfo.cmake"
+  "/root/repo/_test_build/src/lib/nn/CMakeFiles/DP_NN.dir/DependInfo.cmake"
+  "/root/repo/_test_build/src/lib/utilities/CMakeFiles/DP_Utilities.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,21 @@
+file(REMOVE_RECURSE
+  "../../../lib/libDynaPlex_Algorithms.a"
+  "../../../lib/libDynaPlex_Algorithms.pdb"
+  "CMakeFiles/DP_Algorithms.dir/dcl/dcl.cpp.o"
+  "CMakeFiles/DP_Algorithms.dir/dcl/dcl.cpp.o.d"
+  "CMakeFiles/DP_Algorithms.dir/dcl/samplegenerator.cpp.o"
+  "CMakeFiles/DP_Algorithms.dir/dcl/samplegenerator.cpp.o.d"
+  "CMakeFiles/DP_Algorithms.dir/dcl/sequentialhalving.cpp.o"
+  "CMakeFiles/DP_Algorithms.dir/dcl/sequentialhalving.cpp.o.d"
+  "CMakeFiles/DP_Algorithms.dir/dcl/uniformactionselector.cpp.o"
+  "CMakeFiles/DP_Algorithms.dir/dcl/uniformactionselector.cpp.o.d"
+  "CMakeFiles/DP_Algorithms.dir/exactsolver/exactsolver.cpp.o"
+  "CMakeFiles/DP_Algorithms.dir/exactsolver/exactsolver.cpp.o.d"
+  "CMakeFiles/DP_Algorithms.dir/ppo/ppo.cpp.o"
+  "CMakeFiles/DP_Algorithms.dir/ppo/ppo.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/DP_Algorithms.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,26 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/lib/core/parallel_execute.cpp" "src/lib/core/CMakeFiles/DP_Core.dir/parallel_execute.cpp.o" "gcc" "src/lib/core/CMakeFiles/DP_Core.dir/parallel_execute.cpp.o.d"
+  "/root/repo/src/lib/core/registry.cpp" "src/lib/core/CMakeFiles/DP_Core.dir/registry.cpp.o" "gcc" "src/lib/core/CMakeFiles/DP_Core.dir/registry.cpp.o.d"
+  "/root/repo/src/lib/core/rng.cpp" "src/lib/core/CMakeFiles/DP_Core.dir/rng.cpp.o" "gcc" "src/lib/core/CMakeFiles/DP_Core.dir/rng.cpp.o.d"
+  "/root/repo/src/lib/core/rngprovider.cpp" "src/lib/core/CMakeFiles/DP_Core.dir/rngprovider.cpp.o" "gcc" "src/lib/core/CMakeFiles/DP_Core.dir/rngprovider.cpp.o.d"
+  "/root/repo/src/lib/core/system.cpp" "src/lib/core/CMakeFiles/DP_Core.dir/system.cpp.o" "gcc" "src/lib/core/CMakeFiles/DP_Core.dir/system.cpp.o.d"
+  "/root/repo/src/lib/core/trajectory.cpp" "src/lib/core/CMakeFiles/DP_Core.dir/trajectory.cpp.o" "gcc" "src/lib/core/CMakeFiles/DP_Core.dir/trajectory.cpp.o.d"
+  "/root/repo/src/lib/core/vargroup.cpp" "src/lib/core/CMakeFiles/DP_Core.dir/vargroup.cpp.o" "gcc" "src/lib/core/CMakeFiles/DP_Core.dir/vargroup.cpp.o.d"
+  "/root/repo/src/lib/core/vargroup/vargroup_private_support_funcs.cpp" "src/lib/core/CMakeFiles/DP_Core.dir/vargroup/vargroup_private_support_funcs.cpp.o" "gcc" "src/lib/core/CMakeFiles/DP_Core.dir/vargroup/vargroup_private_support_funcs.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,25 @@
+file(REMOVE_RECURSE
+  "../../../lib/libDynaPlex_Core.a"
+  "../../../lib/libDynaPlex_Core.pdb"
+  "CMakeFiles/DP_Core.dir/parallel_execute.cpp.o"
+  "CMakeFiles/DP_Core.dir/parallel_execute.cpp.o.d"
+  "CMakeFiles/DP_Core.dir/registry.cpp.o"
+  "CMakeFiles/DP_Core.dir/registry.cpp.o.d"
+  "CMakeFiles/DP_Core.dir/rng.cpp.o"
+  "CMakeFiles/DP_Core.dir/rng.cpp.o.d"
+  "CMakeFiles/DP_Core.dir/rngprovider.cpp.o"
+  "CMakeFiles/DP_Core.dir/rngprovider.cpp.o.d"
+  "CMakeFiles/DP_Core.dir/system.cpp.o"
+  "CMakeFiles/DP_Core.dir/system.cpp.o.d"
+  "CMakeFiles/DP_Core.dir/trajectory.cpp.o"
+  "CMakeFiles/DP_Core.dir/trajectory.cpp.o.d"
+  "CMakeFiles/DP_Core.dir/vargroup.cpp.o"
+  "CMakeFiles/DP_Core.dir/vargroup.cpp.o.d"
+  "CMakeFiles/DP_Core.dir/vargroup/vargroup_private_support_funcs.cpp.o"
+  "CMakeFiles/DP_Core.dir/vargroup/vargroup_private_support_funcs.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/DP_Core.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
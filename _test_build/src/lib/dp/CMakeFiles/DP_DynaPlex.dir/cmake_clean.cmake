@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../lib/libDynaPlex.pdb"
+  "../../../lib/libDynaPlex.so"
+  "CMakeFiles/DP_DynaPlex.dir/dynaplexprovider.cpp.o"
+  "CMakeFiles/DP_DynaPlex.dir/dynaplexprovider.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/DP_DynaPlex.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
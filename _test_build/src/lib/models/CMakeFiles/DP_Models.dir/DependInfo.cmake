@@ -0,0 +1,47 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/lib/models/modelling/discretedist.cpp" "src/lib/models/CMakeFiles/DP_Models.dir/modelling/discretedist.cpp.o" "gcc" "src/lib/models/CMakeFiles/DP_Models.dir/modelling/discretedist.cpp.o.d"
+  "/root/repo/src/lib/models/modelling/graph.cpp" "src/lib/models/CMakeFiles/DP_Models.dir/modelling/graph.cpp.o" "gcc" "src/lib/models/CMakeFiles/DP_Models.dir/modelling/graph.cpp.o.d"
+  "/root/repo/src/lib/models/modelling/jointdiscretedist.cpp" "src/lib/models/CMakeFiles/DP_Models.dir/modelling/jointdiscretedist.cpp.o" "gcc" "src/lib/models/CMakeFiles/DP_Models.dir/modelling/jointdiscretedist.cpp.o.d"
+  "/root/repo/src/lib/models/models/bin_packing/mdp.cpp" "src/lib/models/CMakeFiles/DP_Models.dir/models/bin_packing/mdp.cpp.o" "gcc" "src/lib/models/CMakeFiles/DP_Models.dir/models/bin_packing/mdp.cpp.o.d"
+  "/root/repo/src/lib/models/models/collaborative_picking/mdp.cpp" "src/lib/models/CMakeFiles/DP_Models.dir/models/collaborative_picking/mdp.cpp.o" "gcc" "src/lib/models/CMakeFiles/DP_Models.dir/models/collaborative_picking/mdp.cpp.o.d"
+  "/root/repo/src/lib/models/models/collaborative_picking/policies.cpp" "src/lib/models/CMakeFiles/DP_Models.dir/models/collaborative_picking/policies.cpp.o" "gcc" "src/lib/models/CMakeFiles/DP_Models.dir/models/collaborative_picking/policies.cpp.o.d"
+  "/root/repo/src/lib/models/models/empty_example/mdp.cpp" "src/lib/models/CMakeFiles/DP_Models.dir/models/empty_example/mdp.cpp.o" "gcc" "src/lib/models/CMakeFiles/DP_Models.dir/models/empty_example/mdp.cpp.o.d"
+  "/root/repo/src/lib/models/models/empty_example/policies.cpp" "src/lib/models/CMakeFiles/DP_Models.dir/models/empty_example/policies.cpp.o" "gcc" "src/lib/models/CMakeFiles/DP_Models.dir/models/empty_example/policies.cpp.o.d"
+  "/root/repo/src/lib/models/models/exact_test_case/mdp.cpp" "src/lib/models/CMakeFiles/DP_Models.dir/models/exact_test_case/mdp.cpp.o" "gcc" "src/lib/models/CMakeFiles/DP_Models.dir/models/exact_test_case/mdp.cpp.o.d"
+  "/root/repo/src/lib/models/models/exact_test_case/policies.cpp" "src/lib/models/CMakeFiles/DP_Models.dir/models/exact_test_case/policies.cpp.o" "gcc" "src/lib/models/CMakeFiles/DP_Models.dir/models/exact_test_case/policies.cpp.o.d"
+  "/root/repo/src/lib/models/models/lost_sales/mdp.cpp" "src/lib/models/CMakeFiles/DP_Models.dir/models/lost_sales/mdp.cpp.o" "gcc" "src/lib/models/CMakeFiles/DP_Models.dir/models/lost_sales/mdp.cpp.o.d"
+  "/root/repo/src/lib/models/models/lost_sales/policies.cpp" "src/lib/models/CMakeFiles/DP_Models.dir/models/lost_sales/policies.cpp.o" "gcc" "src/lib/models/CMakeFiles/DP_Models.dir/models/lost_sales/policies.cpp.o.d"
+  "/root/repo/src/lib/models/models/order_picking/mdp.cpp" "src/lib/models/CMakeFiles/DP_Models.dir/models/order_picking/mdp.cpp.o" "gcc" "src/lib/models/CMakeFiles/DP_Models.dir/models/order_picking/mdp.cpp.o.d"
+  "/root/repo/src/lib/models/models/order_picking/policies.cpp" "src/lib/models/CMakeFiles/DP_Models.dir/models/order_picking/policies.cpp.o" "gcc" "src/lib/models/CMakeFiles/DP_Models.dir/models/order_picking/policies.cpp.o.d"
+  "/root/repo/src/lib/models/models/order_picking/state.cpp" "src/lib/models/CMakeFiles/DP_Models.dir/models/order_picking/state.cpp.o" "gcc" "src/lib/models/CMakeFiles/DP_Models.dir/models/order_picking/state.cpp.o.d"
+  "/root/repo/src/lib/models/models/perishable_systems/mdp.cpp" "src/lib/models/CMakeFiles/DP_Models.dir/models/perishable_systems/mdp.cpp.o" "gcc" "src/lib/models/CMakeFiles/DP_Models.dir/models/perishable_systems/mdp.cpp.o.d"
+  "/root/repo/src/lib/models/models/perishable_systems/policies.cpp" "src/lib/models/CMakeFiles/DP_Models.dir/models/perishable_systems/policies.cpp.o" "gcc" "src/lib/models/CMakeFiles/DP_Models.dir/models/perishable_systems/policies.cpp.o.d"
+  "/root/repo/src/lib/models/models/queue_mdp/batch_sim.cpp" "src/lib/models/CMakeFiles/DP_Models.dir/models/queue_mdp/batch_sim.cpp.o" "gcc" "src/lib/models/CMakeFiles/DP_Models.dir/models/queue_mdp/batch_sim.cpp.o.d"
+  "/root/repo/src/lib/models/models/queue_mdp/continuous_sim.cpp" "src/lib/models/CMakeFiles/DP_Models.dir/models/queue_mdp/continuous_sim.cpp.o" "gcc" "src/lib/models/CMakeFiles/DP_Models.dir/models/queue_mdp/continuous_sim.cpp.o.d"
+  "/root/repo/src/lib/models/models/queue_mdp/kernels.cpp" "src/lib/models/CMakeFiles/DP_Models.dir/models/queue_mdp/kernels.cpp.o" "gcc" "src/lib/models/CMakeFiles/DP_Models.dir/models/queue_mdp/kernels.cpp.o.d"
+  "/root/repo/src/lib/models/models/queue_mdp/mdp.cpp" "src/lib/models/CMakeFiles/DP_Models.dir/models/queue_mdp/mdp.cpp.o" "gcc" "src/lib/models/CMakeFiles/DP_Models.dir/models/queue_mdp/mdp.cpp.o.d"
+  "/root/repo/src/lib/models/models/queue_mdp/policies.cpp" "src/lib/models/CMakeFiles/DP_Models.dir/models/queue_mdp/policies.cpp.o" "gcc" "src/lib/models/CMakeFiles/DP_Models.dir/models/queue_mdp/policies.cpp.o.d"
+  "/root/repo/src/lib/models/models/queue_mdp/rvi.cpp" "src/lib/models/CMakeFiles/DP_Models.dir/models/queue_mdp/rvi.cpp.o" "gcc" "src/lib/models/CMakeFiles/DP_Models.dir/models/queue_mdp/rvi.cpp.o.d"
+  "/root/repo/src/lib/models/models/queue_mdp/rvi_cache.cpp" "src/lib/models/CMakeFiles/DP_Models.dir/models/queue_mdp/rvi_cache.cpp.o" "gcc" "src/lib/models/CMakeFiles/DP_Models.dir/models/queue_mdp/rvi_cache.cpp.o.d"
+  "/root/repo/src/lib/models/models/queue_mdp/rvi_scratch.cpp" "src/lib/models/CMakeFiles/DP_Models.dir/models/queue_mdp/rvi_scratch.cpp.o" "gcc" "src/lib/models/CMakeFiles/DP_Models.dir/models/queue_mdp/rvi_scratch.cpp.o.d"
+  "/root/repo/src/lib/models/models/registrationmanager.cpp" "src/lib/models/CMakeFiles/DP_Models.dir/models/registrationmanager.cpp.o" "gcc" "src/lib/models/CMakeFiles/DP_Models.dir/models/registrationmanager.cpp.o.d"
+  "/root/repo/src/lib/models/models/resource_allocation/mdp.cpp" "src/lib/models/CMakeFiles/DP_Models.dir/models/resource_allocation/mdp.cpp.o" "gcc" "src/lib/models/CMakeFiles/DP_Models.dir/models/resource_allocation/mdp.cpp.o.d"
+  "/root/repo/src/lib/models/models/resource_allocation/policies.cpp" "src/lib/models/CMakeFiles/DP_Models.dir/models/resource_allocation/policies.cpp.o" "gcc" "src/lib/models/CMakeFiles/DP_Models.dir/models/resource_allocation/policies.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_test_build/src/lib/core/CMakeFiles/DP_Core.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,65 @@
+file(REMOVE_RECURSE
+  "../../../lib/libDynaPlex_Models.a"
+  "../../../lib/libDynaPlex_Models.pdb"
+  "CMakeFiles/DP_Models.dir/modelling/discretedist.cpp.o"
+  "CMakeFiles/DP_Models.dir/modelling/discretedist.cpp.o.d"
+  "CMakeFiles/DP_Models.dir/modelling/graph.cpp.o"
+  "CMakeFiles/DP_Models.dir/modelling/graph.cpp.o.d"
+  "CMakeFiles/DP_Models.dir/modelling/jointdiscretedist.cpp.o"
+  "CMakeFiles/DP_Models.dir/modelling/jointdiscretedist.cpp.o.d"
+  "CMakeFiles/DP_Models.dir/models/bin_packing/mdp.cpp.o"
+  "CMakeFiles/DP_Models.dir/models/bin_packing/mdp.cpp.o.d"
+  "CMakeFiles/DP_Models.dir/models/collaborative_picking/mdp.cpp.o"
+  "CMakeFiles/DP_Models.dir/models/collaborative_picking/mdp.cpp.o.d"
+  "CMakeFiles/DP_Models.dir/models/collaborative_picking/policies.cpp.o"
+  "CMakeFiles/DP_Models.dir/models/collaborative_picking/policies.cpp.o.d"
+  "CMakeFiles/DP_Models.dir/models/empty_example/mdp.cpp.o"
+  "CMakeFiles/DP_Models.dir/models/empty_example/mdp.cpp.o.d"
+  "CMakeFiles/DP_Models.dir/models/empty_example/policies.cpp.o"
+  "CMakeFiles/DP_Models.dir/models/empty_example/policies.cpp.o.d"
+  "CMakeFiles/DP_Models.dir/models/exact_test_case/mdp.cpp.o"
+  "CMakeFiles/DP_Models.dir/models/exact_test_case/mdp.cpp.o.d"
+  "CMakeFiles/DP_Models.dir/models/exact_test_case/policies.cpp.o"
+  "CMakeFiles/DP_Models.dir/models/exact_test_case/policies.cpp.o.d"
+  "CMakeFiles/DP_Models.dir/models/lost_sales/mdp.cpp.o"
+  "CMakeFiles/DP_Models.dir/models/lost_sales/mdp.cpp.o.d"
+  "CMakeFiles/DP_Models.dir/models/lost_sales/policies.cpp.o"
+  "CMakeFiles/DP_Models.dir/models/lost_sales/policies.cpp.o.d"
+  "CMakeFiles/DP_Models.dir/models/order_picking/mdp.cpp.o"
+  "CMakeFiles/DP_Models.dir/models/order_picking/mdp.cpp.o.d"
+  "CMakeFiles/DP_Models.dir/models/order_picking/policies.cpp.o"
+  "CMakeFiles/DP_Models.dir/models/order_picking/policies.cpp.o.d"
+  "CMakeFiles/DP_Models.dir/models/order_picking/state.cpp.o"
+  "CMakeFiles/DP_Models.dir/models/order_picking/state.cpp.o.d"
+  "CMakeFiles/DP_Models.dir/models/perishable_systems/mdp.cpp.o"
+  "CMakeFiles/DP_Models.dir/models/perishable_systems/mdp.cpp.o.d"
+  "CMakeFiles/DP_Models.dir/models/perishable_systems/policies.cpp.o"
+  "CMakeFiles/DP_Models.dir/models/perishable_systems/policies.cpp.o.d"
+  "CMakeFiles/DP_Models.dir/models/queue_mdp/batch_sim.cpp.o"
+  "CMakeFiles/DP_Models.dir/models/queue_mdp/batch_sim.cpp.o.d"
+  "CMakeFiles/DP_Models.dir/models/queue_mdp/continuous_sim.cpp.o"
+  "CMakeFiles/DP_Models.dir/models/queue_mdp/continuous_sim.cpp.o.d"
+  "CMakeFiles/DP_Models.dir/models/queue_mdp/kernels.cpp.o"
+  "CMakeFiles/DP_Models.dir/models/queue_mdp/kernels.cpp.o.d"
+  "CMakeFiles/DP_Models.dir/models/queue_mdp/mdp.cpp.o"
+  "CMakeFiles/DP_Models.dir/models/queue_mdp/mdp.cpp.o.d"
+  "CMakeFiles/DP_Models.dir/models/queue_mdp/policies.cpp.o"
+  "CMakeFiles/DP_Models.dir/models/queue_mdp/policies.cpp.o.d"
+  "CMakeFiles/DP_Models.dir/models/queue_mdp/rvi.cpp.o"
+  "CMakeFiles/DP_Models.dir/models/queue_mdp/rvi.cpp.o.d"
+  "CMakeFiles/DP_Models.dir/models/queue_mdp/rvi_cache.cpp.o"
+  "CMakeFiles/DP_Models.dir/models/queue_mdp/rvi_cache.cpp.o.d"
+  "CMakeFiles/DP_Models.dir/models/queue_mdp/rvi_scratch.cpp.o"
+  "CMakeFiles/DP_Models.dir/models/queue_mdp/rvi_scratch.cpp.o.d"
+  "CMakeFiles/DP_Models.dir/models/registrationmanager.cpp.o"
+  "CMakeFiles/DP_Models.dir/models/registrationmanager.cpp.o.d"
+  "CMakeFiles/DP_Models.dir/models/resource_allocation/mdp.cpp.o"
+  "CMakeFiles/DP_Models.dir/models/resource_allocation/mdp.cpp.o.d"
+  "CMakeFiles/DP_Models.dir/models/resource_allocation/policies.cpp.o"
+  "CMakeFiles/DP_Models.dir/models/resource_allocation/policies.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/DP_Models.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,53 @@
+file(REMOVE_RECURSE
+  "/tmp/dp_io/IO_DynaPlex/mdp_config_examples/bin_packing/mdp_config_0.json"
+  "/tmp/dp_io/IO_DynaPlex/mdp_config_examples/collaborative_picking/mdp_config_0.json"
+  "/tmp/dp_io/IO_DynaPlex/mdp_config_examples/collaborative_picking/mdp_config_1.json"
+  "/tmp/dp_io/IO_DynaPlex/mdp_config_examples/collaborative_picking/mdp_config_2.json"
+  "/tmp/dp_io/IO_DynaPlex/mdp_config_examples/collaborative_picking/mdp_config_3.json"
+  "/tmp/dp_io/IO_DynaPlex/mdp_config_examples/collaborative_picking/mdp_config_3_1.json"
+  "/tmp/dp_io/IO_DynaPlex/mdp_config_examples/collaborative_picking/mdp_config_4.json"
+  "/tmp/dp_io/IO_DynaPlex/mdp_config_examples/collaborative_picking/mdp_config_5.json"
+  "/tmp/dp_io/IO_DynaPlex/mdp_config_examples/collaborative_picking/mdp_config_6.json"
+  "/tmp/dp_io/IO_DynaPlex/mdp_config_examples/collaborative_picking/mdp_config_7.json"
+  "/tmp/dp_io/IO_DynaPlex/mdp_config_examples/collaborative_picking/mdp_config_8.json"
+  "/tmp/dp_io/IO_DynaPlex/mdp_config_examples/collaborative_picking/policy_config_0.json"
+  "/tmp/dp_io/IO_DynaPlex/mdp_config_examples/empty_example/mdp_config_0.json"
+  "/tmp/dp_io/IO_DynaPlex/mdp_config_examples/empty_example/policy_config_0.json"
+  "/tmp/dp_io/IO_DynaPlex/mdp_config_examples/exact_test_case/mdp_config_0.json"
+  "/tmp/dp_io/IO_DynaPlex/mdp_config_examples/exact_test_case/policy_config_0.json"
+  "/tmp/dp_io/IO_DynaPlex/mdp_config_examples/lost_sales/mdp_config_0.json"
+  "/tmp/dp_io/IO_DynaPlex/mdp_config_examples/lost_sales/mdp_config_1.json"
+  "/tmp/dp_io/IO_DynaPlex/mdp_config_examples/lost_sales/mdp_config_2.json"
+  "/tmp/dp_io/IO_DynaPlex/mdp_config_examples/lost_sales/policy_config_1.json"
+  "/tmp/dp_io/IO_DynaPlex/mdp_config_examples/order_picking/mdp_config_0.json"
+  "/tmp/dp_io/IO_DynaPlex/mdp_config_examples/order_picking/policy_config_0.json"
+  "/tmp/dp_io/IO_DynaPlex/mdp_config_examples/perishable_systems/mdp_config_0.json"
+  "/tmp/dp_io/IO_DynaPlex/mdp_config_examples/perishable_systems/mdp_config_1.json"
+  "/tmp/dp_io/IO_DynaPlex/mdp_config_examples/perishable_systems/mdp_config_2.json"
+  "/tmp/dp_io/IO_DynaPlex/mdp_config_examples/perishable_systems/policy_config_1.json"
+  "/tmp/dp_io/IO_DynaPlex/mdp_config_examples/queue_mdp/mdp_config_0.json"
+  "/tmp/dp_io/IO_DynaPlex/mdp_config_examples/queue_mdp/mdp_config_1.json"
+  "/tmp/dp_io/IO_DynaPlex/mdp_config_examples/queue_mdp/mdp_config_asym_cost_2s.json"
+  "/tmp/dp_io/IO_DynaPlex/mdp_config_examples/queue_mdp/mdp_config_cand_a4.json"
+  "/tmp/dp_io/IO_DynaPlex/mdp_config_examples/queue_mdp/mdp_config_cand_a6.json"
+  "/tmp/dp_io/IO_DynaPlex/mdp_config_examples/queue_mdp/mdp_config_cand_a_antidue.json"
+  "/tmp/dp_io/IO_DynaPlex/mdp_config_examples/queue_mdp/mdp_config_cand_b_purefrac.json"
+  "/tmp/dp_io/IO_DynaPlex/mdp_config_examples/queue_mdp/mdp_config_cand_c_wnet.json"
+  "/tmp/dp_io/IO_DynaPlex/mdp_config_examples/queue_mdp/mdp_config_cand_d_bottleneck.json"
+  "/tmp/dp_io/IO_DynaPlex/mdp_config_examples/queue_mdp/mdp_config_exp2_specialist_gen.json"
+  "/tmp/dp_io/IO_DynaPlex/mdp_config_examples/queue_mdp/mdp_config_flex_2s.json"
+  "/tmp/dp_io/IO_DynaPlex/mdp_config_examples/queue_mdp/mdp_config_flex_loaded_2s.json"
+  "/tmp/dp_io/IO_DynaPlex/mdp_config_examples/queue_mdp/mdp_config_large_6j5s.json"
+  "/tmp/dp_io/IO_DynaPlex/mdp_config_examples/queue_mdp/mdp_config_simple.json"
+  "/tmp/dp_io/IO_DynaPlex/mdp_config_examples/queue_mdp/mdp_config_simple_asym.json"
+  "/tmp/dp_io/IO_DynaPlex/mdp_config_examples/queue_mdp/policy_config_0.json"
+  "/tmp/dp_io/IO_DynaPlex/mdp_config_examples/resource_allocation/mdp_config_0.json"
+  "/tmp/dp_io/IO_DynaPlex/mdp_config_examples/resource_allocation/mdp_config_1.json"
+  "/tmp/dp_io/IO_DynaPlex/mdp_config_examples/resource_allocation/policy_config_0.json"
+  "CMakeFiles/DP_copy_model_config_files"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/DP_copy_model_config_files.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
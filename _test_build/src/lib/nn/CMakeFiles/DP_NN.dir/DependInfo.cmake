@@ -0,0 +1,26 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/lib/nn/neuralnetworkprovider.cpp" "src/lib/nn/CMakeFiles/DP_NN.dir/neuralnetworkprovider.cpp.o" "gcc" "src/lib/nn/CMakeFiles/DP_NN.dir/neuralnetworkprovider.cpp.o.d"
+  "/root/repo/src/lib/nn/nn_policy.cpp" "src/lib/nn/CMakeFiles/DP_NN.dir/nn_policy.cpp.o" "gcc" "src/lib/nn/CMakeFiles/DP_NN.dir/nn_policy.cpp.o.d"
+  "/root/repo/src/lib/nn/policytrainer.cpp" "src/lib/nn/CMakeFiles/DP_NN.dir/policytrainer.cpp.o" "gcc" "src/lib/nn/CMakeFiles/DP_NN.dir/policytrainer.cpp.o.d"
+  "/root/repo/src/lib/nn/sample.cpp" "src/lib/nn/CMakeFiles/DP_NN.dir/sample.cpp.o" "gcc" "src/lib/nn/CMakeFiles/DP_NN.dir/sample.cpp.o.d"
+  "/root/repo/src/lib/nn/sampledata.cpp" "src/lib/nn/CMakeFiles/DP_NN.dir/sampledata.cpp.o" "gcc" "src/lib/nn/CMakeFiles/DP_NN.dir/sampledata.cpp.o.d"
+  "/root/repo/src/lib/nn/torchavailability.cpp" "src/lib/nn/CMakeFiles/DP_NN.dir/torchavailability.cpp.o" "gcc" "src/lib/nn/CMakeFiles/DP_NN.dir/torchavailability.cpp.o.d"
+  "/root/repo/src/lib/nn/trainedpolicyprovider.cpp" "src/lib/nn/CMakeFiles/DP_NN.dir/trainedpolicyprovider.cpp.o" "gcc" "src/lib/nn/CMakeFiles/DP_NN.dir/trainedpolicyprovider.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_test_build/src/lib/core/CMakeFiles/DP_Core.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,23 @@
+file(REMOVE_RECURSE
+  "../../../lib/libDynaPlex_NN.a"
+  "../../../lib/libDynaPlex_NN.pdb"
+  "CMakeFiles/DP_NN.dir/neuralnetworkprovider.cpp.o"
+  "CMakeFiles/DP_NN.dir/neuralnetworkprovider.cpp.o.d"
+  "CMakeFiles/DP_NN.dir/nn_policy.cpp.o"
+  "CMakeFiles/DP_NN.dir/nn_policy.cpp.o.d"
+  "CMakeFiles/DP_NN.dir/policytrainer.cpp.o"
+  "CMakeFiles/DP_NN.dir/policytrainer.cpp.o.d"
+  "CMakeFiles/DP_NN.dir/sample.cpp.o"
+  "CMakeFiles/DP_NN.dir/sample.cpp.o.d"
+  "CMakeFiles/DP_NN.dir/sampledata.cpp.o"
+  "CMakeFiles/DP_NN.dir/sampledata.cpp.o.d"
+  "CMakeFiles/DP_NN.dir/torchavailability.cpp.o"
+  "CMakeFiles/DP_NN.dir/torchavailability.cpp.o.d"
+  "CMakeFiles/DP_NN.dir/trainedpolicyprovider.cpp.o"
+  "CMakeFiles/DP_NN.dir/trainedpolicyprovider.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/DP_NN.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,22 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/lib/utilities/demonstrator.cpp" "src/lib/utilities/CMakeFiles/DP_Utilities.dir/demonstrator.cpp.o" "gcc" "src/lib/utilities/CMakeFiles/DP_Utilities.dir/demonstrator.cpp.o.d"
+  "/root/repo/src/lib/utilities/policycomparer.cpp" "src/lib/utilities/CMakeFiles/DP_Utilities.dir/policycomparer.cpp.o" "gcc" "src/lib/utilities/CMakeFiles/DP_Utilities.dir/policycomparer.cpp.o.d"
+  "/root/repo/src/lib/utilities/policycomparison.cpp" "src/lib/utilities/CMakeFiles/DP_Utilities.dir/policycomparison.cpp.o" "gcc" "src/lib/utilities/CMakeFiles/DP_Utilities.dir/policycomparison.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_test_build/src/lib/core/CMakeFiles/DP_Core.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "../../../lib/libDynaPlex_Utilities.a"
+  "../../../lib/libDynaPlex_Utilities.pdb"
+  "CMakeFiles/DP_Utilities.dir/demonstrator.cpp.o"
+  "CMakeFiles/DP_Utilities.dir/demonstrator.cpp.o.d"
+  "CMakeFiles/DP_Utilities.dir/policycomparer.cpp.o"
+  "CMakeFiles/DP_Utilities.dir/policycomparer.cpp.o.d"
+  "CMakeFiles/DP_Utilities.dir/policycomparison.cpp.o"
+  "CMakeFiles/DP_Utilities.dir/policycomparison.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/DP_Utilities.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,34 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/tests/mdp_unit_tests/t_bin_packing.cpp" "src/tests/mdp_unit_tests/CMakeFiles/DP_mdp_unit_tests.dir/t_bin_packing.cpp.o" "gcc" "src/tests/mdp_unit_tests/CMakeFiles/DP_mdp_unit_tests.dir/t_bin_packing.cpp.o.d"
+  "/root/repo/src/tests/mdp_unit_tests/t_collaborative_picking.cpp" "src/tests/mdp_unit_tests/CMakeFiles/DP_mdp_unit_tests.dir/t_collaborative_picking.cpp.o" "gcc" "src/tests/mdp_unit_tests/CMakeFiles/DP_mdp_unit_tests.dir/t_collaborative_picking.cpp.o.d"
+  "/root/repo/src/tests/mdp_unit_tests/t_lost_sales.cpp" "src/tests/mdp_unit_tests/CMakeFiles/DP_mdp_unit_tests.dir/t_lost_sales.cpp.o" "gcc" "src/tests/mdp_unit_tests/CMakeFiles/DP_mdp_unit_tests.dir/t_lost_sales.cpp.o.d"
+  "/root/repo/src/tests/mdp_unit_tests/t_order_picking.cpp" "src/tests/mdp_unit_tests/CMakeFiles/DP_mdp_unit_tests.dir/t_order_picking.cpp.o" "gcc" "src/tests/mdp_unit_tests/CMakeFiles/DP_mdp_unit_tests.dir/t_order_picking.cpp.o.d"
+  "/root/repo/src/tests/mdp_unit_tests/t_perishables.cpp" "src/tests/mdp_unit_tests/CMakeFiles/DP_mdp_unit_tests.dir/t_perishables.cpp.o" "gcc" "src/tests/mdp_unit_tests/CMakeFiles/DP_mdp_unit_tests.dir/t_perishables.cpp.o.d"
+  "/root/repo/src/tests/mdp_unit_tests/t_queue_model.cpp" "src/tests/mdp_unit_tests/CMakeFiles/DP_mdp_unit_tests.dir/t_queue_model.cpp.o" "gcc" "src/tests/mdp_unit_tests/CMakeFiles/DP_mdp_unit_tests.dir/t_queue_model.cpp.o.d"
+  "/root/repo/src/tests/mdp_unit_tests/t_resource_allocation.cpp" "src/tests/mdp_unit_tests/CMakeFiles/DP_mdp_unit_tests.dir/t_resource_allocation.cpp.o" "gcc" "src/tests/mdp_unit_tests/CMakeFiles/DP_mdp_unit_tests.dir/t_resource_allocation.cpp.o.d"
+  "/root/repo/src/tests/mdp_unit_tests/testutils.cpp" "src/tests/mdp_unit_tests/CMakeFiles/DP_mdp_unit_tests.dir/testutils.cpp.o" "gcc" "src/tests/mdp_unit_tests/CMakeFiles/DP_mdp_unit_tests.dir/testutils.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_test_build/src/extern/googletest/googletest/CMakeFiles/gtest.dir/DependInfo.cmake"
+  "/root/repo/_test_build/src/extern/googletest/googletest/CMakeFiles/gtest_main.dir/DependInfo.cmake"
+  "/root/repo/_test_build/src/lib/dp/CMakeFiles/DP_DynaPlex.dir/DependInfo.cmake"
+  "/root/repo/_test_build/src/lib/models/CMakeFiles/DP_Models.dir/DependInfo.cmake"
+  "/root/repo/_test_build/src/lib/algorithms/CMakeFiles/DP_Algorithms.dir/DependInfo.cmake"
+  "/root/repo/_test_build/src/lib/nn/CMakeFiles/DP_NN.dir/DependInfo.cmake"
+  "/root/repo/_test_build/src/lib/utilities/CMakeFiles/DP_Utilities.dir/DependInfo.cmake"
+  "/root/repo/_test_build/src/lib/core/CMakeFiles/DP_Core.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
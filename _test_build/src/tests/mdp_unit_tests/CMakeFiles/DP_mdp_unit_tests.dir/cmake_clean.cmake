@@ -0,0 +1,25 @@
+file(REMOVE_RECURSE
+  "../../../bin/DP_mdp_unit_tests"
+  "../../../bin/DP_mdp_unit_tests.pdb"
+  "CMakeFiles/DP_mdp_unit_tests.dir/t_bin_packing.cpp.o"
+  "CMakeFiles/DP_mdp_unit_tests.dir/t_bin_packing.cpp.o.d"
+  "CMakeFiles/DP_mdp_unit_tests.dir/t_collaborative_picking.cpp.o"
+  "CMakeFiles/DP_mdp_unit_tests.dir/t_collaborative_picking.cpp.o.d"
+  "CMakeFiles/DP_mdp_unit_tests.dir/t_lost_sales.cpp.o"
+  "CMakeFiles/DP_mdp_unit_tests.dir/t_lost_sales.cpp.o.d"
+  "CMakeFiles/DP_mdp_unit_tests.dir/t_order_picking.cpp.o"
+  "CMakeFiles/DP_mdp_unit_tests.dir/t_order_picking.cpp.o.d"
+  "CMakeFiles/DP_mdp_unit_tests.dir/t_perishables.cpp.o"
+  "CMakeFiles/DP_mdp_unit_tests.dir/t_perishables.cpp.o.d"
+  "CMakeFiles/DP_mdp_unit_tests.dir/t_queue_model.cpp.o"
+  "CMakeFiles/DP_mdp_unit_tests.dir/t_queue_model.cpp.o.d"
+  "CMakeFiles/DP_mdp_unit_tests.dir/t_resource_allocation.cpp.o"
+  "CMakeFiles/DP_mdp_unit_tests.dir/t_resource_allocation.cpp.o.d"
+  "CMakeFiles/DP_mdp_unit_tests.dir/testutils.cpp.o"
+  "CMakeFiles/DP_mdp_unit_tests.dir/testutils.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/DP_mdp_unit_tests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/DP_new_tests"
+  "../../../bin/DP_new_tests.pdb"
+  "CMakeFiles/DP_new_tests.dir/t_some_test.cpp.o"
+  "CMakeFiles/DP_new_tests.dir/t_some_test.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/DP_new_tests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,50 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/tests/other_unit_tests/basic_components/t_discretedist.cpp" "src/tests/other_unit_tests/CMakeFiles/DP_other_unit_tests.dir/basic_components/t_discretedist.cpp.o" "gcc" "src/tests/other_unit_tests/CMakeFiles/DP_other_unit_tests.dir/basic_components/t_discretedist.cpp.o.d"
+  "/root/repo/src/tests/other_unit_tests/basic_components/t_jointdiscretedist.cpp" "src/tests/other_unit_tests/CMakeFiles/DP_other_unit_tests.dir/basic_components/t_jointdiscretedist.cpp.o" "gcc" "src/tests/other_unit_tests/CMakeFiles/DP_other_unit_tests.dir/basic_components/t_jointdiscretedist.cpp.o.d"
+  "/root/repo/src/tests/other_unit_tests/basic_components/t_matrix.cpp" "src/tests/other_unit_tests/CMakeFiles/DP_other_unit_tests.dir/basic_components/t_matrix.cpp.o" "gcc" "src/tests/other_unit_tests/CMakeFiles/DP_other_unit_tests.dir/basic_components/t_matrix.cpp.o.d"
+  "/root/repo/src/tests/other_unit_tests/basic_components/t_queue.cpp" "src/tests/other_unit_tests/CMakeFiles/DP_other_unit_tests.dir/basic_components/t_queue.cpp.o" "gcc" "src/tests/other_unit_tests/CMakeFiles/DP_other_unit_tests.dir/basic_components/t_queue.cpp.o.d"
+  "/root/repo/src/tests/other_unit_tests/basic_components/t_vargroup.cpp" "src/tests/other_unit_tests/CMakeFiles/DP_other_unit_tests.dir/basic_components/t_vargroup.cpp.o" "gcc" "src/tests/other_unit_tests/CMakeFiles/DP_other_unit_tests.dir/basic_components/t_vargroup.cpp.o.d"
+  "/root/repo/src/tests/other_unit_tests/include/smallclass.cpp" "src/tests/other_unit_tests/CMakeFiles/DP_other_unit_tests.dir/include/smallclass.cpp.o" "gcc" "src/tests/other_unit_tests/CMakeFiles/DP_other_unit_tests.dir/include/smallclass.cpp.o.d"
+  "/root/repo/src/tests/other_unit_tests/include/someclass.cpp" "src/tests/other_unit_tests/CMakeFiles/DP_other_unit_tests.dir/include/someclass.cpp.o" "gcc" "src/tests/other_unit_tests/CMakeFiles/DP_other_unit_tests.dir/include/someclass.cpp.o.d"
+  "/root/repo/src/tests/other_unit_tests/t_dcl.cpp" "src/tests/other_unit_tests/CMakeFiles/DP_other_unit_tests.dir/t_dcl.cpp.o" "gcc" "src/tests/other_unit_tests/CMakeFiles/DP_other_unit_tests.dir/t_dcl.cpp.o.d"
+  "/root/repo/src/tests/other_unit_tests/t_demonstrator.cpp" "src/tests/other_unit_tests/CMakeFiles/DP_other_unit_tests.dir/t_demonstrator.cpp.o" "gcc" "src/tests/other_unit_tests/CMakeFiles/DP_other_unit_tests.dir/t_demonstrator.cpp.o.d"
+  "/root/repo/src/tests/other_unit_tests/t_eventheap.cpp" "src/tests/other_unit_tests/CMakeFiles/DP_other_unit_tests.dir/t_eventheap.cpp.o" "gcc" "src/tests/other_unit_tests/CMakeFiles/DP_other_unit_tests.dir/t_eventheap.cpp.o.d"
+  "/root/repo/src/tests/other_unit_tests/t_exact_solver_tests.cpp" "src/tests/other_unit_tests/CMakeFiles/DP_other_unit_tests.dir/t_exact_solver_tests.cpp.o" "gcc" "src/tests/other_unit_tests/CMakeFiles/DP_other_unit_tests.dir/t_exact_solver_tests.cpp.o.d"
+  "/root/repo/src/tests/other_unit_tests/t_features.cpp" "src/tests/other_unit_tests/CMakeFiles/DP_other_unit_tests.dir/t_features.cpp.o" "gcc" "src/tests/other_unit_tests/CMakeFiles/DP_other_unit_tests.dir/t_features.cpp.o.d"
+  "/root/repo/src/tests/other_unit_tests/t_graph.cpp" "src/tests/other_unit_tests/CMakeFiles/DP_other_unit_tests.dir/t_graph.cpp.o" "gcc" "src/tests/other_unit_tests/CMakeFiles/DP_other_unit_tests.dir/t_graph.cpp.o.d"
+  "/root/repo/src/tests/other_unit_tests/t_idcontainer.cpp" "src/tests/other_unit_tests/CMakeFiles/DP_other_unit_tests.dir/t_idcontainer.cpp.o" "gcc" "src/tests/other_unit_tests/CMakeFiles/DP_other_unit_tests.dir/t_idcontainer.cpp.o.d"
+  "/root/repo/src/tests/other_unit_tests/t_initiateclasswithvargroup.cpp" "src/tests/other_unit_tests/CMakeFiles/DP_other_unit_tests.dir/t_initiateclasswithvargroup.cpp.o" "gcc" "src/tests/other_unit_tests/CMakeFiles/DP_other_unit_tests.dir/t_initiateclasswithvargroup.cpp.o.d"
+  "/root/repo/src/tests/other_unit_tests/t_mdp_actions.cpp" "src/tests/other_unit_tests/CMakeFiles/DP_other_unit_tests.dir/t_mdp_actions.cpp.o" "gcc" "src/tests/other_unit_tests/CMakeFiles/DP_other_unit_tests.dir/t_mdp_actions.cpp.o.d"
+  "/root/repo/src/tests/other_unit_tests/t_model_provider.cpp" "src/tests/other_unit_tests/CMakeFiles/DP_other_unit_tests.dir/t_model_provider.cpp.o" "gcc" "src/tests/other_unit_tests/CMakeFiles/DP_other_unit_tests.dir/t_model_provider.cpp.o.d"
+  "/root/repo/src/tests/other_unit_tests/t_policycomparer.cpp" "src/tests/other_unit_tests/CMakeFiles/DP_other_unit_tests.dir/t_policycomparer.cpp.o" "gcc" "src/tests/other_unit_tests/CMakeFiles/DP_other_unit_tests.dir/t_policycomparer.cpp.o.d"
+  "/root/repo/src/tests/other_unit_tests/t_pytorch.cpp" "src/tests/other_unit_tests/CMakeFiles/DP_other_unit_tests.dir/t_pytorch.cpp.o" "gcc" "src/tests/other_unit_tests/CMakeFiles/DP_other_unit_tests.dir/t_pytorch.cpp.o.d"
+  "/root/repo/src/tests/other_unit_tests/t_rngprovider.cpp" "src/tests/other_unit_tests/CMakeFiles/DP_other_unit_tests.dir/t_rngprovider.cpp.o" "gcc" "src/tests/other_unit_tests/CMakeFiles/DP_other_unit_tests.dir/t_rngprovider.cpp.o.d"
+  "/root/repo/src/tests/other_unit_tests/t_sampledata.cpp" "src/tests/other_unit_tests/CMakeFiles/DP_other_unit_tests.dir/t_sampledata.cpp.o" "gcc" "src/tests/other_unit_tests/CMakeFiles/DP_other_unit_tests.dir/t_sampledata.cpp.o.d"
+  "/root/repo/src/tests/other_unit_tests/t_state_retrieval.cpp" "src/tests/other_unit_tests/CMakeFiles/DP_other_unit_tests.dir/t_state_retrieval.cpp.o" "gcc" "src/tests/other_unit_tests/CMakeFiles/DP_other_unit_tests.dir/t_state_retrieval.cpp.o.d"
+  "/root/repo/src/tests/other_unit_tests/t_statecategory.cpp" "src/tests/other_unit_tests/CMakeFiles/DP_other_unit_tests.dir/t_statecategory.cpp.o" "gcc" "src/tests/other_unit_tests/CMakeFiles/DP_other_unit_tests.dir/t_statecategory.cpp.o.d"
+  "/root/repo/src/tests/other_unit_tests/t_vargroup_dict.cpp" "src/tests/other_unit_tests/CMakeFiles/DP_other_unit_tests.dir/t_vargroup_dict.cpp.o" "gcc" "src/tests/other_unit_tests/CMakeFiles/DP_other_unit_tests.dir/t_vargroup_dict.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_test_build/src/extern/googletest/googletest/CMakeFiles/gtest.dir/DependInfo.cmake"
+  "/root/repo/_test_build/src/extern/googletest/googletest/CMakeFiles/gtest_main.dir/DependInfo.cmake"
+  "/root/repo/_test_build/src/lib/dp/CMakeFiles/DP_DynaPlex.dir/DependInfo.cmake"
+  "/root/repo/_test_build/src/lib/nn/CMakeFiles/DP_NN.dir/DependInfo.cmake"
+  "/root/repo/_test_build/src/lib/models/CMakeFiles/DP_Models.dir/DependInfo.cmake"
+  "/root/repo/_test_build/src/lib/algorithms/CMakeFiles/DP_Algorithms.dir/DependInfo.cmake"
+  "/root/repo/_test_build/src/lib/utilities/CMakeFiles/DP_Utilities.dir/DependInfo.cmake"
+  "/root/repo/_test_build/src/lib/core/CMakeFiles/DP_Core.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,57 @@
+file(REMOVE_RECURSE
+  "../../../bin/DP_other_unit_tests"
+  "../../../bin/DP_other_unit_tests.pdb"
+  "CMakeFiles/DP_other_unit_tests.dir/basic_components/t_discretedist.cpp.o"
+  "CMakeFiles/DP_other_unit_tests.dir/basic_components/t_discretedist.cpp.o.d"
+  "CMakeFiles/DP_other_unit_tests.dir/basic_components/t_jointdiscretedist.cpp.o"
+  "CMakeFiles/DP_other_unit_tests.dir/basic_components/t_jointdiscretedist.cpp.o.d"
+  "CMakeFiles/DP_other_unit_tests.dir/basic_components/t_matrix.cpp.o"
+  "CMakeFiles/DP_other_unit_tests.dir/basic_components/t_matrix.cpp.o.d"
+  "CMakeFiles/DP_other_unit_tests.dir/basic_components/t_queue.cpp.o"
+  "CMakeFiles/DP_other_unit_tests.dir/basic_components/t_queue.cpp.o.d"
+  "CMakeFiles/DP_other_unit_tests.dir/basic_components/t_vargroup.cpp.o"
+  "CMakeFiles/DP_other_unit_tests.dir/basic_components/t_vargroup.cpp.o.d"
+  "CMakeFiles/DP_other_unit_tests.dir/include/smallclass.cpp.o"
+  "CMakeFiles/DP_other_unit_tests.dir/include/smallclass.cpp.o.d"
+  "CMakeFiles/DP_other_unit_tests.dir/include/someclass.cpp.o"
+  "CMakeFiles/DP_other_unit_tests.dir/include/someclass.cpp.o.d"
+  "CMakeFiles/DP_other_unit_tests.dir/t_dcl.cpp.o"
+  "CMakeFiles/DP_other_unit_tests.dir/t_dcl.cpp.o.d"
+  "CMakeFiles/DP_other_unit_tests.dir/t_demonstrator.cpp.o"
+  "CMakeFiles/DP_other_unit_tests.dir/t_demonstrator.cpp.o.d"
+  "CMakeFiles/DP_other_unit_tests.dir/t_eventheap.cpp.o"
+  "CMakeFiles/DP_other_unit_tests.dir/t_eventheap.cpp.o.d"
+  "CMakeFiles/DP_other_unit_tests.dir/t_exact_solver_tests.cpp.o"
+  "CMakeFiles/DP_other_unit_tests.dir/t_exact_solver_tests.cpp.o.d"
+  "CMakeFiles/DP_other_unit_tests.dir/t_features.cpp.o"
+  "CMakeFiles/DP_other_unit_tests.dir/t_features.cpp.o.d"
+  "CMakeFiles/DP_other_unit_tests.dir/t_graph.cpp.o"
+  "CMakeFiles/DP_other_unit_tests.dir/t_graph.cpp.o.d"
+  "CMakeFiles/DP_other_unit_tests.dir/t_idcontainer.cpp.o"
+  "CMakeFiles/DP_other_unit_tests.dir/t_idcontainer.cpp.o.d"
+  "CMakeFiles/DP_other_unit_tests.dir/t_initiateclasswithvargroup.cpp.o"
+  "CMakeFiles/DP_other_unit_tests.dir/t_initiateclasswithvargroup.cpp.o.d"
+  "CMakeFiles/DP_other_unit_tests.dir/t_mdp_actions.cpp.o"
+  "CMakeFiles/DP_other_unit_tests.dir/t_mdp_actions.cpp.o.d"
+  "CMakeFiles/DP_other_unit_tests.dir/t_model_provider.cpp.o"
+  "CMakeFiles/DP_other_unit_tests.dir/t_model_provider.cpp.o.d"
+  "CMakeFiles/DP_other_unit_tests.dir/t_policycomparer.cpp.o"
+  "CMakeFiles/DP_other_unit_tests.dir/t_policycomparer.cpp.o.d"
+  "CMakeFiles/DP_other_unit_tests.dir/t_pytorch.cpp.o"
+  "CMakeFiles/DP_other_unit_tests.dir/t_pytorch.cpp.o.d"
+  "CMakeFiles/DP_other_unit_tests.dir/t_rngprovider.cpp.o"
+  "CMakeFiles/DP_other_unit_tests.dir/t_rngprovider.cpp.o.d"
+  "CMakeFiles/DP_other_unit_tests.dir/t_sampledata.cpp.o"
+  "CMakeFiles/DP_other_unit_tests.dir/t_sampledata.cpp.o.d"
+  "CMakeFiles/DP_other_unit_tests.dir/t_state_retrieval.cpp.o"
+  "CMakeFiles/DP_other_unit_tests.dir/t_state_retrieval.cpp.o.d"
+  "CMakeFiles/DP_other_unit_tests.dir/t_statecategory.cpp.o"
+  "CMakeFiles/DP_other_unit_tests.dir/t_statecategory.cpp.o.d"
+  "CMakeFiles/DP_other_unit_tests.dir/t_vargroup_dict.cpp.o"
+  "CMakeFiles/DP_other_unit_tests.dir/t_vargroup_dict.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/DP_other_unit_tests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/src/tests/other_unit_tests
+# Build directory: /root/repo/_test_build/src/tests/other_unit_tests
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test([=[DP_other_unit_tests]=] "/root/repo/_test_build/bin/DP_other_unit_tests")
+set_tests_properties([=[DP_other_unit_tests]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/src/tests/other_unit_tests/CMakeLists.txt;15;add_test;/root/repo/src/tests/other_unit_tests/CMakeLists.txt;0;")
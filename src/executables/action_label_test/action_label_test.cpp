@@ -46,8 +46,8 @@ static void CHECK(bool cond, const std::string& msg)
     }
 }
 
-static void print_queue(const std::deque<MDP::Action>& q,
-                        const std::vector<int64_t>&   FIL,
+static void print_queue(const MDP::ActionQueue& q,
+                        const MDP::FILVector&         FIL,
                         const std::vector<double>&     cost_rates,
                         const std::vector<MDP::ServerStaticInfo>& si)
 {
@@ -92,8 +92,9 @@ static MDP::State make_state(const MDP& mdp,
     for (size_t k = 0; k < busy_counts.size() && k < s.server_manager.busy_on.size(); ++k)
         for (size_t j = 0; j < busy_counts[k].size() && j < s.server_manager.busy_on[k].size(); ++j)
             s.server_manager.busy_on[k][j] = busy_counts[k][j];
+    s.server_manager.update_total_service_rate();
 
-    s.server_manager.generate_actions(s.queue_manager.get_FIL_waiting(), mdp.cost_rates);
+    s.server_manager.generate_actions(s.queue_manager.get_FIL_waiting());
     s.server_manager.set_action_counter(0);
     s.cat = s.server_manager.action_queue.empty()
           ? DynaPlex::StateCategory::AwaitEvent()
@@ -273,11 +273,13 @@ static void run_stoch_fifo_experiment(
         if (use_rel_tol)
             rvi_cfg = VarGroup{{"id",     std::string("RVI_optimal")},
                                {"rel_tol", 0.01},
-                               {"silent",  int64_t(1)}};
+                               {"silent",  int64_t(1)},
+                               {"cache_dir", dp.FilePath({"rvi_cache"}, "")}};
         else
             rvi_cfg = VarGroup{{"id",    std::string("RVI_optimal")},
                                {"M",      rvi_M_fixed},
-                               {"silent", int64_t(1)}};
+                               {"silent", int64_t(1)},
+                               {"cache_dir", dp.FilePath({"rvi_cache"}, "")}};
         auto rvi = mdp->GetPolicy(rvi_cfg);
 
         auto bench = comparer.Compare({fifo, rvi});
@@ -551,10 +553,10 @@ static void run_config_experiment(
     VarGroup rvi_cfg;
     if (use_rel_tol)
         rvi_cfg = VarGroup{{"id", std::string("RVI_optimal")}, {"rel_tol", 0.01},
-                           {"silent", int64_t(1)}};
+                           {"silent", int64_t(1)}, {"cache_dir", dp.FilePath({"rvi_cache"}, "")}};
     else
         rvi_cfg = VarGroup{{"id", std::string("RVI_optimal")}, {"M", rvi_M_fixed},
-                           {"silent", int64_t(1)}};
+                           {"silent", int64_t(1)}, {"cache_dir", dp.FilePath({"rvi_cache"}, "")}};
     auto rvi = mdp->GetPolicy(rvi_cfg);
 
     VarGroup nn_arch;
@@ -693,6 +695,7 @@ int main()
             rvi_cfg.Add("id",      std::string("RVI_optimal"));
             rvi_cfg.Add("rel_tol", 0.01);
             rvi_cfg.Add("silent",  int64_t(1));
+            rvi_cfg.Add("cache_dir", dp.FilePath({"rvi_cache"}, ""));
             auto rvi = mdp->GetPolicy(rvi_cfg);
 
             VarGroup dcl_cfg;
@@ -786,6 +789,7 @@ int main()
             rvi_cfg.Add("id",      std::string("RVI_optimal"));
             rvi_cfg.Add("rel_tol", 0.01);
             rvi_cfg.Add("silent",  int64_t(1));
+            rvi_cfg.Add("cache_dir", dp.FilePath({"rvi_cache"}, ""));
             auto rvi = mdp->GetPolicy(rvi_cfg);
 
             VarGroup dcl_cfg;
@@ -957,6 +961,7 @@ int main()
             grvi_cfg.Add("id",      std::string("RVI_optimal"));
             grvi_cfg.Add("silent",  int64_t(1));
             grvi_cfg.Add("rel_tol", 0.01);
+            grvi_cfg.Add("cache_dir", dp.FilePath({"rvi_cache"}, ""));
             auto grvi = gmdp->GetPolicy(grvi_cfg);
 
             auto gres = gcomp.Compare({gfifo, grvi});
@@ -288,7 +288,8 @@ int main(int argc, char** argv)
         // tardiness flux) where the auto-loop's between-M criterion stops early.
         // Otherwise rvi_tol drives the auto-select loop (default 0.01; too loose
         // for tail-heavy rewards, whose g* keeps drifting with FIL depth).
-        VarGroup rvi_cfg{{"id", std::string("RVI_optimal")}, {"silent", int64_t(1)}};
+        VarGroup rvi_cfg{{"id", std::string("RVI_optimal")}, {"silent", int64_t(1)},
+                         {"cache_dir", dp.FilePath({"rvi_cache"}, "")}};
         if (I("rvi_m", 0) > 0) rvi_cfg.Add("M", I("rvi_m", 0));
         else                   rvi_cfg.Add("rel_tol", D("rvi_tol", 0.01));
         auto rvi = mdp->GetPolicy(rvi_cfg);
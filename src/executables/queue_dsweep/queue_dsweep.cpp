@@ -107,7 +107,8 @@ int main(int argc, char** argv) {
         VarGroup ec; ec.Add("number_of_trajectories",EVAL_TRAJ); ec.Add("periods_per_trajectory",EVAL_PERIODS);
         auto comparer = dp.GetPolicyComparer(mdp, ec);
         auto fifo = mdp->GetPolicy("FIFO policy");
-        VarGroup rc{{"id",std::string("RVI_optimal")},{"rel_tol",0.01},{"silent",int64_t(1)}};
+        VarGroup rc{{"id",std::string("RVI_optimal")},{"rel_tol",0.01},{"silent",int64_t(1)},
+                    {"cache_dir",dp.FilePath({"rvi_cache"},"")}};
         auto rvi = mdp->GetPolicy(rc);
         auto b = comparer.Compare({fifo,rvi}); double fm=0,rm=0; b[0].Get("mean",fm); b[1].Get("mean",rm);
         cache.emplace(key, Bench{mdp, comparer, fm, rm, Lambda});
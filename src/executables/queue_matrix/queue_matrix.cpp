@@ -155,7 +155,8 @@ int main(int argc, char** argv) {
         eval_cfg.Add("periods_per_trajectory",  EVAL_PERIODS);
         auto comparer = dp.GetPolicyComparer(mdp, eval_cfg);
         auto fifo = mdp->GetPolicy("FIFO policy");
-        VarGroup rvi_cfg{{"id", std::string("RVI_optimal")},{"rel_tol",0.01},{"silent",int64_t(1)}};
+        VarGroup rvi_cfg{{"id", std::string("RVI_optimal")},{"rel_tol",0.01},{"silent",int64_t(1)},
+                         {"cache_dir", dp.FilePath({"rvi_cache"}, "")}};
         auto rvi = mdp->GetPolicy(rvi_cfg);
         auto b = comparer.Compare({fifo, rvi});
         double fm=0, rm=0; b[0].Get("mean",fm); b[1].Get("mean",rm);
@@ -245,6 +245,7 @@ int main() {
 						rem         /= (uint64_t)base;
 						s.server_manager.busy_on[k][j] = v;
 					}
+				s.server_manager.update_total_service_rate();
 
 				// state category
 				int64_t cat_val = (int64_t)(rem % 2); rem /= 2;
@@ -752,6 +753,7 @@ int main() {
 					// State: both queues empty (FIL=-1), server busy on job type j only
 					auto s = mdp8.GetInitialState();   // FIL=[-1,-1], busy=[[0,0]]
 					s.server_manager.busy_on[0][(size_t)j] = 1;
+					s.server_manager.update_total_service_rate();
 					s.server_manager.generate_actions(s.queue_manager.get_FIL_waiting());
 					s.cat = DynaPlex::StateCategory::AwaitEvent();
 
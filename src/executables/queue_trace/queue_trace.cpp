@@ -263,8 +263,8 @@ static void RunT1()
 static void RunT2()
 {
     std::cout << "\n========== T2: FIFO BFS-model trace (30 steps) ==========\n";
-    std::cout << "  NOTE: uses getNextStateProbability -- this is the FIL-projected BFS model\n"
-              << "        that RVI is trained on.  Depth=2 BFS never accumulates SIL.\n";
+    std::cout << "  NOTE: uses getNextStateProbability -- this is the BFS model RVI solves.\n"
+              << "        At depth=2 it tracks the SIL: serving the FIL shifts the SIL up.\n";
 
     for (int depth : {1, 2}) {
         std::cout << "\n  --- depth=" << depth << " ---\n";
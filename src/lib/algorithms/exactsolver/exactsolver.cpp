@@ -1,6 +1,9 @@
 #include "dynaplex/exactsolver.h"
 #include "dynaplex/error.h"
-#include <forward_list>
+#include "dynaplex/parallel_execute.h"
+#include "statestore.h"
+#include <algorithm>
+#include <limits>
 
 namespace DynaPlex::Algorithms {
 	class ExactSolver::Impl {
@@ -12,16 +15,20 @@ namespace DynaPlex::Algorithms {
 		bool exact_policy_computed{ false };
 		bool exact_policy_exported{ false };
 		bool statemap_created{ false };
+		//release the state objects once the last transitions are determined, see DropStates.
+		bool drop_states;
+		bool states_dropped{ false };
 		int64_t num_sample_states;
 		double epsilon; 
 		//for numerical stability of hybrid iteration algorithm when discountfactor = 1, 
 		//we need to add self-transitions to avoid periodicity. 
 		static constexpr double self_transition_prob = 0.02;
 		Impl(const System& sys, DynaPlex::MDP mdp, const DynaPlex::VarGroup& conf)
-			: system(sys), mdp(mdp), hasher{}, statemap{}, action_states{} {
+			: system(sys), mdp(mdp), store{}, states{} {
 			conf.GetOrDefault("epsilon", epsilon, 0.0001);
 			conf.GetOrDefault("silent", silent, false);
 			conf.GetOrDefault("num_sample_states", num_sample_states, 10);
+			conf.GetOrDefault("drop_states", drop_states, false);
 			if (!mdp->ProvidesEventProbs()) {
 				throw DynaPlex::Error("ExactSolver: MDP does not provide event probabilities. Note that exact algorithms need event probabilities.");
 			}
@@ -46,137 +53,112 @@ namespace DynaPlex::Algorithms {
 			}		
 
 			conf.GetOrDefault("max_states", max_states, 1048576);
-		
+			num_features = (size_t)mdp->NumFlatFeatures();
+			store.Reset(num_features, (size_t)std::max<int64_t>(max_states, 0));
+			int64_t threads;
+			conf.GetOrDefault("num_threads", threads, (int64_t)std::max<uint32_t>(1, system.HardwareThreads()));
+			if (threads < 1)
+				throw DynaPlex::Error("ExactSolver: num_threads (=" + std::to_string(threads) + ") must be at least 1.");
+			num_threads = (size_t)threads;
 		}
-		std::hash<float> hasher;
-		//helper object that will be reused, to avoid very frequent memory allocations;
-		static thread_local std::vector<float> feats_holder, feats_holder2;
 		//helper object that will be reused, to avoid very frequent memory allocations;
+		static thread_local std::vector<float> feats_holder;
+		//helper objects used while creating the state map; the parallel phases use their own. 
 		std::vector<std::tuple<double, DynaPlex::dp_State>> transitions_holder;
-		//helper object that will be reused, to avoid very frequent memory allocations;
 		std::vector<DynaPlex::Trajectory> trajectories;
 
 		int64_t max_states;
-
-
-		bool StatesAreEqual(const DynaPlex::dp_State& state, const DynaPlex::dp_State& state2)
-		{
-			//could have relied on mdp->StatesAreEqual here, but that would require humans to implement
-			//state equality, which sometimes causes issues. Since we need a hash anyhow, and thus some features,
-			//this seems easier. 
-			mdp->GetFlatFeatures(state, feats_holder);
-			mdp->GetFlatFeatures(state2, feats_holder2);
-			//states are considered equal if their features are equal. 
-			return feats_holder == feats_holder2;
-		}
-
-		size_t GetHash(const DynaPlex::dp_State& state) {
-			mdp->GetFlatFeatures(state, feats_holder);
-			size_t hash_key = 0;
-			for (const float& f : feats_holder) {
-				hash_key ^= hasher(f) + 0x9e3779b9 + (hash_key << 6) + (hash_key >> 2);
+		size_t num_features;
+		size_t num_threads;
+		//below this many states per thread, starting threads costs more than it saves. 
+		static constexpr size_t min_states_per_thread = 2048;
+
+		/// Calls work(begin, end, part) for consecutive ranges of states that cover [0, total), on up 
+		/// to num_threads threads; part < num_threads numbers the ranges in order. Per-part results that 
+		/// are combined in part order do not depend on the number of threads. 
+		template<typename Work>
+		void ParallelOverStates(size_t total, const Work& work) {
+			size_t threads = std::min(num_threads, total / min_states_per_thread);
+			if (threads <= 1) {
+				work(size_t{ 0 }, total, size_t{ 0 });
+				return;
 			}
-			return hash_key;
+			auto ranges = DynaPlex::Parallel::get_splits(total, threads);
+			DynaPlex::Parallel::parallel_compute<std::tuple<int64_t, int64_t>>(ranges,
+				[&work](std::span<std::tuple<int64_t, int64_t>> span, int64_t start) {
+					for (size_t k = 0; k < span.size(); k++) {
+						auto [begin, end] = span[k];
+						work((size_t)begin, (size_t)end, (size_t)start + k);
+					}
+				}, (int64_t)threads);
 		}
 
-		struct LookupValue {
-			size_t state_index;
-			double value;
-			LookupValue(size_t state_index) : state_index{ state_index }, value{ 0.0 } {
-
-			}
-		};
-
-		struct Transition {
-			double probability;
-			LookupValue* values;
-		};
-
-		struct StateStorage {
-			DynaPlex::dp_State state;
-			int64_t current_action;
-			double new_value;
-			//expected costs per period
-			double costs_until_transition;
-			std::vector<Transition> transitions;
-			StateStorage(DynaPlex::dp_State&& state):
-				state{ std::move(state) }, current_action{ 0 }, new_value{ 0.0 }
-			{
-
-			}
-		};
-
 		//key data structures:
-		std::unordered_map<size_t, std::forward_list<LookupValue>> statemap;
-		std::vector<StateStorage> action_states;
-		//to keep count of any hash collisions 
-		size_t hash_collisions;
+		StateStore store;
+		//per action state, by index in store. The state objects are only needed to determine
+		//transitions and actions, and may be dropped afterwards (see DropStates). 
+		std::vector<DynaPlex::dp_State> states;
+		std::vector<int64_t> current_action;
+		std::vector<double> value, new_value;
+		//expected costs per period
+		std::vector<double> costs_until_transition;
+		//transitions under current_action: state i moves to action state next_state[e] with
+		//probability[e], for e in [transition_begin[i], transition_begin[i+1]).
+		std::vector<size_t> transition_begin;
+		std::vector<uint32_t> next_state;
+		std::vector<double> probability;
 		size_t LastReportedTotalStates;
-	
-		LookupValue& GetStateValue(const DynaPlex::dp_State& state) {
-			auto hash = GetHash(state);
-			auto iter = statemap.find(hash);
-			if (iter == statemap.end()) {
+
+		/// writes the features that identify state into feats_holder, and returns them.
+		const float* Features(const DynaPlex::dp_State& state) {
+			feats_holder.resize(num_features);
+			mdp->GetFlatFeatures(state, feats_holder);
+			return feats_holder.data();
+		}
+
+		size_t GetStateIndex(const DynaPlex::dp_State& state) {
+			size_t index = store.Find(Features(state));
+			if (index == StateStore::npos) {
 				auto cat = mdp->GetStateCategory(state);
 				if (!cat.IsAwaitAction())
 					throw DynaPlex::Error("Attempting to get state value for non-action state.");
-				throw DynaPlex::Error("Hash key not found in statemap.");
-			}
-			auto& list = iter->second;
-			auto it = list.begin();
-			auto next_it = it;
-			// If there is only one element, return it without comparison.
-			if (++next_it == list.end())
-				return *it;
-
-			// If there are multiple elements, find the correct one by comparing state equality.
-			for (auto& lookup : list) {
-				if (StatesAreEqual(state, action_states[lookup.state_index].state)) {
-					return lookup;
-				}
+				throw DynaPlex::Error("State expected to be found but was not. ");
 			}
-			throw DynaPlex::Error("State expected to be found but was not. ");
+			return index;
 		}
 		
 		//Checks if state is allready added to list, and adds to list if not present. 
 		void AddState(DynaPlex::dp_State& state) {
-			auto hash = GetHash(state);
-			bool found = false;
-			if (statemap.contains(hash)) {
-				for (const auto& idx_and_value : statemap[hash]) {
-					if (StatesAreEqual(state, action_states[idx_and_value.state_index].state)) {
-						found = true;
-						break;
-					}
-				}
-				//if the hash was found but the state was not, then we encountered a collision. 
-				if (!found)
-					hash_collisions++;
-			}
-			if (!found) {
-				if (action_states.size() >= max_states)
-				{
-					std::string message = "ExactSolver: Number of action states in mdp exceeds option max_states (=";
-					message += std::to_string(max_states); message += "). It may not be feasible to solve this MDP exactly. Consider adapting the max_states option.\n Some sample states:\n";
-					for (int64_t i = 0; i < num_sample_states; i++)
-					{
-						message += action_states.at(i*action_states.size()/ num_sample_states).state->ToVarGroup().Dump()+ "\n";
-					}
-					throw DynaPlex::Error(message);
-				}
-				if (action_states.size() > LastReportedTotalStates)
+			const float* feats = Features(state);
+			if (store.Find(feats) != StateStore::npos)
+				return;
+			if (store.size() >= max_states)
+			{
+				std::string message = "ExactSolver: Number of action states in mdp exceeds option max_states (=";
+				message += std::to_string(max_states); message += "). It may not be feasible to solve this MDP exactly. Consider adapting the max_states option.\n Some sample states:\n";
+				for (int64_t i = 0; i < num_sample_states; i++)
 				{
-					if (!silent)
-						system << LastReportedTotalStates << "  " << std::flush;
-					LastReportedTotalStates *= 2;
-
+					message += states.at(i*states.size()/ num_sample_states)->ToVarGroup().Dump()+ "\n";
 				}
+				throw DynaPlex::Error(message);
+			}
+			if (store.size() > LastReportedTotalStates)
+			{
+				if (!silent)
+					system << LastReportedTotalStates << "  " << std::flush;
+				LastReportedTotalStates *= 2;
 
-				statemap[hash].emplace_front(action_states.size());
-				action_states.push_back(std::move(state));
 			}
+			store.Add(feats);
+			states.push_back(std::move(state));
 		}	
 
+		/// Releases the state objects; afterwards, only the stored features identify states. 
+		void DropStates() {
+			std::vector<DynaPlex::dp_State>().swap(states);
+			states_dropped = true;
+		}
+
 		///Processes this state - Adds to list if action state (for later expansion), or expand immediately
 		///if event state. 
 		void ProcessState(DynaPlex::dp_State& state, size_t depth = 0)
@@ -220,7 +202,7 @@ namespace DynaPlex::Algorithms {
 			}
 		}
 
-		//This sets actions in the action_states following the policy. 
+		//This sets current_action for all states following the policy. 
 		void SetActions(DynaPlex::Policy policy)
 		{
 			Policy pol;
@@ -230,94 +212,119 @@ namespace DynaPlex::Algorithms {
 				pol = mdp->GetPolicy("greedy");
 			DynaPlex::Trajectory traj{};
 			traj.RNGProvider.SeedEventStreams(false);
-			for (StateStorage& storage : action_states)
+			current_action.resize(states.size());
+			for (size_t i = 0; i < states.size(); i++)
 			{
-				mdp->InitiateState({ &traj,1 }, storage.state);
+				mdp->InitiateState({ &traj,1 }, states[i]);
 				pol->SetAction({ &traj,1 });
-				storage.current_action = traj.NextAction;
+				current_action[i] = traj.NextAction;
 				if (!mdp->IsAllowedAction(traj.GetState(), traj.NextAction))
 					throw DynaPlex::Error("Illegal action proposed by policy.");
 			}
 		}
 		//This populates/determines the transitions and costs for the actions currently set 
-		//in the action_states vector. 
+		//in the current_action array. 
 		void DetermineTransitions()
 		{
-			for (StateStorage& storage : action_states)
-			{
-				trajectories.clear();
-				//create a new trajectory
-				trajectories.emplace_back();
-				mdp->InitiateState(trajectories, storage.state);
-				trajectories[0].NextAction = storage.current_action;
-				mdp->IncorporateAction(trajectories);
-				if (trajectories[0].Category.IsAwaitEvent() && trajectories[0].Category.Index() == 0)
+			if (states_dropped)
+				throw DynaPlex::Error("ExactSolver: states were dropped (option drop_states) after transitions were determined; cannot determine transitions again.");
+			costs_until_transition.resize(states.size());
+			//transition_begin[i+1] first holds the number of transitions of state i. 
+			transition_begin.assign(states.size() + 1, 0);
+			std::vector<std::vector<uint32_t>> part_next(num_threads);
+			std::vector<std::vector<double>> part_probability(num_threads);
+			ParallelOverStates(states.size(), [&](size_t begin, size_t end, size_t part) {
+				auto& next = part_next[part];
+				auto& prob_of_next = part_probability[part];
+				std::vector<DynaPlex::Trajectory> trajectories;
+				std::vector<std::tuple<double, DynaPlex::dp_State>> transitions_holder;
+				for (size_t i = begin; i < end; i++)
 				{
-					transitions_holder.clear();
-					double expected_costs = 
-						mdp->GetAllEventTransitions(trajectories[0].GetState(), transitions_holder);
-					storage.transitions.reserve(transitions_holder.size());
-					storage.transitions.clear();
-					for(auto& [prob,state] :transitions_holder)
+					size_t num_before = next.size();
+					trajectories.clear();
+					//create a new trajectory
+					trajectories.emplace_back();
+					mdp->InitiateState(trajectories, states[i]);
+					trajectories[0].NextAction = current_action[i];
+					mdp->IncorporateAction(trajectories);
+					if (trajectories[0].Category.IsAwaitEvent() && trajectories[0].Category.Index() == 0)
 					{
-						auto cat = mdp->GetStateCategory(state);
-						if (cat.IsAwaitAction())
-						{
-							auto& value = GetStateValue(state);
-							storage.transitions.emplace_back(prob, &value);
-						}
-						else
+						transitions_holder.clear();
+						double expected_costs = 
+							mdp->GetAllEventTransitions(trajectories[0].GetState(), transitions_holder);
+						for(auto& [prob,state] :transitions_holder)
 						{
-							if (cat.IsAwaitEvent())
-								throw DynaPlex::Error("Events after events - this is not currently supported.");
+							auto cat = mdp->GetStateCategory(state);
+							if (cat.IsAwaitAction())
+							{
+								next.push_back((uint32_t)GetStateIndex(state));
+								prob_of_next.push_back(prob);
+							}
+							else
+							{
+								if (cat.IsAwaitEvent())
+									throw DynaPlex::Error("Events after events - this is not currently supported.");
+							}
 						}
-					}
-					storage.costs_until_transition =mdp->DiscountFactor()*	expected_costs + trajectories[0].CumulativeReturn;
-				}
-				else
-				{
-					if (trajectories[0].Category.IsAwaitAction())
-					{
-						auto& value = GetStateValue(trajectories[0].GetState());
-						storage.transitions.clear();
-						storage.transitions.emplace_back(1.0, &value);
-						storage.costs_until_transition = trajectories[0].CumulativeReturn;				
+						costs_until_transition[i] =mdp->DiscountFactor()*	expected_costs + trajectories[0].CumulativeReturn;
 					}
 					else
 					{
-						storage.transitions.clear();
-						storage.costs_until_transition = trajectories[0].CumulativeReturn;
-					}
-					if (trajectories[0].Category.IsAwaitEvent() && trajectories[0].Category.Index() != 0)
-						throw DynaPlex::Error("ExactSolver: Event states must have index 0, i.e. correspond to a time step, in current version of ExactSolver. ");
+						if (trajectories[0].Category.IsAwaitAction())
+						{
+							next.push_back((uint32_t)GetStateIndex(trajectories[0].GetState()));
+							prob_of_next.push_back(1.0);
+							costs_until_transition[i] = trajectories[0].CumulativeReturn;				
+						}
+						else
+						{
+							costs_until_transition[i] = trajectories[0].CumulativeReturn;
+						}
+						if (trajectories[0].Category.IsAwaitEvent() && trajectories[0].Category.Index() != 0)
+							throw DynaPlex::Error("ExactSolver: Event states must have index 0, i.e. correspond to a time step, in current version of ExactSolver. ");
 
+					}
+					transition_begin[i + 1] = next.size() - num_before;
 				}
-
+			});
+			for (size_t i = 0; i < states.size(); i++)
+				transition_begin[i + 1] += transition_begin[i];
+			//the parts cover the states in order, so concatenating them gives the rows in order. 
+			next_state.clear();
+			probability.clear();
+			next_state.reserve(transition_begin.back());
+			probability.reserve(transition_begin.back());
+			for (size_t part = 0; part < num_threads; part++)
+			{
+				next_state.insert(next_state.end(), part_next[part].begin(), part_next[part].end());
+				probability.insert(probability.end(), part_probability[part].begin(), part_probability[part].end());
+				std::vector<uint32_t>().swap(part_next[part]);
+				std::vector<double>().swap(part_probability[part]);
 			}
 		}
 	
-		///This populates the key data structures action_states and statemap
+		///This populates the key data structures store and states
 		void CreateStateMap()
 		{
 			if (!silent)
 				system << "adding states to state map:" << std::endl;
 			LastReportedTotalStates = 1;
-			hash_collisions = 0;
 			auto state = mdp->GetInitialState();
 			ProcessState(state);
 			size_t expanded_action_states = 0;
-			while (expanded_action_states < action_states.size())
+			while (expanded_action_states < states.size())
 			{
-				ExpandActionState(action_states[expanded_action_states].state);
+				//note that expansion appends to states; the reference is not used after that. 
+				ExpandActionState(states[expanded_action_states]);
 				expanded_action_states++;
 			}
+			value.assign(states.size(), 0.0);
+			new_value.assign(states.size(), 0.0);
 			if (!silent) {
 				system << std::endl;
-				system << "Created complete state list consisting of " << action_states.size() << " states." << std::endl;
-				if (hash_collisions > 0)
-					system << "There are " << hash_collisions << " collided hashes. " << std::endl;
-				if (hash_collisions > 0.05 * action_states.size())
-					system << "Such a high number of hash collisions is unexpected.";
+				system << "Created complete state list consisting of " << states.size() << " states." << std::endl;
+				if (store.Collisions() > 0)
+					system << "There are " << store.Collisions() << " collided hashes. " << std::endl;
 				system << "Initiating hybrid value/policy iteration." << std::endl;
 			}
 		}
@@ -326,71 +333,77 @@ namespace DynaPlex::Algorithms {
 
 		void IterateValues() {
 
-			for (auto& [key, list] : statemap)
-				for (auto& lookupValue : list)
-					lookupValue.value = action_states[lookupValue.state_index].new_value;
-
+			//every entry of new_value is overwritten below. 
+			std::swap(value, new_value);
 		
-			for (auto& stateStorage : action_states) {
-				stateStorage.new_value = 0;
-				for (auto& transition : stateStorage.transitions)
-				{
-					stateStorage.new_value += transition.probability * (*transition.values).value;
-				}
-				stateStorage.new_value *= mdp->DiscountFactor();
-				stateStorage.new_value += stateStorage.costs_until_transition;
-			}
-			if (mdp->IsInfiniteHorizon() && mdp->DiscountFactor() == 1.0)
-			{	//This is a tricky case. 
-				//to deal with/remove any periodicity that may be present in the model, 
-				// we change to model to add cost-less transitions from states to themselves with
-				//probability self_transition_prob. This increases probability of convergence.
-				//note that such transitions do not affect the optimal policy (i.e. the system simply does "nothing" for a time-step).
-				//however, the effective cost rate per period is reduced - it gets multiplied with (1.0 - self_transition_prob), which we
-				//correct for when computing costs. 
-				double no_self_transition_prob = 1.0 - self_transition_prob;
-				for (auto& [key, list] : statemap) {
-					for (auto& lookupValue : list)
+			const double discount_factor = mdp->DiscountFactor();
+			//This is a tricky case. 
+			//to deal with/remove any periodicity that may be present in the model, 
+			// we change to model to add cost-less transitions from states to themselves with
+			//probability self_transition_prob. This increases probability of convergence.
+			//note that such transitions do not affect the optimal policy (i.e. the system simply does "nothing" for a time-step).
+			//however, the effective cost rate per period is reduced - it gets multiplied with (1.0 - self_transition_prob), which we
+			//correct for when computing costs. 
+			const bool add_self_transitions = mdp->IsInfiniteHorizon() && mdp->DiscountFactor() == 1.0;
+			const double no_self_transition_prob = 1.0 - self_transition_prob;
+			ParallelOverStates(new_value.size(), [&](size_t begin, size_t end, size_t) {
+				for (size_t i = begin; i < end; i++) {
+					double state_value = 0;
+					for (size_t e = transition_begin[i]; e < transition_begin[i + 1]; e++)
+					{
+						state_value += probability[e] * value[next_state[e]];
+					}
+					state_value *= discount_factor;
+					state_value += costs_until_transition[i];
+					if (add_self_transitions)
 					{
-						action_states[lookupValue.state_index].new_value *= no_self_transition_prob;
-						action_states[lookupValue.state_index].new_value += self_transition_prob * lookupValue.value;
+						state_value *= no_self_transition_prob;
+						state_value += self_transition_prob * value[i];
 					}
+					new_value[i] = state_value;
 				}
-			}
+			});
 		}
 
 		void CheckConvergence(){
-			double deltaMax = -std::numeric_limits<double>::infinity();
-			double deltaMin = std::numeric_limits<double>::infinity();
-			double lowestValue = std::numeric_limits<double>::infinity();
-			for (auto& [key, list] : statemap)
-			{
-				for (auto& lookupValue : list)
+			//per part; minima and maxima are exact, so combining them does not depend on the split. 
+			std::vector<double> part_deltaMax(num_threads, -std::numeric_limits<double>::infinity());
+			std::vector<double> part_deltaMin(num_threads, std::numeric_limits<double>::infinity());
+			std::vector<double> part_lowestValue(num_threads, std::numeric_limits<double>::infinity());
+			ParallelOverStates(new_value.size(), [&](size_t begin, size_t end, size_t part) {
+				double deltaMax = -std::numeric_limits<double>::infinity();
+				double deltaMin = std::numeric_limits<double>::infinity();
+				double lowestValue = std::numeric_limits<double>::infinity();
+				for (size_t i = begin; i < end; i++)
 				{
-					double delta{ action_states[lookupValue.state_index].new_value - lookupValue.value };
+					double delta{ new_value[i] - value[i] };
 					deltaMax = std::max(deltaMax, delta);
 					deltaMin = std::min(deltaMin, delta);
-					lowestValue = std::min(lowestValue, action_states[lookupValue.state_index].new_value);
+					lowestValue = std::min(lowestValue, new_value[i]);
 				}
-			}
+				part_deltaMax[part] = deltaMax;
+				part_deltaMin[part] = deltaMin;
+				part_lowestValue[part] = lowestValue;
+			});
+			double deltaMax = *std::max_element(part_deltaMax.begin(), part_deltaMax.end());
+			double deltaMin = *std::min_element(part_deltaMin.begin(), part_deltaMin.end());
+			double lowestValue = *std::min_element(part_lowestValue.begin(), part_lowestValue.end());
 
 			if (mdp->IsInfiniteHorizon() && mdp->DiscountFactor() == 1.0)
 			{
-				for (auto& [key, list] : statemap)
-				{
-					for (auto& lookupValue : list)
+				ParallelOverStates(new_value.size(), [&](size_t begin, size_t end, size_t) {
+					for (size_t i = begin; i < end; i++)
 					{
-						action_states[lookupValue.state_index].new_value -= lowestValue;
-						lookupValue.value -= lowestValue;
+						new_value[i] -= lowestValue;
+						value[i] -= lowestValue;
 					}
-				}
+				});
 				maxChange = (deltaMax - deltaMin) / 2.0 / (1.0 - self_transition_prob);
 				currentCost = (deltaMax + deltaMin) / 2.0 / (1.0 - self_transition_prob);
 			}
 			else
 			{
-				auto& LookupValue = GetStateValue(mdp->GetInitialState());
-				currentCost = action_states[LookupValue.state_index].new_value;
+				currentCost = new_value[GetStateIndex(mdp->GetInitialState())];
 				maxChange = std::max(deltaMax, -deltaMin);
 			}
 			if (!silent) {
@@ -402,97 +415,95 @@ namespace DynaPlex::Algorithms {
 		void UpdateActionsForValues() {
 
 			double objective = mdp->Objective();
-			for (auto& stateStorage : action_states) {
-				auto allowed_actions = mdp->AllowedActions(stateStorage.state);
-				double best_action_return = -std::numeric_limits<double>::infinity();
-				stateStorage.current_action = std::numeric_limits<int64_t>::max();
-				for (auto current_action : allowed_actions)
-				{
-					trajectories.clear();
-					trajectories.emplace_back();
-					mdp->InitiateState(trajectories, stateStorage.state);
-					trajectories[0].NextAction = current_action;
-					mdp->IncorporateAction(trajectories);
-
-					if (trajectories[0].Category.IsAwaitEvent() && trajectories[0].Category.Index() == 0)
+			ParallelOverStates(states.size(), [&](size_t begin, size_t end, size_t) {
+				std::vector<DynaPlex::Trajectory> trajectories;
+				std::vector<std::tuple<double, DynaPlex::dp_State>> transitions_holder;
+				for (size_t i = begin; i < end; i++) {
+					auto allowed_actions = mdp->AllowedActions(states[i]);
+					double best_action_return = -std::numeric_limits<double>::infinity();
+					int64_t best_action = std::numeric_limits<int64_t>::max();
+					for (auto action : allowed_actions)
 					{
-						transitions_holder.clear();
-						double direct_return =
-							mdp->GetAllEventTransitions(trajectories[0].GetState(), transitions_holder);
-						double expected_future_return = 0.0;
-						for (auto& [prob, state] : transitions_holder)
+						trajectories.clear();
+						trajectories.emplace_back();
+						mdp->InitiateState(trajectories, states[i]);
+						trajectories[0].NextAction = action;
+						mdp->IncorporateAction(trajectories);
+
+						if (trajectories[0].Category.IsAwaitEvent() && trajectories[0].Category.Index() == 0)
 						{
-							auto cat = mdp->GetStateCategory(state);
-							if (cat.IsAwaitAction())
+							transitions_holder.clear();
+							double direct_return =
+								mdp->GetAllEventTransitions(trajectories[0].GetState(), transitions_holder);
+							double expected_future_return = 0.0;
+							for (auto& [prob, state] : transitions_holder)
 							{
-								auto& LookupValue = GetStateValue(state);
-								expected_future_return += prob * LookupValue.value;
-								if (!StatesAreEqual(action_states[LookupValue.state_index].state, state))
-									throw DynaPlex::Error("issue with state retrieval while updating actions.");
-							}
-							else
-							{
-								if (cat.IsAwaitEvent())
-									throw DynaPlex::Error("Events after events - this is not currently supported.");
+								auto cat = mdp->GetStateCategory(state);
+								if (cat.IsAwaitAction())
+								{
+									expected_future_return += prob * value[GetStateIndex(state)];
+								}
+								else
+								{
+									if (cat.IsAwaitEvent())
+										throw DynaPlex::Error("Events after events - this is not currently supported.");
+								}
 							}
-						}
-						auto total_return = trajectories[0].CumulativeReturn+ (mdp->DiscountFactor() *( expected_future_return + direct_return));
-						total_return *= objective;
-						if (total_return > best_action_return)
-						{
-							best_action_return = total_return;
-							stateStorage.current_action = current_action;
-						}
-					}
-					else
-					{
-						if (trajectories[0].Category.IsAwaitAction())
-						{
-							auto& LookupValue = GetStateValue(trajectories[0].GetState());							
-							auto future_return = LookupValue.value;
-							auto total_return = trajectories[0].CumulativeReturn + future_return;
+							auto total_return = trajectories[0].CumulativeReturn+ (mdp->DiscountFactor() *( expected_future_return + direct_return));
 							total_return *= objective;
 							if (total_return > best_action_return)
 							{
 								best_action_return = total_return;
-								stateStorage.current_action = current_action;
+								best_action = action;
 							}
 						}
-						else {
-							auto total_return = trajectories[0].CumulativeReturn;
-							total_return *= objective;
-							if (total_return > best_action_return)
+						else
+						{
+							if (trajectories[0].Category.IsAwaitAction())
 							{
-								best_action_return = total_return;
-								stateStorage.current_action = current_action;
+								auto future_return = value[GetStateIndex(trajectories[0].GetState())];
+								auto total_return = trajectories[0].CumulativeReturn + future_return;
+								total_return *= objective;
+								if (total_return > best_action_return)
+								{
+									best_action_return = total_return;
+									best_action = action;
+								}
 							}
-						}
-						if (trajectories[0].Category.IsAwaitEvent() && trajectories[0].Category.Index() != 0)
-							throw DynaPlex::Error("ExactSolver: Event states must have index 0, i.e. correspond to a time step, in current version of ExactSolver. ");
+							else {
+								auto total_return = trajectories[0].CumulativeReturn;
+								total_return *= objective;
+								if (total_return > best_action_return)
+								{
+									best_action_return = total_return;
+									best_action = action;
+								}
+							}
+							if (trajectories[0].Category.IsAwaitEvent() && trajectories[0].Category.Index() != 0)
+								throw DynaPlex::Error("ExactSolver: Event states must have index 0, i.e. correspond to a time step, in current version of ExactSolver. ");
 
+						}
 					}
+					if (best_action == std::numeric_limits<int64_t>::max())
+						throw DynaPlex::Error("current_action not updated in call to UpdateActionsForValues.");
+					if (!mdp->IsAllowedAction(states[i], best_action))
+						throw DynaPlex::Error("current_action is not legal after call to UpdateActionsForValues.");
+					current_action[i] = best_action;
 				}
-				if (stateStorage.current_action == std::numeric_limits<int64_t>::max())
-					throw DynaPlex::Error("current_action not updated in call to UpdateActionsForValues.");
-				if (!mdp->IsAllowedAction(stateStorage.state, stateStorage.current_action))
-					throw DynaPlex::Error("current_action is not legal after call to UpdateActionsForValues.");
-			}
+			});
 
 		}
 
 		double ComputeCosts(bool optimize, DynaPlex::Policy policy) {
-			feats_holder.resize(mdp->NumFlatFeatures(), 0.0f);
-			feats_holder2.resize(mdp->NumFlatFeatures(), 0.0f);
-
 			//If this flag is set, it means that the memory of statemap is being used as part of an 
 			//optimal policy. Using this same memory now for setting the optimal costs will lead to 
 			//strange errors, hence better throw an error now. 
 			if (exact_policy_exported)
 				throw DynaPlex::Error("Illegal call to ExactPolicy::ComputeCosts: Exact policy has allready been exported. ");
+			if (states_dropped)
+				throw DynaPlex::Error("Illegal call to ExactPolicy::ComputeCosts: states were dropped after the previous call (option drop_states). ");
 			if (!statemap_created)
 			{
-				statemap.reserve(max_states);
-				action_states.reserve(max_states);
 				CreateStateMap();
 				statemap_created = true;
 			}
@@ -505,6 +516,9 @@ namespace DynaPlex::Algorithms {
 
 			SetActions(policy);
 			DetermineTransitions();
+			//evaluating a fixed policy needs no states after this. 
+			if (drop_states && !optimize)
+				DropStates();
 			do {
 				for (size_t i = 0; i < 10; i++)
 					IterateValues();
@@ -521,16 +535,14 @@ namespace DynaPlex::Algorithms {
 			else
 				exact_policy_computed = false;
 
-			for (int64_t index = 0 ; index<action_states.size() ;index++)
+			for (size_t index = 0 ; index<store.size() ;index++)
 			{
-				auto& state = action_states.at(index);
-				auto& value = GetStateValue(state.state);
-				if (value.state_index != index)
+				if (store.Find(store.Features(index)) != index)
 					throw DynaPlex::Error("Issue with state index");
 
 			}
-
-			
+			if (drop_states && !states_dropped)
+				DropStates();
 
 			return currentCost;
 		}
@@ -556,7 +568,7 @@ namespace DynaPlex::Algorithms {
 		// Override GetConfig() to return configuration details
 		virtual const DynaPlex::VarGroup& GetConfig() const override {
 			static DynaPlex::VarGroup config; 
-			config.Add("NumStates",static_cast<int64_t>( impl->action_states.size()));
+			config.Add("NumStates",static_cast<int64_t>( impl->store.size()));
 			config.Add("Objective", 10);
 
 			return config;
@@ -566,12 +578,9 @@ namespace DynaPlex::Algorithms {
 		virtual void SetAction(std::span<Trajectory> trajectories) const override {
 			for (auto& traj : trajectories) {
 				const DynaPlex::StateCategory& cat = traj.Category;
-				impl->feats_holder.resize(impl->mdp->NumFlatFeatures(), 0.0f);
 				if (cat.IsAwaitAction())
 				{
-					auto& value = impl->GetStateValue(traj.GetState());
-					traj.NextAction = impl->action_states[value.state_index].current_action;
-					auto& retrieved = impl->action_states[value.state_index].state;
+					traj.NextAction = impl->current_action[impl->GetStateIndex(traj.GetState())];
 				
 					if (!impl->mdp->IsAllowedAction(traj.GetState(), traj.NextAction)) {
 						throw DynaPlex::Error("Illegal action retrieved from solver.");
@@ -605,9 +614,10 @@ namespace DynaPlex::Algorithms {
 		//exporting the optimal policy raises an error. (Note that the memory of the ActionStates is shared between policy
 		// and optimizer..)
 		pImpl->exact_policy_exported = true;
+		//the policy identifies states by their features only. 
+		pImpl->DropStates();
 		return std::make_shared<ExactPolicy>(pImpl);
 	}
 	// Allocate storage for static thread_local members
 	thread_local std::vector<float> ExactSolver::Impl::feats_holder;
-	thread_local std::vector<float> ExactSolver::Impl::feats_holder2;
 }
\ No newline at end of file
@@ -0,0 +1,132 @@
+#pragma once
+#include "dynaplex/error.h"
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <string>
+#include <vector>
+
+namespace DynaPlex::Algorithms {
+	/// Action states of the ExactSolver by their flat features. States are considered equal if their
+	/// features are equal (this avoids relying on human-implemented state equality); -0.0f and 0.0f are
+	/// equal features, and are stored as 0.0f. The features of every state are stored once, contiguously,
+	/// so that a lookup computes the features of the state looked up only.
+	/// Open addressing with linear probing over a power-of-two slot array that is at most half full.
+	/// A slot holds a 32-bit state index and the high half of that state's hash, so a probe rarely has to
+	/// compare features; equality is a comparison of the feature words.
+	class StateStore {
+	public:
+		/// the most states a store can hold: indices are 32-bit, and one value marks an empty slot.
+		static constexpr size_t MaxStates = std::numeric_limits<uint32_t>::max() - 1;
+		static constexpr size_t npos = std::numeric_limits<size_t>::max();
+
+		/// empties the store, for states with num_features features; Add throws once capacity states are stored.
+		void Reset(size_t num_features, size_t capacity = MaxStates) {
+			if (capacity > MaxStates)
+				throw DynaPlex::Error("ExactSolver: max_states (=" + std::to_string(capacity) + ") exceeds " + std::to_string(MaxStates) + ", the most action states 32-bit state indices can address.");
+			width = num_features;
+			max_states = capacity;
+			features.clear();
+			hashes.clear();
+			slots.assign(1024, Slot{ Empty, 0 });
+			collisions = 0;
+		}
+		size_t size() const { return hashes.size(); }
+		size_t capacity() const { return max_states; }
+		const float* Features(size_t index) const { return features.data() + index * width; }
+		//distinct states whose features have the same 64-bit hash.
+		size_t Collisions() const { return collisions; }
+
+		/// index of the state with these features, or npos if there is none.
+		size_t Find(const float* feats) const {
+			const uint64_t hash = Hash(feats);
+			for (size_t s = hash & (slots.size() - 1);; s = (s + 1) & (slots.size() - 1)) {
+				const Slot& slot = slots[s];
+				if (slot.index == Empty)
+					return npos;
+				if (slot.tag == (uint32_t)(hash >> 32) && hashes[slot.index] == hash && Equal(Features(slot.index), feats))
+					return slot.index;
+			}
+		}
+
+		/// adds a state with these features, which must not be present yet; returns its index.
+		size_t Add(const float* feats) {
+			if (size() >= max_states)
+				throw DynaPlex::Error("ExactSolver: more than " + std::to_string(max_states) + " action states.");
+			if (2 * (size() + 1) > slots.size())
+				Grow();
+			const uint64_t hash = Hash(feats);
+			const size_t index = size();
+			features.insert(features.end(), feats, feats + width);
+			for (float* f = features.data() + index * width; f != features.data() + features.size(); f++)
+				if (*f == 0.0f)
+					*f = 0.0f;
+			hashes.push_back(hash);
+			Place(index, hash);
+			return index;
+		}
+
+	private:
+		struct Slot {
+			uint32_t index;
+			uint32_t tag;
+		};
+		static constexpr uint32_t Empty = std::numeric_limits<uint32_t>::max();
+		static constexpr uint32_t NegativeZero = 0x80000000u;
+
+		//the bits of a feature, with -0.0f read as 0.0f.
+		static uint32_t Word(const float* f) {
+			uint32_t word;
+			std::memcpy(&word, f, sizeof(word));
+			return word == NegativeZero ? 0 : word;
+		}
+
+		//stored features are normalised already.
+		bool Equal(const float* stored, const float* feats) const {
+			for (size_t i = 0; i < width; i++) {
+				uint32_t word;
+				std::memcpy(&word, stored + i, sizeof(word));
+				if (word != Word(feats + i))
+					return false;
+			}
+			return true;
+		}
+
+		//multiply-xorshift over the 32-bit words of the features, murmur3 finaliser.
+		uint64_t Hash(const float* feats) const {
+			uint64_t hash = 0x9e3779b97f4a7c15ull ^ width;
+			for (size_t i = 0; i < width; i++) {
+				hash = (hash ^ Word(feats + i)) * 0xff51afd7ed558ccdull;
+				hash ^= hash >> 32;
+			}
+			hash ^= hash >> 33;
+			hash *= 0xc4ceb9fe1a85ec53ull;
+			hash ^= hash >> 33;
+			return hash;
+		}
+
+		void Place(size_t index, uint64_t hash) {
+			size_t s = hash & (slots.size() - 1);
+			while (slots[s].index != Empty) {
+				if (hashes[slots[s].index] == hash)
+					collisions++;
+				s = (s + 1) & (slots.size() - 1);
+			}
+			slots[s] = Slot{ (uint32_t)index, (uint32_t)(hash >> 32) };
+		}
+
+		void Grow() {
+			slots.assign(2 * slots.size(), Slot{ Empty, 0 });
+			collisions = 0;
+			for (size_t index = 0; index < size(); index++)
+				Place(index, hashes[index]);
+		}
+
+		size_t width{ 0 };
+		size_t max_states{ MaxStates };
+		std::vector<float> features;
+		std::vector<uint64_t> hashes;
+		std::vector<Slot> slots;
+		size_t collisions{ 0 };
+	};
+}
@@ -14,6 +14,11 @@ namespace DynaPlex::Algorithms {
 		 * @param system object 
 		 * @param mdp model
 		 * @param config file (optional), that may provide:
+		 *   - epsilon (default 0.0001), max_states (default 1048576), silent, num_sample_states.
+		 *   - drop_states (default false): release the state objects once transitions are determined;
+		 *     ComputeCosts can then be called only once. States are always released by GetOptimalPolicy.
+		 *   - num_threads (default: the hardware threads of the system): most threads used per phase;
+		 *     costs and policies do not depend on it.
 		*/
 		ExactSolver(const DynaPlex::System& system, DynaPlex::MDP mdp, const DynaPlex::VarGroup& config = VarGroup{});
 		
@@ -42,6 +42,11 @@ namespace DynaPlex::Erasure
 		{ mdp.GetEvent(rng) } -> std::same_as<t_Event>;
 	};
 
+	template <typename t_MDP, typename t_State, typename t_RNG>
+	concept HasSkipIdlePeriods = requires(const t_MDP & mdp, t_State & state, t_RNG & rng, int64_t max_periods, int64_t & periods) {
+		{ mdp.SkipIdlePeriods(state, rng, max_periods, periods) } -> std::same_as<double>;
+	};
+
 	template <typename t_MDP, typename t_State, typename t_RNG>
 	concept HasResetHiddenStateVariables = requires(const t_MDP & mdp, t_State & state, t_RNG & rng) {
 		mdp.ResetHiddenStateVariables(state, rng);
@@ -483,6 +483,18 @@ namespace DynaPlex::Erasure
 				while (traj.PeriodCount < MaxPeriodCount && traj.Category.IsAwaitEvent())
 				{
 					auto event_stream = traj.Category.Index();
+					if constexpr (HasSkipIdlePeriods<t_MDP, t_State, DynaPlex::RNG>)
+					{//optional skip-ahead: the MDP consumes a run of periods in which only time passes.
+						//undiscounted only, as the costs of the skipped periods are returned as one sum.
+						if (event_stream == 0 && discount_factor == 1.0)
+						{
+							int64_t periods = 0;
+							traj.CumulativeReturn += mdp->SkipIdlePeriods(t_state, traj.RNGProvider.GetEventRNG(event_stream), MaxPeriodCount - traj.PeriodCount, periods) * traj.EffectiveDiscountFactor;
+							traj.PeriodCount += periods;
+							if (traj.PeriodCount >= MaxPeriodCount)
+								break;
+						}
+					}
 					if (event_stream == 0)
 					{
 						traj.PeriodCount++;
@@ -0,0 +1,173 @@
+#pragma once
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <algorithm>
+#include <initializer_list>
+#include <string>
+#include <type_traits>
+#include "dynaplex/error.h"
+
+namespace DynaPlex {
+	/// Vector with a compile-time capacity and inline storage. For trivially copyable T the container
+	/// itself is trivially copyable, so a state that is built from FixedVectors copies as a single block
+	/// (no heap allocations on clone/assignment). The interface mirrors the subset of std::vector/std::deque
+	/// that is commonly needed inside MDP states, so it can be used as a drop-in replacement.
+	template<typename T, size_t N>
+	class FixedVector
+	{
+		static_assert(std::is_trivially_copyable_v<T>, "DynaPlex::FixedVector<T,N> - T must be trivially copyable.");
+		static_assert(N > 0, "DynaPlex::FixedVector<T,N> - capacity must be positive.");
+	public:
+		using value_type = T;
+		using size_type = std::size_t;
+		using reference = value_type&;
+		using const_reference = const value_type&;
+		using pointer = value_type*;
+		using const_pointer = const value_type*;
+		using iterator = value_type*;
+		using const_iterator = const value_type*;
+
+	private:
+		size_type num_items = 0;
+		std::array<T, N> items{};
+
+	public:
+		FixedVector() = default;
+
+		explicit FixedVector(size_type n, const T& value = T{}) {
+			assign(n, value);
+		}
+
+		FixedVector(std::initializer_list<T> init) {
+			assign(init.begin(), init.end());
+		}
+
+		static constexpr size_type Capacity() { return N; }
+		static constexpr size_type max_size() { return N; }
+
+		size_type size() const { return num_items; }
+		bool empty() const { return num_items == 0; }
+
+		iterator begin() { return items.data(); }
+		iterator end() { return items.data() + num_items; }
+		const_iterator begin() const { return items.data(); }
+		const_iterator end() const { return items.data() + num_items; }
+
+		pointer data() { return items.data(); }
+		const_pointer data() const { return items.data(); }
+
+		reference operator[](size_type loc) { return items[loc]; }
+		const_reference operator[](size_type loc) const { return items[loc]; }
+
+		reference at(size_type loc) {
+			if (loc >= num_items)
+				throw DynaPlex::Error("FixedVector: index out of range");
+			return items[loc];
+		}
+		const_reference at(size_type loc) const {
+			if (loc >= num_items)
+				throw DynaPlex::Error("FixedVector: index out of range");
+			return items[loc];
+		}
+
+		reference front() {
+			if (num_items == 0)
+				throw DynaPlex::Error("FixedVector: container is empty");
+			return items[0];
+		}
+		const_reference front() const {
+			if (num_items == 0)
+				throw DynaPlex::Error("FixedVector: container is empty");
+			return items[0];
+		}
+		reference back() {
+			if (num_items == 0)
+				throw DynaPlex::Error("FixedVector: container is empty");
+			return items[num_items - 1];
+		}
+		const_reference back() const {
+			if (num_items == 0)
+				throw DynaPlex::Error("FixedVector: container is empty");
+			return items[num_items - 1];
+		}
+
+		void push_back(const T& item) {
+			if (num_items == N)
+				throw DynaPlex::Error("FixedVector: capacity exceeded (capacity " + std::to_string(N) + ")");
+			items[num_items++] = item;
+		}
+
+		void pop_back() {
+			if (num_items == 0)
+				throw DynaPlex::Error("FixedVector: container is empty");
+			items[--num_items] = T{};
+		}
+
+		/// Removes the first element, shifting the remainder one slot forward (O(size)).
+		void pop_front() {
+			if (num_items == 0)
+				throw DynaPlex::Error("FixedVector: container is empty");
+			std::copy(items.begin() + 1, items.begin() + num_items, items.begin());
+			items[--num_items] = T{};
+		}
+
+		/// Clearing resets the unused slots as well, so that two equal FixedVectors are also bytewise equal.
+		void clear() {
+			std::fill(items.begin(), items.begin() + num_items, T{});
+			num_items = 0;
+		}
+
+		void resize(size_type n, const T& value = T{}) {
+			if (n > N)
+				throw DynaPlex::Error("FixedVector: capacity exceeded (capacity " + std::to_string(N) + ")");
+			if (n > num_items)
+				std::fill(items.begin() + num_items, items.begin() + n, value);
+			else
+				std::fill(items.begin() + n, items.begin() + num_items, T{});
+			num_items = n;
+		}
+
+		void assign(size_type n, const T& value) {
+			clear();
+			resize(n, value);
+		}
+
+		template<typename InputIt>
+		void assign(InputIt first, InputIt last) {
+			clear();
+			for (; first != last; ++first)
+				push_back(*first);
+		}
+
+		/// Inserts value before pos, shifting the tail back one slot. Returns an iterator to the inserted element.
+		iterator insert(const_iterator pos, const T& value) {
+			if (num_items == N)
+				throw DynaPlex::Error("FixedVector: capacity exceeded (capacity " + std::to_string(N) + ")");
+			const T item = value;   // value may alias an element that is about to shift
+			iterator p = begin() + (pos - begin());
+			std::copy_backward(p, end(), end() + 1);
+			*p = item;
+			++num_items;
+			return p;
+		}
+
+		/// Erases [first, last), shifting the tail forward. Returns an iterator to the element that followed last.
+		iterator erase(const_iterator first, const_iterator last) {
+			iterator f = begin() + (first - begin());
+			iterator l = begin() + (last - begin());
+			iterator new_end = std::copy(l, end(), f);
+			std::fill(new_end, end(), T{});
+			num_items = static_cast<size_type>(new_end - begin());
+			return f;
+		}
+
+		iterator erase(const_iterator pos) {
+			return erase(pos, pos + 1);
+		}
+
+		friend bool operator==(const FixedVector& lhs, const FixedVector& rhs) {
+			return lhs.num_items == rhs.num_items && std::equal(lhs.begin(), lhs.end(), rhs.begin());
+		}
+	};
+}
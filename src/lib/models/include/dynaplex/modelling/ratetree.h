@@ -0,0 +1,65 @@
+#pragma once
+#include <array>
+#include <bit>
+#include <cstddef>
+#include "dynaplex/error.h"
+
+namespace DynaPlex {
+	/// Sum tree over N non-negative rates with inline storage, for sampling "which of N competing
+	/// exponential clocks fires" in O(log N) instead of a linear cumulative scan. Every internal node
+	/// is recomputed from its two children on update (no running +=/-=), so the tree is a pure function
+	/// of the current leaf values: no drift, and two states with equal rates hold bytewise-equal trees.
+	/// Trivially copyable, so it can live inside a flat MDP state.
+	template<size_t N>
+	class RateTree
+	{
+		static_assert(N > 0, "DynaPlex::RateTree<N> - number of leaves must be positive.");
+		static constexpr size_t Leaves = std::bit_ceil(N);
+		// nodes[1] is the root, node i has children 2i and 2i+1, leaf j sits at Leaves + j.
+		std::array<double, 2 * Leaves> nodes{};
+
+	public:
+		static constexpr size_t Capacity() { return N; }
+
+		void clear() { nodes.fill(0.0); }
+
+		void set(size_t leaf, double rate) {
+			if (leaf >= N)
+				throw DynaPlex::Error("RateTree: leaf index out of range");
+			size_t i = Leaves + leaf;
+			nodes[i] = rate;
+			for (i /= 2; i >= 1; i /= 2)
+				nodes[i] = nodes[2 * i] + nodes[2 * i + 1];
+		}
+
+		double get(size_t leaf) const { return nodes[Leaves + leaf]; }
+
+		double total() const { return nodes[1]; }
+
+		/// Returns the leaf j with prefix(j) <= u < prefix(j + 1), i.e. the bucket a linear cumulative
+		/// scan would select for the same u. Only leaves with a positive rate are returned: if rounding
+		/// in the partial sums would push the descent into an all-zero subtree, it stays in the sibling
+		/// instead, and u >= total() gives the last leaf with a positive rate. Returns N only if all
+		/// rates are 0; callers that give the mass past total() another meaning test u < total() first.
+		size_t find(double u) const {
+			if (!(nodes[1] > 0.0))
+				return N;
+			size_t i = 1;
+			if (!(u < nodes[1])) {
+				while (i < Leaves)
+					i = (nodes[2 * i + 1] > 0.0) ? 2 * i + 1 : 2 * i;
+				return i - Leaves;
+			}
+			while (i < Leaves) {
+				const size_t left = 2 * i;
+				if (u < nodes[left] || !(nodes[left + 1] > 0.0))
+					i = left;
+				else {
+					u -= nodes[left];
+					i = left + 1;
+				}
+			}
+			return i - Leaves;
+		}
+	};
+}
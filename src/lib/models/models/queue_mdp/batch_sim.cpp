@@ -0,0 +1,699 @@
+// batch_sim.cpp
+// Structure-of-arrays batched simulator for queue_mdp::MDP.
+//
+// Design summary
+// --------------
+// BatchSimulator holds B trajectories ("lanes") of one MDP and advances all
+// of them by one uniformized step per round, exactly as EvaluatePolicyRaw
+// steps a single trajectory: a lane awaiting an action takes the action the
+// policy chose for it, every other lane incorporates one event.
+//
+// Every per-lane quantity lives in a [row][B] array (row = job type / queue
+// position / busy slot / pool), so a round is a handful of passes over the
+// batch:
+//   1. draw    - two uniforms per event lane from its own event stream
+//                (the two MDP::GetEvent draws);
+//   2. classify - arrival / tick / completion / nothing / FIL refresh from
+//                the lane's rates, as MDP::GetEventType, and bucket the lanes
+//                by kind (selects only, no data-dependent branches);
+//   3. charge  - RVI-style and GetImmediateCost diagnostics of the pre-event
+//                state, from per-lane cost caches;
+//   4. tick    - one masked add over every tracked-age row;
+//   5. apply   - one loop per kind over its bucket: arrivals, completions
+//                and FIL refreshes are scattered updates of a few rows each.
+// Candidate queues are variable-length sorted lists and the rate trees are
+// sampled by descent, so both stay per lane; they are updated with the same
+// incremental operations (and shape kernels) the MDP uses.
+//
+// Exactness
+// ---------
+// Rates are kept the way the MDP keeps them (incremental total arrival rate,
+// service rate as the RateTree total) and event buckets are resolved with
+// the same RateTree descents, so for the same seeds and policy a lane follows
+// the trajectory EvaluatePolicyRaw simulates, draw for draw.
+
+#include "mdp.h"
+#include "dynaplex/erasure/stateadapter.h"
+#include <algorithm>
+#include <memory>
+
+namespace DynaPlex::Models::queue_mdp {
+
+// ============================================================
+//  BatchSimulator
+// ============================================================
+BatchSimulator::BatchSimulator(const MDP& mdp, int64_t capacity)
+    : mdp(mdp), capacity(capacity),
+      initial_state(mdp.GetInitialState()), query_state(initial_state)
+{
+    if (capacity <= 0)
+        throw DynaPlex::Error("queue_mdp::BatchSimulator: capacity must be positive");
+    if (mdp.per_event_mode || mdp.joint_mode)
+        throw DynaPlex::Error("queue_mdp::BatchSimulator: only action_mode \"candidate_queue\" is supported");
+
+    n_types = mdp.n_jobs;
+    depth   = mdp.max_queue_depth;
+    n_pools = (int64_t)mdp.server_static_info.size();
+    pool_first_slot.assign((size_t)n_pools + 1, 0);
+    for (int64_t k = 0; k < n_pools; ++k)
+        pool_first_slot[(size_t)k + 1] = pool_first_slot[(size_t)k]
+            + (int64_t)mdp.server_static_info[(size_t)k].can_serve.size();
+    n_slots = pool_first_slot.back();
+
+    // Feature width: a counting pass (Features ignores values beyond its span).
+    DynaPlex::Features probe{ std::span<float>{} };
+    mdp.GetFeatures(initial_state, probe);
+    num_features = (int64_t)probe.NumFeatsAdded();
+    num_actions  = mdp.enable_skip_all ? 3 : 2;
+
+    const size_t B = (size_t)capacity;
+    age.resize((size_t)(n_types * depth) * B);
+    queue_len.resize((size_t)n_types * B);
+    busy.resize((size_t)n_slots * B);
+    pool_busy.resize((size_t)n_pools * B);
+    arrival_rate.resize(B);
+    service_rate.resize(B);
+    tick_cost.resize(B);
+    binary_cost.resize(B);
+    next_fil.resize(B);
+    awaits_action.resize(B);
+    last_event.resize(B);
+    stochastic_key.resize(B);
+    arrival_tree.resize(B);
+    completion_tree.resize(B);
+    candidates.resize(B);
+    action_counter.resize(B);
+    rng.reserve(B);
+    acc_cost.resize(B);
+    acc_cost_rvi.resize(B);
+    acc_cost_gic.resize(B);
+    acc_action_steps.resize(B);
+    acc_real_event_steps.resize(B);
+    acc_fil_refresh_steps.resize(B);
+    decision_lanes.reserve(B);
+    event_lanes.reserve(B);
+    event_sample.resize(B);
+    fil_draw.resize(B);
+    tick_step.resize(B);
+    kind_lanes.resize(kind_count.size() * B);
+}
+
+void BatchSimulator::Reset(int64_t rng_seed, int64_t first_trajectory, int64_t count)
+{
+    if (count < 0 || count > capacity)
+        throw DynaPlex::Error("queue_mdp::BatchSimulator::Reset: count must lie in [0, capacity]");
+    lanes = count;
+
+    std::fill(age.begin(), age.end(), 0);
+    std::fill(queue_len.begin(), queue_len.end(), 0);
+    std::fill(busy.begin(), busy.end(), 0);
+    std::fill(pool_busy.begin(), pool_busy.end(), 0);
+    std::fill(arrival_rate.begin(), arrival_rate.end(), initial_state.queue_manager.total_arrival_rate);
+    std::fill(service_rate.begin(), service_rate.end(), initial_state.server_manager.completion_tree.total());
+    std::fill(tick_cost.begin(), tick_cost.end(), 0.0);
+    std::fill(binary_cost.begin(), binary_cost.end(), 0.0);
+    std::fill(next_fil.begin(), next_fil.end(), -1);
+    std::fill(awaits_action.begin(), awaits_action.end(), 0);
+    std::fill(last_event.begin(), last_event.end(), MDP::EventCategory::Unknown);
+    std::fill(stochastic_key.begin(), stochastic_key.end(), 0);
+    std::fill(arrival_tree.begin(), arrival_tree.end(), initial_state.queue_manager.arrival_tree);
+    std::fill(completion_tree.begin(), completion_tree.end(), initial_state.server_manager.completion_tree);
+    for (auto& q : candidates) q.clear();
+    std::fill(action_counter.begin(), action_counter.end(), 0);
+    std::fill(acc_cost.begin(), acc_cost.end(), 0.0);
+    std::fill(acc_cost_rvi.begin(), acc_cost_rvi.end(), 0.0);
+    std::fill(acc_cost_gic.begin(), acc_cost_gic.end(), 0.0);
+    std::fill(acc_action_steps.begin(), acc_action_steps.end(), 0);
+    std::fill(acc_real_event_steps.begin(), acc_real_event_steps.end(), 0);
+    std::fill(acc_fil_refresh_steps.begin(), acc_fil_refresh_steps.end(), 0);
+
+    // Same event stream as EvaluatePolicyRaw gives trajectory first_trajectory + b.
+    rng.clear();
+    for (int64_t b = 0; b < count; ++b) {
+        DynaPlex::RNGProvider provider;
+        provider.SeedEventStreams(true, rng_seed, 0, first_trajectory + b);
+        rng.push_back(provider.GetEventRNG(0));
+    }
+    RebuildLaneLists();
+}
+
+MDP::FILVector BatchSimulator::LaneFIL(int64_t b) const
+{
+    MDP::FILVector fil((size_t)n_types);
+    for (int64_t n = 0; n < n_types; ++n)
+        fil[(size_t)n] = (queue_len[Row(n, b)] > 0) ? Age(n, 0, b) : -1;
+    return fil;
+}
+
+void BatchSimulator::RefreshCosts(int64_t b)
+{
+    std::array<int64_t, MDP::MaxQueueDepth> ages{};
+    double cost = 0.0, cost_binary = 0.0;
+    for (int64_t n = 0; n < n_types; ++n) {
+        const int64_t len = queue_len[Row(n, b)];
+        if (len == 0) continue;
+        for (int64_t d = 0; d < len; ++d)
+            ages[(size_t)d] = Age(n, d, b);
+        mdp.AddTypeTickCost((size_t)n, ages.data(), (size_t)len, mdp.reward_type, cost);
+        mdp.AddTypeTickCost((size_t)n, ages.data(), (size_t)len, 0, cost_binary);
+    }
+    tick_cost[(size_t)b]   = cost;
+    binary_cost[(size_t)b] = cost_binary;
+}
+
+std::array<int64_t, MDP::MaxPools> BatchSimulator::LanePoolBusy(int64_t b) const
+{
+    std::array<int64_t, MDP::MaxPools> lane_pool_busy{};
+    for (int64_t k = 0; k < n_pools; ++k)
+        lane_pool_busy[(size_t)k] = pool_busy[Row(k, b)];
+    return lane_pool_busy;
+}
+
+// ServerDynamicState::refresh_completion_leaf
+void BatchSimulator::SetCompletionLeaf(int64_t b, int64_t k, int64_t j)
+{
+    auto& tree = completion_tree[(size_t)b];
+    tree.set(MDP::ServerDynamicState::CompletionLeaf((size_t)k, (size_t)j),
+        busy[Row(pool_first_slot[(size_t)k] + j, b)] * mdp.server_static_info[(size_t)k].mu_kj[(size_t)j]);
+    service_rate[(size_t)b] = tree.total();
+}
+
+void BatchSimulator::UpdateCandidatesForType(int64_t b, int64_t n)
+{
+    const auto lane_pool_busy = LanePoolBusy(b);
+    mdp.kernels->update_actions_for_type(candidates[(size_t)b], mdp.server_static_info,
+        lane_pool_busy.data(), n, LaneFIL(b), mdp.sort_descending);
+}
+
+void BatchSimulator::UpdateCandidatesForPool(int64_t b, int64_t k)
+{
+    const auto lane_pool_busy = LanePoolBusy(b);
+    mdp.kernels->update_actions_for_pool(candidates[(size_t)b], mdp.server_static_info,
+        lane_pool_busy.data(), k, LaneFIL(b), mdp.sort_descending);
+}
+
+// Mirrors MDP::ModifyStateWithAction (candidate-queue mode).
+void BatchSimulator::ApplyAction(int64_t b, int64_t action)
+{
+    MDP::ActionQueue& queue = candidates[(size_t)b];
+    int64_t& counter = action_counter[(size_t)b];
+    const int64_t acnt = counter;
+    if (queue.empty() || acnt < 0 || acnt >= (int64_t)queue.size()) {
+        counter = 0;
+        awaits_action[(size_t)b] = 0;
+        return;
+    }
+    const MDP::Action current = queue[(size_t)acnt];
+
+    if (action == 1) {
+        // ServerDynamicState::take_action(1): assign, then drop the entries of pools that
+        // are now full; the counter becomes the number of surviving processed entries.
+        const auto& S = mdp.server_static_info;
+        const int64_t k = current.server_index;
+        const int idx = MDP::ServerDynamicState::canServeIndex(S, k, current.job_type);
+        if (idx >= 0) {
+            int64_t& slot_busy = busy[Row(pool_first_slot[(size_t)k] + idx, b)];
+            if (slot_busy < S[(size_t)k].servers) {
+                ++slot_busy;
+                ++pool_busy[Row(k, b)];
+                SetCompletionLeaf(b, k, idx);
+            }
+        }
+        int64_t new_counter = 0;
+        size_t kept = 0;
+        for (size_t i = 0; i < queue.size(); ++i) {
+            const MDP::Action a = queue[i];
+            if (MDP::ServerDynamicState::canServeIndex(S, a.server_index, a.job_type) < 0
+                || pool_busy[Row(a.server_index, b)] >= S[(size_t)a.server_index].servers)
+                continue;
+            if ((int64_t)i <= acnt) ++new_counter;
+            queue[kept++] = a;
+        }
+        queue.resize(kept);
+        counter = new_counter;
+        next_fil[(size_t)b] = current.job_type;
+        awaits_action[(size_t)b] = 0;
+        return;
+    }
+
+    if (action == 2) {
+        counter = 0;
+        awaits_action[(size_t)b] = 0;
+        return;
+    }
+
+    if (acnt + 1 >= (int64_t)queue.size()) {
+        counter = 0;
+        awaits_action[(size_t)b] = 0;
+    }
+    else
+        counter = acnt + 1;
+}
+
+double BatchSimulator::ApplyArrival(int64_t b)
+{
+    const double sample = event_sample[(size_t)b];
+    const int64_t n = (int64_t)arrival_tree[(size_t)b].find(sample);
+    if (n >= n_types) {
+        // No open bucket at this draw: GetEventType reports nothing.
+        last_event[(size_t)b] = MDP::EventCategory::Nothing;
+        awaits_action[(size_t)b] = !candidates[(size_t)b].empty();
+        return 0.0;
+    }
+
+    int64_t& len = queue_len[Row(n, b)];
+    const bool fil_changed = (len == 0);
+    if (len < depth) {
+        Age(n, len, b) = 0;
+        if (++len == depth) {
+            arrival_rate[(size_t)b] -= mdp.arrival_rates[(size_t)n];
+            arrival_tree[(size_t)b].set((size_t)n, 0.0);
+        }
+    }
+    if (fil_changed)
+        UpdateCandidatesForType(b, n);
+    action_counter[(size_t)b] = 0;
+    stochastic_key[(size_t)b] = MDP::StochasticKey({ sample, fil_draw[(size_t)b] });
+    awaits_action[(size_t)b] = !candidates[(size_t)b].empty();
+    last_event[(size_t)b] = MDP::EventCategory::Arrival;
+    RefreshCosts(b);
+    return 0.0;
+}
+
+double BatchSimulator::ApplyCompletion(int64_t b)
+{
+    const double sample = event_sample[(size_t)b];
+    const auto& tree = completion_tree[(size_t)b];
+    const size_t leaf = tree.find(sample - (arrival_tree[(size_t)b].total() + mdp.tick_rate));
+    if (leaf >= tree.Capacity()) {
+        last_event[(size_t)b] = MDP::EventCategory::Nothing;
+        awaits_action[(size_t)b] = !candidates[(size_t)b].empty();
+        return 0.0;
+    }
+
+    // ServerDynamicState::complete_job(k, job)
+    const auto& S = mdp.server_static_info;
+    const int64_t k = (int64_t)(leaf / MDP::MaxJobTypes);
+    const int64_t job = S[(size_t)k].can_serve[leaf % MDP::MaxJobTypes];
+    const int idx = MDP::ServerDynamicState::canServeIndex(S, k, job);
+    if (idx >= 0) {
+        int64_t& slot_busy = busy[Row(pool_first_slot[(size_t)k] + idx, b)];
+        if (slot_busy > 0) {
+            --slot_busy;
+            --pool_busy[Row(k, b)];
+            SetCompletionLeaf(b, k, idx);
+        }
+    }
+    UpdateCandidatesForPool(b, k);
+    action_counter[(size_t)b] = 0;
+    stochastic_key[(size_t)b] = MDP::StochasticKey({ sample, fil_draw[(size_t)b] });
+    awaits_action[(size_t)b] = !candidates[(size_t)b].empty();
+    last_event[(size_t)b] = MDP::EventCategory::Completion;
+    return 0.0;
+}
+
+// Mirrors the next_fil_job_type branch of MDP::ModifyStateWithEvent.
+double BatchSimulator::ApplyFilRefresh(int64_t b)
+{
+    const int64_t n = next_fil[(size_t)b];
+    int64_t& len = queue_len[Row(n, b)];
+    if (len == 0)
+        throw DynaPlex::Error("queue_mdp::BatchSimulator: FIL refresh of an empty queue (type "
+            + std::to_string(n) + ")");
+
+    const bool shaped = (mdp.reward_type == 2 || mdp.reward_type == 3);
+    const int64_t t_old = Age(n, 0, b);
+
+    // multi_queue::complete_job: shift up, Koole-sample the vacated bottom position
+    const bool was_full = (len == depth);
+    const int64_t old_bottom = Age(n, len - 1, b);
+    for (int64_t d = 1; d < len; ++d)
+        Age(n, d - 1, b) = Age(n, d, b);
+    --len;
+    const int64_t new_bottom = (old_bottom == 0) ? -1
+        : (int64_t)MDP::multi_queue::sample_next_fil_after_completion((int)old_bottom,
+            mdp.arrival_rates[(size_t)n], mdp.tick_rate, fil_draw[(size_t)b]);
+    if (new_bottom >= 0)
+        Age(n, len++, b) = new_bottom;
+    if (was_full && len < depth) {
+        arrival_rate[(size_t)b] += mdp.arrival_rates[(size_t)n];
+        arrival_tree[(size_t)b].set((size_t)n, mdp.arrival_rates[(size_t)n]);
+    }
+
+    double shaping_cost = 0.0;
+    if (shaped) {
+        const int64_t t_new = (len > 0) ? Age(n, 0, b) : 0;
+        shaping_cost = mdp.JobUrgency(n, t_new) - mdp.JobUrgency(n, t_old);
+    }
+
+    next_fil[(size_t)b] = -1;
+    UpdateCandidatesForType(b, n);
+    action_counter[(size_t)b] = 0;
+    stochastic_key[(size_t)b] = MDP::StochasticKey({ event_sample[(size_t)b], fil_draw[(size_t)b] });
+    awaits_action[(size_t)b] = !candidates[(size_t)b].empty();
+    last_event[(size_t)b] = MDP::EventCategory::FilRefresh;
+    RefreshCosts(b);
+    return shaping_cost;
+}
+
+void BatchSimulator::Step(std::span<const int64_t> actions, bool record)
+{
+    if (actions.size() != decision_lanes.size())
+        throw DynaPlex::Error("queue_mdp::BatchSimulator::Step: expected one action per decision lane");
+
+    const size_t B = (size_t)lanes;
+    const double U = mdp.uniformization_rate;
+    const double T = mdp.tick_rate;
+    const double step_weight = mdp.tick_rate / mdp.uniformization_rate;
+
+    // (1) draws for the lanes that incorporate an event this round
+    for (int64_t b : event_lanes) {
+        event_sample[(size_t)b] = rng[(size_t)b].genUniform() * U;
+        fil_draw[(size_t)b]     = rng[(size_t)b].genUniform();
+    }
+
+    // (2) classification, as selects so the outcome of one lane does not steer the
+    // branch predictor for the next; lanes are then bucketed by kind.
+    kind_count.fill(0);
+    for (size_t b = 0; b < B; ++b) {
+        const double s  = event_sample[b];
+        const double A  = arrival_tree[b].total();   // the bounds of MDP::GetEventType
+        const double AT = A + T;
+        uint8_t kind = (s - AT < service_rate[b]) ? (uint8_t)EventKind::Completion : (uint8_t)EventKind::Nothing;
+        kind = (s < AT) ? (uint8_t)EventKind::Tick : kind;
+        kind = (s < A) ? (uint8_t)EventKind::Arrival : kind;
+        kind = (next_fil[b] != -1) ? (uint8_t)EventKind::FilRefresh : kind;
+        kind = awaits_action[b] ? (uint8_t)EventKind::None : kind;
+        tick_step[b] = (kind == (uint8_t)EventKind::Tick) ? 1 : 0;
+        kind_lanes[kind * B + kind_count[kind]] = (int64_t)b;
+        ++kind_count[kind];
+    }
+    const auto lanes_of = [&](EventKind kind) {
+        return std::span<const int64_t>(kind_lanes.data() + (size_t)kind * B, kind_count[(size_t)kind]);
+    };
+
+    for (size_t i = 0; i < actions.size(); ++i) {
+        const int64_t b = decision_lanes[i];
+        ApplyAction(b, actions[i]);
+        if (record) ++acc_action_steps[(size_t)b];
+    }
+
+    // (3) pre-event diagnostics of the real (non-refresh) event steps
+    if (record) {
+        for (EventKind kind : { EventKind::Arrival, EventKind::Tick, EventKind::Completion, EventKind::Nothing })
+            for (int64_t b : lanes_of(kind)) {
+                acc_cost_rvi[(size_t)b] += step_weight * binary_cost[(size_t)b];
+                acc_cost_gic[(size_t)b] += step_weight * tick_cost[(size_t)b];
+                ++acc_real_event_steps[(size_t)b];
+            }
+        for (int64_t b : lanes_of(EventKind::FilRefresh))
+            ++acc_fil_refresh_steps[(size_t)b];
+    }
+
+    // (4) ticks: every tracked age of the ticking lanes advances by one
+    for (int64_t r = 0; r < n_types * depth; ++r) {
+        int64_t* row = age.data() + Row(r, 0);
+        for (size_t b = 0; b < B; ++b)
+            row[b] += tick_step[b];
+    }
+
+    // (5) outcome of the event, one kind at a time
+    for (int64_t b : lanes_of(EventKind::Tick)) {
+        RefreshCosts(b);
+        last_event[(size_t)b] = MDP::EventCategory::Tick;
+        awaits_action[(size_t)b] = !candidates[(size_t)b].empty();
+        if (record) acc_cost[(size_t)b] += tick_cost[(size_t)b];
+    }
+    for (int64_t b : lanes_of(EventKind::Nothing)) {
+        last_event[(size_t)b] = MDP::EventCategory::Nothing;
+        awaits_action[(size_t)b] = !candidates[(size_t)b].empty();
+    }
+    for (int64_t b : lanes_of(EventKind::Arrival))
+        ApplyArrival(b);
+    for (int64_t b : lanes_of(EventKind::Completion))
+        ApplyCompletion(b);
+    for (int64_t b : lanes_of(EventKind::FilRefresh)) {
+        const double cost = ApplyFilRefresh(b);
+        if (record) acc_cost[(size_t)b] += cost;
+    }
+
+    // next round: lanes awaiting an action decide, the others draw an event
+    RebuildLaneLists();
+}
+
+void BatchSimulator::RebuildLaneLists()
+{
+    const size_t B = (size_t)lanes;
+    decision_lanes.resize(B);
+    event_lanes.resize(B);
+    size_t n_decide = 0, n_event = 0;
+    for (size_t b = 0; b < B; ++b) {
+        decision_lanes[n_decide] = (int64_t)b;
+        event_lanes[n_event]     = (int64_t)b;
+        n_decide += awaits_action[b];
+        n_event  += 1 - awaits_action[b];
+    }
+    decision_lanes.resize(n_decide);
+    event_lanes.resize(n_event);
+}
+
+void BatchSimulator::GetState(int64_t lane, MDP::State& state) const
+{
+    if (lane < 0 || lane >= lanes)
+        throw DynaPlex::Error("queue_mdp::BatchSimulator::GetState: lane out of range");
+    const int64_t b = lane;
+    state = initial_state;
+
+    auto& qm = state.queue_manager;
+    for (int64_t n = 0; n < n_types; ++n) {
+        auto& q = qm.waiting[(size_t)n];
+        for (int64_t d = 0; d < queue_len[Row(n, b)]; ++d)
+            q.push_back(Age(n, d, b));
+    }
+    qm.total_arrival_rate = arrival_rate[(size_t)b];
+    qm.arrival_tree = arrival_tree[(size_t)b];
+
+    auto& sm = state.server_manager;
+    for (int64_t k = 0; k < n_pools; ++k)
+        for (size_t j = 0; j < sm.busy_on[(size_t)k].size(); ++j)
+            sm.busy_on[(size_t)k][j] = busy[Row(pool_first_slot[(size_t)k] + (int64_t)j, b)];
+    for (int64_t k = 0; k < n_pools; ++k)
+        sm.pool_busy[(size_t)k] = pool_busy[Row(k, b)];
+    sm.completion_tree = completion_tree[(size_t)b];
+    sm.action_queue = candidates[(size_t)b];
+    sm.action_counter = action_counter[(size_t)b];
+
+    state.next_fil_job_type = next_fil[(size_t)b];
+    state.last_event_category = last_event[(size_t)b];
+    state.stochastic_key = stochastic_key[(size_t)b];
+    state.cat = awaits_action[(size_t)b] ? DynaPlex::StateCategory::AwaitAction()
+                                         : DynaPlex::StateCategory::AwaitEvent();
+}
+
+void BatchSimulator::GetDecisionInputs(std::span<float> features, std::span<uint8_t> allowed) const
+{
+    const size_t rows = decision_lanes.size();
+    const size_t F = (size_t)num_features;
+    const size_t A = (size_t)num_actions;
+    if (features.size() != rows * F || allowed.size() != rows * A)
+        throw DynaPlex::Error("queue_mdp::BatchSimulator::GetDecisionInputs: spans must hold one row per decision lane");
+    for (size_t i = 0; i < rows; ++i) {
+        GetState(decision_lanes[i], query_state);
+        DynaPlex::Features row(features.subspan(i * F, F));
+        mdp.GetFeatures(query_state, row);
+        for (size_t a = 0; a < A; ++a)
+            allowed[i * A + a] = mdp.IsAllowedAction(query_state, (int64_t)a) ? 1 : 0;
+    }
+}
+
+BatchSimulator::LaneTotals BatchSimulator::Totals(int64_t lane) const
+{
+    const size_t b = (size_t)lane;
+    LaneTotals t;
+    t.cost              = acc_cost[b];
+    t.cost_rvi          = acc_cost_rvi[b];
+    t.cost_gic          = acc_cost_gic[b];
+    t.action_steps      = acc_action_steps[b];
+    t.real_event_steps  = acc_real_event_steps[b];
+    t.fil_refresh_steps = acc_fil_refresh_steps[b];
+    return t;
+}
+
+// ============================================================
+//  EvaluatePolicyBatched
+// ============================================================
+namespace {
+
+// Lockstep driver shared by the overloads: decide(sim, actions) writes one action per
+// entry of sim.DecisionLanes(); on_reset(first, count) runs after each sim.Reset, when
+// lane b starts trajectory first + b.  Per-trajectory results and their aggregation are those
+// of EvaluatePolicyRaw.
+template <typename Decide, typename OnReset>
+RawEvalResult RunBatched(const MDP& mdp, Decide&& decide, OnReset&& on_reset, int64_t n_trajectories,
+    int64_t steps_per_traj, int64_t warmup_steps, int64_t rng_seed, int64_t batch_size)
+{
+    if (n_trajectories <= 0 || batch_size <= 0)
+        throw DynaPlex::Error("EvaluatePolicyBatched: n_trajectories and batch_size must be positive");
+
+    BatchSimulator sim(mdp, std::min(batch_size, n_trajectories));
+    std::vector<double> costs_per_rvi_step((size_t)n_trajectories, 0.0);
+    std::vector<double> costs_per_rvi_step_rvi((size_t)n_trajectories, 0.0);
+    std::vector<double> costs_per_step_gic((size_t)n_trajectories, 0.0);
+    int64_t grand_action_steps      = 0;
+    int64_t grand_real_event_steps  = 0;
+    int64_t grand_fil_refresh_steps = 0;
+
+    std::vector<int64_t> actions;
+    for (int64_t first = 0; first < n_trajectories; first += batch_size) {
+        const int64_t count = std::min(batch_size, n_trajectories - first);
+        sim.Reset(rng_seed, first, count);
+        on_reset(first, count);
+        for (int64_t s = 0; s < warmup_steps + steps_per_traj; ++s) {
+            actions.resize(sim.DecisionLanes().size());
+            if (!actions.empty())
+                decide(sim, std::span<int64_t>(actions));
+            sim.Step(actions, s >= warmup_steps);
+        }
+
+        for (int64_t b = 0; b < count; ++b) {
+            const BatchSimulator::LaneTotals t = sim.Totals(b);
+            const size_t i = (size_t)(first + b);
+            const int64_t rvi_steps = t.action_steps + t.real_event_steps;
+            costs_per_rvi_step[i]     = (rvi_steps > 0) ? t.cost     / static_cast<double>(rvi_steps) : 0.0;
+            costs_per_rvi_step_rvi[i] = (rvi_steps > 0) ? t.cost_rvi / static_cast<double>(rvi_steps) : 0.0;
+            costs_per_step_gic[i]     = (rvi_steps > 0) ? t.cost_gic / static_cast<double>(rvi_steps) : 0.0;
+            grand_action_steps      += t.action_steps;
+            grand_real_event_steps  += t.real_event_steps;
+            grand_fil_refresh_steps += t.fil_refresh_steps;
+        }
+    }
+
+    double mean = 0.0;
+    for (double c : costs_per_rvi_step) mean += c;
+    mean /= static_cast<double>(n_trajectories);
+
+    double mean_rvi = 0.0;
+    for (double c : costs_per_rvi_step_rvi) mean_rvi += c;
+    mean_rvi /= static_cast<double>(n_trajectories);
+
+    double var = 0.0;
+    for (double c : costs_per_rvi_step) var += (c - mean) * (c - mean);
+    if (n_trajectories > 1)
+        var /= static_cast<double>(n_trajectories - 1);
+    const double std_error = std::sqrt(var / static_cast<double>(n_trajectories));
+
+    const double mean_cost_per_event = (grand_real_event_steps > 0)
+        ? (mean * static_cast<double>(grand_action_steps + grand_real_event_steps))
+          / static_cast<double>(grand_real_event_steps)
+        : 0.0;
+
+    double mean_gic = 0.0;
+    for (double c : costs_per_step_gic) mean_gic += c;
+    mean_gic /= static_cast<double>(n_trajectories);
+
+    RawEvalResult result;
+    result.mean_cost_per_rvi_step     = mean;
+    result.mean_cost_per_rvi_step_rvi = mean_rvi;
+    result.mean_cost_per_event        = mean_cost_per_event;
+    result.mean_cost_per_step_gic     = mean_gic;
+    result.std_error                  = std_error;
+    result.total_action_steps         = grand_action_steps;
+    result.total_real_event_steps     = grand_real_event_steps;
+    result.total_fil_refresh_steps    = grand_fil_refresh_steps;
+    return result;
+}
+
+} // anonymous namespace
+
+RawEvalResult EvaluatePolicyBatched(
+    const MDP&         mdp,
+    const BatchPolicy& policy,
+    int64_t n_trajectories,
+    int64_t steps_per_traj,
+    int64_t warmup_steps,
+    int64_t rng_seed,
+    int64_t batch_size)
+{
+    std::vector<float>   features;
+    std::vector<uint8_t> allowed;
+    auto decide = [&](const BatchSimulator& sim, std::span<int64_t> actions) {
+        const size_t F = (size_t)sim.NumFeatures();
+        const size_t A = (size_t)sim.NumActions();
+        features.resize(actions.size() * F);
+        allowed.resize(actions.size() * A);
+        sim.GetDecisionInputs(features, allowed);
+        policy(BatchDecision{ features, allowed, (int64_t)F, (int64_t)A, actions });
+    };
+    return RunBatched(mdp, decide, [](int64_t, int64_t) {},
+        n_trajectories, steps_per_traj, warmup_steps, rng_seed, batch_size);
+}
+
+RawEvalResult EvaluatePolicyBatched(
+    const MDP&                                  mdp,
+    std::function<int64_t(const MDP::State&)>   get_action,
+    int64_t n_trajectories,
+    int64_t steps_per_traj,
+    int64_t warmup_steps,
+    int64_t rng_seed,
+    int64_t batch_size)
+{
+    MDP::State state = mdp.GetInitialState();
+    auto decide = [&](const BatchSimulator& sim, std::span<int64_t> actions) {
+        const auto& lanes = sim.DecisionLanes();
+        for (size_t i = 0; i < actions.size(); ++i) {
+            sim.GetState(lanes[i], state);
+            actions[i] = get_action(state);
+        }
+    };
+    return RunBatched(mdp, decide, [](int64_t, int64_t) {},
+        n_trajectories, steps_per_traj, warmup_steps, rng_seed, batch_size);
+}
+
+RawEvalResult EvaluatePolicyBatched(
+    const MDP&              mdp,
+    const DynaPlex::Policy& policy,
+    int64_t n_trajectories,
+    int64_t steps_per_traj,
+    int64_t warmup_steps,
+    int64_t rng_seed,
+    int64_t batch_size)
+{
+    // One trajectory per lane, holding a state adapter that is overwritten in place (as in the
+    // EvaluatePolicyRaw Policy overload) and the policy RNG of the lane's current trajectory:
+    // seeded like the lane's event stream, so the actions of a randomized policy do not depend
+    // on batch_size or on the row a lane gets.  The deciding lanes' trajectories are moved into
+    // rows for the SetAction call and moved back afterwards.
+    std::vector<DynaPlex::Trajectory> lane_trajs;
+    std::vector<DynaPlex::Trajectory> rows;
+    auto on_reset = [&](int64_t first, int64_t count) {
+        while ((int64_t)lane_trajs.size() < count) {
+            DynaPlex::Trajectory& traj = lane_trajs.emplace_back();
+            traj.Reset(std::make_unique<DynaPlex::Erasure::StateAdapter<MDP::State>>(
+                mdp.int_hash, mdp.GetInitialState()));
+        }
+        for (int64_t b = 0; b < count; ++b) {
+            DynaPlex::Trajectory& traj = lane_trajs[(size_t)b];
+            traj.ExternalIndex = first + b;
+            traj.RNGProvider.SeedEventStreams(true, rng_seed, 0, first + b);
+        }
+    };
+    auto decide = [&](const BatchSimulator& sim, std::span<int64_t> actions) {
+        const auto& lanes = sim.DecisionLanes();
+        rows.clear();
+        for (size_t i = 0; i < actions.size(); ++i) {
+            DynaPlex::Trajectory& traj = rows.emplace_back(std::move(lane_trajs[(size_t)lanes[i]]));
+            auto* adapter = static_cast<DynaPlex::Erasure::StateAdapter<MDP::State>*>(traj.GetState().get());
+            sim.GetState(lanes[i], adapter->state);
+            traj.Category = DynaPlex::StateCategory::AwaitAction();
+        }
+        policy->SetAction(std::span<DynaPlex::Trajectory>(rows));
+        for (size_t i = 0; i < actions.size(); ++i) {
+            actions[i] = rows[i].NextAction;
+            lane_trajs[(size_t)lanes[i]] = std::move(rows[i]);
+        }
+    };
+    return RunBatched(mdp, decide, on_reset,
+        n_trajectories, steps_per_traj, warmup_steps, rng_seed, batch_size);
+}
+
+} // namespace DynaPlex::Models::queue_mdp
@@ -8,6 +8,13 @@
 // The continuous simulator replaces this with exact exponential clocks:
 //   inter-arrival times ~ Exp(lambda_n), service times ~ Exp(mu).
 //
+// Every individual server has its own completion clock (a pool with
+// servers = 3 can have three jobs in service at once, as in the discrete
+// model's busy_on counts).  The pending clocks -- one arrival per job type,
+// one completion per busy server and the next tick -- live in a
+// DynaPlex::EventHeap, so finding the next event is O(log #clocks) instead
+// of a scan over all of them.
+//
 // Decision occasions in the discrete MDP
 // ---------------------------------------
 // Decisions (AwaitAction) are triggered at:
@@ -31,13 +38,24 @@
 //
 // Cost is integrated exactly between consecutive events (piecewise
 // linear sojourn time inside each inter-event interval).
+//
+// Trajectories are independent: trajectory i draws its events and its
+// policy's random numbers from DynaPlex::RNG streams keyed on (rng_seed, i),
+// laid out as in a Trajectory seeded with RNGProvider::SeedEventStreams, so
+// they can be spread over threads with Parallel::parallel_compute and the
+// result does not depend on the thread count.  Each thread reuses one query
+// State for all its decisions.
 
 #include "mdp.h"
-#include <random>
+#include "dynaplex/modelling/eventheap.h"
+#include "dynaplex/erasure/stateadapter.h"
+#include "dynaplex/parallel_execute.h"
+#include "dynaplex/rng.h"
 #include <limits>
 #include <cmath>
-#include <numeric>
-#include <stdexcept>
+#include <memory>
+#include <thread>
+#include <tuple>
 #include <iostream>
 #include <sstream>
 #include <iomanip>
@@ -49,6 +67,8 @@ namespace DynaPlex::Models::queue_mdp {
 // ============================================================
 namespace {
 
+constexpr double INF = std::numeric_limits<double>::infinity();
+
 // Exact integral of  c * max(0, tau(t) - T_real)  over [0, dt]
 // where tau(t) = tau0 + t  (sojourn time grows linearly between events).
 double IntegrateQL(double tau0, double T_real, double c, double dt)
@@ -75,304 +95,401 @@ double IntegrateBinary(double tau0, double T_real, double c, double dt)
     return c * (dt - t_cross);
 }
 
-// Build an AwaitAction MDP::State from the continuous sim variables.
-// Called at every scheduling decision point so the policy can be queried.
-//
-// FIL values are obtained by discretising exact sojourn times:
-//   f_n = floor(tau_n * tick_rate),  or -1 if queue[n] is empty.
-//
-// The busy_on[][] configuration mirrors the current server assignments.
-MDP::State BuildQueryState(
-    const MDP&                              mdp,
-    double                                  t,
-    const std::vector<double>&              server_finish,
-    const std::vector<int64_t>&             server_type,
-    const std::vector<std::deque<double>>&  queues)
-{
-    MDP::State s;
+// One pending clock of the continuous system.  Ties are broken by kind and
+// then index (completions before arrivals before the tick, lower index
+// first), the order the linear scan used to resolve them in.
+struct Clock {
+    enum Kind : int { Completion = 0, Arrival = 1, Tick = 2 };
+
+    double  time;
+    int     kind;
+    int64_t index;   // server (Completion), job type (Arrival), unused (Tick)
 
-    // --- Queue manager: set discretised FIL values ---
-    s.queue_manager.initialize(
-        mdp.n_jobs, mdp.tick_rate, mdp.arrival_rates, mdp.max_queue_depth);
+    bool operator<(const Clock& other) const {
+        return std::tie(time, kind, index) < std::tie(other.time, other.kind, other.index);
+    }
+    bool operator>(const Clock& other) const { return other < *this; }
+};
+
+// State of one continuous-time trajectory: waiting jobs, individual servers
+// and the heap of pending clocks.
+class ContinuousSystem {
+public:
+    ContinuousSystem(const MDP& mdp, DynaPlex::RNG& rng)
+        : mdp(mdp), rng(rng), queues((size_t)mdp.n_jobs)
+    {
+        // The decision loop speaks the candidate-queue protocol (action 1 = serve the current candidate).
+        if (mdp.per_event_mode || mdp.joint_mode)
+            throw DynaPlex::Error("queue_mdp::MDP continuous simulator: only action_mode \"candidate_queue\" is supported");
+        const auto& info = mdp.server_static_info;
+        busy_on.resize(info.size());
+        for (size_t k = 0; k < info.size(); ++k) {
+            busy_on[k].assign(info[k].can_serve.size(), 0);
+            for (int64_t i = 0; i < info[k].servers; ++i) {
+                server_pool.push_back((int64_t)k);
+                server_type.push_back(-1);
+            }
+        }
+
+        for (int64_t n = 0; n < mdp.n_jobs; ++n)
+            Schedule(Clock::Arrival, n, ExpSample(mdp.arrival_rates[(size_t)n]));
+        // Tick events fire at regular intervals of 1/tick_rate physical time.
+        // They mirror the discrete system's FIL-advance events: after a tick
+        // we re-query the policy if there are idle servers and waiting jobs,
+        // exactly as the discrete handler does when action_queue is non-empty.
+        tick_interval = (mdp.tick_rate > 0.0) ? 1.0 / mdp.tick_rate : INF;
+        Schedule(Clock::Tick, -1, tick_interval);
+    }
 
-    for (int64_t n = 0; n < mdp.n_jobs; ++n) {
-        if (queues[(size_t)n].empty()) {
-            s.queue_manager.set_fil(n, -1LL);
+    // Earliest pending clock; NextTime() is INF once nothing is scheduled.
+    const Clock& NextClock() const { return clocks.first(); }
+    double NextTime() const { return clocks.begin() == clocks.end() ? INF : clocks.first().time; }
+
+    // Advances to the earliest pending clock and applies it: an arrival joins
+    // the back of its queue, a completion frees its server, a tick only
+    // reschedules itself (sojourn times are derived from the clock).
+    Clock Advance() {
+        const Clock c = clocks.first();
+        clocks.pop();
+        t = c.time;
+        if (c.kind == Clock::Completion) {
+            const int64_t pool = server_pool[(size_t)c.index];
+            const int     slot = Slot(pool, server_type[(size_t)c.index]);
+            if (slot >= 0)
+                --busy_on[(size_t)pool][(size_t)slot];
+            server_type[(size_t)c.index] = -1;
+        } else if (c.kind == Clock::Arrival) {
+            queues[(size_t)c.index].push_back(t);
+            Schedule(Clock::Arrival, c.index, ExpSample(mdp.arrival_rates[(size_t)c.index]));
         } else {
-            double tau = t - queues[(size_t)n].front();  // exact sojourn time
-            int64_t f  = static_cast<int64_t>(tau * mdp.tick_rate);  // floor
-            s.queue_manager.set_fil(n, f);
+            Schedule(Clock::Tick, -1, tick_interval);
         }
+        return c;
     }
 
-    // --- Server manager: mirror busy_on[][] from continuous state ---
-    s.server_manager.initialize(&mdp.server_static_info, mdp.n_jobs);
-    for (size_t k = 0; k < server_finish.size(); ++k) {
-        if (server_type[k] >= 0) {
-            int64_t job = server_type[k];
-            int idx = MDP::ServerDynamicState::canServeIndex(
-                mdp.server_static_info, (int64_t)k, job);
-            if (idx >= 0)
-                s.server_manager.busy_on[k][(size_t)idx] = 1;
+    // Starts service of the oldest waiting job of type job on the lowest
+    // idle server of pool k; returns the completion time.
+    double Assign(int64_t k, int64_t job) {
+        if (!queues[(size_t)job].empty())
+            queues[(size_t)job].pop_front();
+
+        int64_t server = 0;
+        while (server_pool[(size_t)server] != k || server_type[(size_t)server] >= 0)
+            if (++server == (int64_t)server_pool.size())
+                throw DynaPlex::Error("queue_mdp::MDP::SimulateContinuous - no idle server in pool " + std::to_string(k));
+        server_type[(size_t)server] = job;
+
+        const int slot = Slot(k, job);
+        double mu = 0.4;
+        if (slot >= 0) {
+            ++busy_on[(size_t)k][(size_t)slot];
+            mu = mdp.server_static_info[(size_t)k].mu_kj[(size_t)slot];
         }
+        return Schedule(Clock::Completion, server, ExpSample(mu));
     }
 
-    // --- Generate the FIFO-ordered action queue and set action counter ---
-    s.server_manager.generate_actions(s.queue_manager.get_FIL_waiting(), mdp.cost_rates, mdp.sort_descending);
-    s.server_manager.set_action_counter(0);
-    s.server_manager.update_total_service_rate();
-    s.next_fil_job_type = -1;
-    s.cat = DynaPlex::StateCategory::AwaitAction();
-    return s;
-}
+    // Overwrites s with the canonical AwaitAction state of the current
+    // continuous state, so the policy can be queried.  s is reused across
+    // decisions: queue and server managers only use inline storage.
+    //
+    // FIL values are obtained by discretising exact sojourn times:
+    //   f_n = floor(tau_n * tick_rate),  or -1 if queue[n] is empty.
+    // busy_on[][] holds the number of servers of each pool per served type.
+    void FillQueryState(MDP::State& s) const {
+        s.queue_manager.initialize(mdp.n_jobs, mdp.tick_rate, mdp.arrival_rates, mdp.max_queue_depth);
+        for (int64_t n = 0; n < mdp.n_jobs; ++n)
+            s.queue_manager.set_fil(n, Fil(n));
+
+        s.server_manager.initialize(&mdp.server_static_info, mdp.n_jobs);
+        for (size_t k = 0; k < busy_on.size(); ++k)
+            for (size_t j = 0; j < busy_on[k].size(); ++j)
+                s.server_manager.busy_on[k][j] = busy_on[k][j];
+
+        // pool_busy must be current before the candidate queue is built
+        s.server_manager.update_total_service_rate();
+        mdp.BuildCandidates(s);
+        s.server_manager.set_action_counter(0);
+        s.next_fil_job_type = -1;
+        s.cat = DynaPlex::StateCategory::AwaitAction();
+    }
 
-} // anonymous namespace
+    double Now() const { return t; }
 
+    // Exact sojourn time of the oldest waiting job of type n, -1 if none.
+    double Sojourn(int64_t n) const {
+        return queues[(size_t)n].empty() ? -1.0 : t - queues[(size_t)n].front();
+    }
 
-// ============================================================
-//  MDP::SimulateContinuous
-// ============================================================
-MDP::ContinuousSimResult MDP::SimulateContinuous(
-    std::function<int64_t(const State&)> policy_fn,
-    int    n_traj,
-    double t_max,
-    double t_warmup) const
-{
-    constexpr double INF = std::numeric_limits<double>::infinity();
-    const int64_t K = (int64_t)server_static_info.size();
-    const int64_t N = n_jobs;
+    int64_t Fil(int64_t n) const {
+        return queues[(size_t)n].empty() ? -1LL : static_cast<int64_t>(Sojourn(n) * mdp.tick_rate);
+    }
 
-    // Physical deadline for each type  (due_times[n] is in ticks)
-    std::vector<double> T_real(N, INF);
-    for (int64_t n = 0; n < N; ++n)
-        if (tick_rate > 0.0 && n < (int64_t)due_times.size())
-            T_real[(size_t)n] = due_times[(size_t)n] / tick_rate;
-
-    std::vector<double> per_time_results;
-    std::vector<double> per_event_results;
-    std::vector<long long> events_per_traj;
-    std::vector<long long> decisions_per_traj;
-    per_time_results.reserve(n_traj);
-    per_event_results.reserve(n_traj);
-
-    for (int traj = 0; traj < n_traj; ++traj) {
-
-        std::mt19937_64 rng(42ULL + (uint64_t)traj);
-
-        // Sample from Exp(rate); returns INF if rate == 0
-        auto exp_sample = [&](double rate) -> double {
-            if (rate <= 0.0) return INF;
-            std::exponential_distribution<double> dist(rate);
-            return dist(rng);
-        };
-
-        // ---- Continuous state ----
-        std::vector<double>             server_finish(K, INF);   // completion time; INF = idle
-        std::vector<int64_t>            server_type(K, -1);      // type being served; -1 = idle
-        std::vector<std::deque<double>> queues(N);                // waiting jobs: arrival times, oldest first
-        std::vector<double>             next_arrival(N);          // time of next arrival per type
-
-        for (int64_t n = 0; n < N; ++n)
-            next_arrival[(size_t)n] = exp_sample(arrival_rates[(size_t)n]);
+    const std::deque<double>& Queue(int64_t n) const { return queues[(size_t)n]; }
+    int64_t NumServers() const { return (int64_t)server_pool.size(); }
+    int64_t ServerPool(int64_t server) const { return server_pool[(size_t)server]; }
+    int64_t ServerType(int64_t server) const { return server_type[(size_t)server]; }
 
-        // Tick events fire at regular intervals of 1/tick_rate physical time.
-        // They mirror the discrete system's FIL-advance events: after a tick
-        // we re-query the policy if there are idle servers and waiting jobs,
-        // exactly as the discrete handler does when action_queue is non-empty.
-        const double tick_interval = (tick_rate > 0.0) ? 1.0 / tick_rate : INF;
-        double next_tick = tick_interval;   // time of the next tick event
-
-        // ---- Statistics (accumulated after warmup) ----
-        double    cost_accum  = 0.0;
-        double    time_accum  = 0.0;
-        long long n_events    = 0;
-        long long n_decisions = 0;
-        bool      recording   = false;   // true once t >= t_warmup
-        double    t           = 0.0;
-
-        // ---- Cost integrator: accumulate exact cost over [t, t+dt] ----
-        auto add_cost = [&](double dt) {
-            for (int64_t n = 0; n < N; ++n) {
-                if (queues[(size_t)n].empty()) continue;
-                double tau0 = t - queues[(size_t)n].front();
-                double c    = cost_rates[(size_t)n];
-                if (reward_type == 1)
-                    cost_accum += IntegrateQL    (tau0, T_real[(size_t)n], c, dt);
-                else
-                    cost_accum += IntegrateBinary(tau0, T_real[(size_t)n], c, dt);
-            }
-            time_accum += dt;
-        };
-
-        // ---- Assignment helper ----
-        // Processes all assignment decisions at the current event time.
-        //
-        // Design: mirrors the discrete MDP exactly.  In the discrete chain,
-        // after each action=1 the system enters an AwaitEvent FIL-refresh step
-        // before the next AwaitAction.  That refresh re-queries generate_actions
-        // with the updated queue state (the assigned job is now absent).
-        // Here we replicate that by rebuilding the query state from the updated
-        // continuous variables after every assignment (outer for-loop).
-        // The inner while-loop handles skip decisions (action=0) until the first
-        // assignment or until all candidates are exhausted.
-        auto make_assignments = [&]() {
-            for (;;) {
-                // Rebuild from current continuous state (post last assignment)
-                State s = BuildQueryState(*this, t, server_finish, server_type, queues);
-                if (s.server_manager.action_queue.empty()) break;
-
-                bool assigned = false;
-                while (s.server_manager.get_action_counter()
-                       < (int64_t)s.server_manager.action_queue.size())
-                {
-                    int64_t action = policy_fn(s);
-                    if (recording) ++n_decisions;
-
-                    if (action == 1) {
-                        int64_t ac  = s.server_manager.get_action_counter();
-                        int64_t k   = s.server_manager.action_queue[(size_t)ac].server_index;
-                        int64_t job = s.server_manager.action_queue[(size_t)ac].job_type;
-
-                        // Mirror to continuous state: dequeue job, start service
-                        if (!queues[(size_t)job].empty())
-                            queues[(size_t)job].pop_front();
-                        server_type[(size_t)k] = job;
-
-                        int idx = ServerDynamicState::canServeIndex(
-                            server_static_info, k, job);
-                        double mu = (idx >= 0)
-                                    ? server_static_info[(size_t)k].mu_kj[(size_t)idx]
-                                    : 0.4;
-                        server_finish[(size_t)k] = t + exp_sample(mu);
-
-                        assigned = true;
-                        break;  // rebuild after this assignment (FIL-refresh step)
-                    }
-
-                    s.server_manager.take_action(0);   // skip: advance counter
-                }
+private:
+    // Sample from Exp(rate); returns INF if rate == 0
+    double ExpSample(double rate) {
+        if (rate <= 0.0) return INF;
+        return -std::log1p(-rng.genUniform()) / rate;
+    }
 
-                if (!assigned) break;  // all candidates skipped → done
-            }
-        };
+    double Schedule(int kind, int64_t index, double delay) {
+        const double time = t + delay;
+        if (time < INF)
+            clocks.push(Clock{ time, kind, index });
+        return time;
+    }
 
-        // ---- Main event loop ----
-        const double t_end = t_warmup + t_max;
+    int Slot(int64_t k, int64_t job) const {
+        return MDP::ServerDynamicState::canServeIndex(mdp.server_static_info, k, job);
+    }
 
-        while (t < t_end) {
+    const MDP&     mdp;
+    DynaPlex::RNG& rng;
+    double         t = 0.0;
+    double         tick_interval = INF;
+
+    std::vector<std::deque<double>>   queues;        // waiting jobs: arrival times, oldest first
+    std::vector<int64_t>              server_pool;   // pool of each individual server
+    std::vector<int64_t>              server_type;   // type in service; -1 = idle
+    std::vector<std::vector<int64_t>> busy_on;       // busy_on[k][j]: servers of pool k serving can_serve[j]
+    DynaPlex::EventHeap<Clock>        clocks;
+};
+
+// Processes all assignment decisions at the current event time and returns
+// the number of policy queries.  The observer sees every decision before it
+// is applied (Decision) and the completion time of every assignment
+// (Assigned); SimulateTrajectory passes a no-op, TraceContinuous prints.
+//
+// Design: mirrors the discrete MDP exactly.  In the discrete chain,
+// after each action=1 the system enters an AwaitEvent FIL-refresh step
+// before the next AwaitAction.  That refresh re-queries generate_actions
+// with the updated queue state (the assigned job is now absent).
+// Here we replicate that by refilling the query state from the updated
+// continuous variables after every assignment (outer for-loop).
+// The inner while-loop handles skip decisions (action=0) until the first
+// assignment or until all candidates are exhausted.
+template <typename PolicyFn, typename Observer>
+int64_t MakeAssignments(ContinuousSystem& system, MDP::State& query, PolicyFn& policy_fn, Observer& observer)
+{
+    int64_t n_queries = 0;
+    for (;;) {
+        system.FillQueryState(query);
+        auto& sm = query.server_manager;
+        if (sm.action_queue.empty()) break;
+
+        bool assigned = false;
+        while (sm.get_action_counter() < (int64_t)sm.action_queue.size()) {
+            const int64_t action = policy_fn(static_cast<const MDP::State&>(query));
+            ++n_queries;
+
+            const auto& a = sm.action_queue[(size_t)sm.get_action_counter()];
+            observer.Decision(a.server_index, a.job_type, action);
+            if (action == 1) {
+                observer.Assigned(system.Assign(a.server_index, a.job_type));
+                assigned = true;
+                break;  // refill after this assignment (FIL-refresh step)
+            }
+            sm.take_action(0);   // skip: advance counter
+        }
 
-            // Find the next event: earliest among server completions,
-            // arrivals, and the next periodic tick.
-            // win_kind: 0 = arrival, 1 = completion, 2 = tick
-            double  next_t   = INF;
-            int     win_kind = -1;
-            int64_t win_idx  = -1;
+        if (!assigned) break;  // all candidates skipped -> done
+    }
+    return n_queries;
+}
 
-            for (int64_t k = 0; k < K; ++k) {
-                if (server_finish[(size_t)k] < next_t) {
-                    next_t   = server_finish[(size_t)k];
-                    win_kind = 1;
-                    win_idx  = k;
-                }
-            }
-            for (int64_t n = 0; n < N; ++n) {
-                if (next_arrival[(size_t)n] < next_t) {
-                    next_t   = next_arrival[(size_t)n];
-                    win_kind = 0;
-                    win_idx  = n;
-                }
-            }
-            if (next_tick < next_t) {
-                next_t   = next_tick;
-                win_kind = 2;
-                win_idx  = -1;
-            }
+struct SilentObserver {
+    void Decision(int64_t, int64_t, int64_t) {}
+    void Assigned(double) {}
+};
+
+struct TrajectoryResult {
+    bool      valid       = false;
+    double    per_time    = 0.0;
+    double    per_event   = 0.0;
+    long long events      = 0;
+    long long decisions   = 0;
+};
+
+// Event stream of trajectory traj: the stream RNGProvider::GetEventRNG(0) returns
+// after SeedEventStreams(true, rng_seed, 0, traj), so it never coincides with the
+// policy stream (index 0) of the same trajectory.
+DynaPlex::RNG TrajectoryEventRNG(int64_t rng_seed, int64_t traj)
+{
+    return DynaPlex::RNG(true, rng_seed, 0, traj, 2);
+}
 
-            // Clamp to simulation end so we don't overshoot t_end
-            bool sentinel = (next_t >= t_end);
-            if (sentinel) next_t = t_end;
-
-            double dt = next_t - t;
-
-            // Integrate cost over [t, next_t].
-            // On the first interval that straddles the warmup boundary,
-            // start recording from t_warmup only.
-            if (!recording && next_t >= t_warmup) {
-                recording = true;
-                double t_save = t;
-                t = t_warmup;
-                add_cost(next_t - t_warmup);
-                t = t_save;
-            } else if (recording) {
-                add_cost(dt);
-            }
+// Policy callables for SimulateTrajectories: BeginTrajectory(traj) is called before
+// trajectory traj is simulated, then the object is queried like a function.
+// policy_fn is shared by all threads and has no RNG of its own.
+struct SharedPolicy {
+    const std::function<int64_t(const MDP::State&)>& policy_fn;
+    void BeginTrajectory(int64_t) {}
+    int64_t operator()(const MDP::State& s) const { return policy_fn(s); }
+};
+
+// One query trajectory per thread, as in EvaluatePolicyRawParallel; its policy
+// RNG is reseeded per trajectory, so randomized policies do not depend on how
+// trajectories are split over threads.
+struct TrajectoryPolicy {
+    const DynaPlex::Policy& policy;
+    int64_t rng_seed;
+    std::unique_ptr<DynaPlex::Trajectory> action_traj;
+
+    TrajectoryPolicy(const MDP& mdp, const DynaPlex::Policy& policy, int64_t rng_seed)
+        : policy{ policy }, rng_seed{ rng_seed }, action_traj{ std::make_unique<DynaPlex::Trajectory>() }
+    {
+        action_traj->RNGProvider.SeedEventStreams(true, rng_seed, 0, 0);
+        action_traj->Reset(
+            std::make_unique<DynaPlex::Erasure::StateAdapter<MDP::State>>(mdp.int_hash, mdp.GetInitialState()));
+    }
+    void BeginTrajectory(int64_t traj) { action_traj->RNGProvider.SeedEventStreams(true, rng_seed, 0, traj); }
+    int64_t operator()(const MDP::State& s) {
+        auto* adapter = static_cast<DynaPlex::Erasure::StateAdapter<MDP::State>*>(action_traj->GetState().get());
+        adapter->state = s;
+        action_traj->Category = DynaPlex::StateCategory::AwaitAction();
+        policy->SetAction(std::span<DynaPlex::Trajectory>(action_traj.get(), 1));
+        return action_traj->NextAction;
+    }
+};
 
-            t = next_t;
-
-            if (sentinel) break;
-
-            // Process the winning event
-            if (win_kind == 1) {
-                // Service completion at pool win_idx
-                server_finish[(size_t)win_idx] = INF;
-                server_type[(size_t)win_idx]   = -1;
-                // Real event: count and make fresh assignment decisions
-                if (recording) ++n_events;
-                make_assignments();
-            } else if (win_kind == 0) {
-                // Arrival of type win_idx: job joins back of waiting queue
-                queues[(size_t)win_idx].push_back(t);
-                next_arrival[(size_t)win_idx] = t + exp_sample(arrival_rates[(size_t)win_idx]);
-                // Real event: count and make fresh assignment decisions
-                if (recording) ++n_events;
-                make_assignments();
-            } else {
-                // Tick event: sojourn times advance by tick_interval.
-                // No queue changes — cost was already integrated continuously.
-                // Re-query the policy so the discrete system's "reconsider
-                // after skip" behaviour is faithfully reproduced.
-                next_tick += tick_interval;
-                make_assignments();   // no-op if all servers busy or queues empty
-            }
+// Simulates trajectory traj over [0, t_warmup + t_max] and integrates the
+// cost after warmup.
+template <typename PolicyFn>
+TrajectoryResult SimulateTrajectory(const MDP& mdp, PolicyFn& policy_fn, MDP::State& query,
+    const std::vector<double>& T_real, int64_t traj, double t_max, double t_warmup, int64_t rng_seed)
+{
+    DynaPlex::RNG rng = TrajectoryEventRNG(rng_seed, traj);
+    policy_fn.BeginTrajectory(traj);
+    ContinuousSystem system(mdp, rng);
+
+    // ---- Statistics (accumulated after warmup) ----
+    double    cost_accum  = 0.0;
+    double    time_accum  = 0.0;
+    long long n_events    = 0;
+    long long n_decisions = 0;
+    bool      recording   = false;   // true once t >= t_warmup
+
+    // ---- Cost integrator: accumulate exact cost over [from, from+dt] ----
+    auto add_cost = [&](double from, double dt) {
+        for (int64_t n = 0; n < mdp.n_jobs; ++n) {
+            const auto& q = system.Queue(n);
+            if (q.empty()) continue;
+            double tau0 = from - q.front();
+            double c    = mdp.cost_rates[(size_t)n];
+            if (mdp.reward_type == 1)
+                cost_accum += IntegrateQL    (tau0, T_real[(size_t)n], c, dt);
+            else
+                cost_accum += IntegrateBinary(tau0, T_real[(size_t)n], c, dt);
         }
-
-        // Store trajectory results
-        if (time_accum > 0.0) {
-            per_time_results.push_back(cost_accum / time_accum);
-            per_event_results.push_back(
-                n_events > 0 ? cost_accum / (double)n_events : 0.0);
-            events_per_traj.push_back(n_events);
-            decisions_per_traj.push_back(n_decisions);
+        time_accum += dt;
+    };
+    SilentObserver silent;
+
+    // ---- Main event loop ----
+    const double t_end = t_warmup + t_max;
+
+    while (system.Now() < t_end) {
+        const double t = system.Now();
+
+        // Clamp to simulation end so we don't overshoot t_end
+        double next_t   = system.NextTime();
+        bool   sentinel = (next_t >= t_end);
+        if (sentinel) next_t = t_end;
+
+        // Integrate cost over [t, next_t].
+        // On the first interval that straddles the warmup boundary,
+        // start recording from t_warmup only.
+        if (!recording && next_t >= t_warmup) {
+            recording = true;
+            add_cost(t_warmup, next_t - t_warmup);
+        } else if (recording) {
+            add_cost(t, next_t - t);
         }
+
+        if (sentinel) break;
+
+        // Arrivals and completions are real events; a tick only re-queries
+        // the policy so the discrete system's "reconsider after skip"
+        // behaviour is reproduced (no-op if all servers busy or queues empty).
+        const Clock c = system.Advance();
+        if (recording && c.kind != Clock::Tick) ++n_events;
+        const int64_t n_queries = MakeAssignments(system, query, policy_fn, silent);
+        if (recording) n_decisions += n_queries;
+    }
+
+    TrajectoryResult res;
+    if (time_accum > 0.0) {
+        res.valid     = true;
+        res.per_time  = cost_accum / time_accum;
+        res.per_event = n_events > 0 ? cost_accum / (double)n_events : 0.0;
+        res.events    = n_events;
+        res.decisions = n_decisions;
     }
+    return res;
+}
+
+// Runs n_traj trajectories on num_threads threads.  make_policy_fn() is
+// called once per thread and returns the policy object (see SharedPolicy)
+// that thread queries.
+template <typename MakePolicyFn>
+MDP::ContinuousSimResult SimulateTrajectories(const MDP& mdp, MakePolicyFn&& make_policy_fn,
+    int n_traj, double t_max, double t_warmup, int64_t rng_seed, int64_t num_threads)
+{
+    if (num_threads <= 0)
+        num_threads = (int64_t)std::thread::hardware_concurrency();
+
+    // Physical deadline for each type  (due_times[n] is in ticks)
+    std::vector<double> T_real((size_t)mdp.n_jobs, INF);
+    for (int64_t n = 0; n < mdp.n_jobs; ++n)
+        if (mdp.tick_rate > 0.0 && n < (int64_t)mdp.due_times.size())
+            T_real[(size_t)n] = mdp.due_times[(size_t)n] / mdp.tick_rate;
+
+    std::vector<TrajectoryResult> results((size_t)std::max(n_traj, 0));
+    auto work = [&](std::span<TrajectoryResult> span, int64_t offset) {
+        auto policy_fn = make_policy_fn();
+        MDP::State query = mdp.GetInitialState();
+        for (size_t j = 0; j < span.size(); ++j)
+            span[j] = SimulateTrajectory(mdp, policy_fn, query, T_real,
+                offset + (int64_t)j, t_max, t_warmup, rng_seed);
+    };
+    if (!results.empty())
+        DynaPlex::Parallel::parallel_compute<TrajectoryResult>(results, work, num_threads);
 
     // ---- Aggregate across trajectories ----
-    const int M = (int)per_time_results.size();
+    std::vector<const TrajectoryResult*> valid;
+    for (const auto& r : results)
+        if (r.valid) valid.push_back(&r);
+
+    const int M = (int)valid.size();
     if (M == 0) {
         std::cerr << "[SimulateContinuous] WARNING: no valid trajectories\n";
         return {0.0, 0.0, 0.0, 0, 0};
     }
 
     double mean_t = 0.0, mean_e = 0.0;
-    for (double v : per_time_results)  mean_t += v;
-    for (double v : per_event_results) mean_e += v;
+    for (const auto* r : valid) mean_t += r->per_time;
+    for (const auto* r : valid) mean_e += r->per_event;
     mean_t /= M;
     mean_e /= M;
 
     double var = 0.0;
-    for (double v : per_time_results) {
-        double d = v - mean_t;
+    for (const auto* r : valid) {
+        double d = r->per_time - mean_t;
         var += d * d;
     }
     double std_err = (M > 1) ? std::sqrt(var / ((double)M * (M - 1))) : 0.0;
 
     long long avg_ev = 0, avg_dec = 0;
-    for (long long v : events_per_traj)   avg_ev  += v;
-    for (long long v : decisions_per_traj) avg_dec += v;
+    for (const auto* r : valid) avg_ev  += r->events;
+    for (const auto* r : valid) avg_dec += r->decisions;
     avg_ev  /= M;
     avg_dec /= M;
 
-    ContinuousSimResult res;
+    MDP::ContinuousSimResult res;
     res.mean_cost_per_time  = mean_t;
     res.mean_cost_per_event = mean_e;
     res.std_err_per_time    = std_err;
@@ -381,6 +498,37 @@ MDP::ContinuousSimResult MDP::SimulateContinuous(
     return res;
 }
 
+} // anonymous namespace
+
+
+// ============================================================
+//  MDP::SimulateContinuous
+// ============================================================
+MDP::ContinuousSimResult MDP::SimulateContinuous(
+    std::function<int64_t(const State&)> policy_fn,
+    int     n_traj,
+    double  t_max,
+    double  t_warmup,
+    int64_t rng_seed,
+    int64_t num_threads) const
+{
+    // All threads share policy_fn, which must therefore be thread-safe when num_threads != 1.
+    auto shared_policy = [&policy_fn]() { return SharedPolicy{ policy_fn }; };
+    return SimulateTrajectories(*this, shared_policy, n_traj, t_max, t_warmup, rng_seed, num_threads);
+}
+
+MDP::ContinuousSimResult MDP::SimulateContinuous(
+    const DynaPlex::Policy& policy,
+    int     n_traj,
+    double  t_max,
+    double  t_warmup,
+    int64_t rng_seed,
+    int64_t num_threads) const
+{
+    auto per_thread_policy = [this, &policy, rng_seed]() { return TrajectoryPolicy(*this, policy, rng_seed); };
+    return SimulateTrajectories(*this, per_thread_policy, n_traj, t_max, t_warmup, rng_seed, num_threads);
+}
+
 // ============================================================
 //  MDP::TraceContinuous
 // ============================================================
@@ -389,122 +537,60 @@ void MDP::TraceContinuous(
     double  t_trace,
     int64_t rng_seed) const
 {
-    constexpr double INF = std::numeric_limits<double>::infinity();
-    const int64_t K = (int64_t)server_static_info.size();
-    const int64_t N = n_jobs;
-
-    std::mt19937_64 rng((uint64_t)rng_seed);
-    auto exp_sample = [&](double rate) -> double {
-        if (rate <= 0.0) return INF;
-        std::exponential_distribution<double> dist(rate);
-        return dist(rng);
-    };
-
-    // ---- Continuous state ----
-    std::vector<double>             server_finish(K, INF);
-    std::vector<int64_t>            server_type(K, -1);
-    std::vector<std::deque<double>> queues(N);
-    std::vector<double>             next_arrival(N);
-
-    for (int64_t n = 0; n < N; ++n)
-        next_arrival[(size_t)n] = exp_sample(arrival_rates[(size_t)n]);
-
-    const double tick_interval = (tick_rate > 0.0) ? 1.0 / tick_rate : INF;
-    double next_tick = tick_interval;
-    double t = 0.0;
+    DynaPlex::RNG rng = TrajectoryEventRNG(rng_seed, 0);   // trajectory 0 of SimulateContinuous
+    ContinuousSystem system(*this, rng);
+    State query = GetInitialState();
 
     // ---- Print helpers ----
-    // Prints current queue sojourn times and server states compactly.
+    // Prints current queue sojourn times and server states compactly;
+    // the servers of a pool are listed in order, e.g. S0:T1,idle.
     auto print_state_str = [&]() -> std::string {
         std::ostringstream oss;
         oss << "Q[";
-        for (int64_t n = 0; n < N; ++n) {
+        for (int64_t n = 0; n < n_jobs; ++n) {
             if (n > 0) oss << " ";
             oss << "T" << n << ":";
-            if (queues[(size_t)n].empty()) {
+            if (system.Queue(n).empty()) {
                 oss << "empty";
             } else {
                 bool first = true;
-                for (double at : queues[(size_t)n]) {
+                for (double at : system.Queue(n)) {
                     oss << (first ? "" : ",");
-                    oss << std::fixed << std::setprecision(2) << (t - at);
+                    oss << std::fixed << std::setprecision(2) << (system.Now() - at);
                     first = false;
                 }
             }
         }
         oss << "]  S[";
-        for (int64_t k = 0; k < K; ++k) {
-            if (k > 0) oss << " ";
-            oss << "S" << k << ":";
-            if (server_type[(size_t)k] < 0)
+        for (int64_t i = 0; i < system.NumServers(); ++i) {
+            const int64_t k = system.ServerPool(i);
+            if (i == 0 || system.ServerPool(i - 1) != k)
+                oss << (i > 0 ? " " : "") << "S" << k << ":";
+            else
+                oss << ",";
+            if (system.ServerType(i) < 0)
                 oss << "idle";
             else
-                oss << "T" << server_type[(size_t)k];
+                oss << "T" << system.ServerType(i);
         }
         oss << "]";
         return oss.str();
     };
 
-    // Runs the policy loop, prints each decision, and mirrors assignments
-    // into the continuous state.  Returns the number of decisions examined.
-    // After each action=1 the query state is rebuilt from the updated
-    // continuous variables (mirrors the discrete FIL-refresh step), so
-    // subsequent iterations see the correct residual queue.
-    auto trace_and_assign = [&]() -> int {
-        int n_examined = 0;
-
-        for (;;) {
-            State s = BuildQueryState(*this, t, server_finish, server_type, queues);
-            if (s.server_manager.action_queue.empty()) break;
-
-            bool assigned = false;
-            while (s.server_manager.get_action_counter()
-                   < (int64_t)s.server_manager.action_queue.size())
-            {
-                int64_t ac  = s.server_manager.get_action_counter();
-                int64_t k   = s.server_manager.action_queue[(size_t)ac].server_index;
-                int64_t job = s.server_manager.action_queue[(size_t)ac].job_type;
-
-                double tau_job = queues[(size_t)job].empty()
-                                 ? -1.0
-                                 : t - queues[(size_t)job].front();
-                int64_t fil = (tau_job >= 0.0)
-                              ? static_cast<int64_t>(tau_job * tick_rate)
-                              : -1LL;
-
-                int64_t action = policy_fn(s);
-                ++n_examined;
-
-                if (action == 1) {
-                    std::cout << "      assign S" << k << " <- T" << job
-                              << " (tau=" << std::fixed << std::setprecision(2) << tau_job
-                              << " FIL=" << fil << ")";
-                    if (!queues[(size_t)job].empty())
-                        queues[(size_t)job].pop_front();
-                    server_type[(size_t)k] = job;
-                    int idx = ServerDynamicState::canServeIndex(
-                        server_static_info, k, job);
-                    double mu = (idx >= 0)
-                                ? server_static_info[(size_t)k].mu_kj[(size_t)idx]
-                                : 0.4;
-                    double finish_t = t + exp_sample(mu);
-                    server_finish[(size_t)k] = finish_t;
-                    std::cout << " (completes ~t=" << std::setprecision(3) << finish_t << ")\n";
-
-                    assigned = true;
-                    break;  // rebuild after assignment
-                } else {
-                    std::cout << "      skip  T" << job
-                              << " (tau=" << std::fixed << std::setprecision(2) << tau_job
-                              << " FIL=" << fil << ")\n";
-                    s.server_manager.take_action(0);
-                }
-            }
-
-            if (!assigned) break;
+    // Prints each decision and the completion time of each assignment.
+    // tau/FIL are those of the candidate's job before it is dequeued.
+    struct TraceObserver {
+        const ContinuousSystem& system;
+        void Decision(int64_t k, int64_t job, int64_t action) {
+            std::cout << (action == 1 ? "      assign S" + std::to_string(k) + " <- T" : std::string("      skip  T"))
+                      << job << " (tau=" << std::fixed << std::setprecision(2) << system.Sojourn(job)
+                      << " FIL=" << system.Fil(job) << ")";
+            if (action != 1) std::cout << "\n";
         }
-        return n_examined;
-    };
+        void Assigned(double finish_t) {
+            std::cout << " (completes ~t=" << std::setprecision(3) << finish_t << ")\n";
+        }
+    } observer{ system };
 
     // ---- Header ----
     std::cout << "\n=== TraceContinuous  seed=" << rng_seed
@@ -515,68 +601,24 @@ void MDP::TraceContinuous(
 
     int n_events = 0;
 
-    while (t < t_trace) {
-
-        // Find next event
-        double  next_t   = INF;
-        int     win_kind = -1;
-        int64_t win_idx  = -1;
-
-        for (int64_t k = 0; k < K; ++k)
-            if (server_finish[(size_t)k] < next_t) {
-                next_t = server_finish[(size_t)k]; win_kind = 1; win_idx = k;
-            }
-        for (int64_t n = 0; n < N; ++n)
-            if (next_arrival[(size_t)n] < next_t) {
-                next_t = next_arrival[(size_t)n]; win_kind = 0; win_idx = n;
-            }
-        if (next_tick < next_t) {
-            next_t = next_tick; win_kind = 2; win_idx = -1;
-        }
-
-        if (next_t >= t_trace) break;
-        t = next_t;
+    while (system.NextTime() < t_trace) {
+        // Type in service is needed for the completion line, before Advance frees the server.
+        const Clock& next = system.NextClock();
+        const int64_t type_done = (next.kind == Clock::Completion) ? system.ServerType(next.index) : -1;
+        const Clock c = system.Advance();
         ++n_events;
 
-        if (win_kind == 1) {
-            // Service completion
-            int64_t type_done = server_type[(size_t)win_idx];
-            server_finish[(size_t)win_idx] = INF;
-            server_type[(size_t)win_idx]   = -1;
-
-            std::cout << std::fixed << std::setprecision(3)
-                      << "t=" << std::setw(7) << t
-                      << "  COMPLETION S" << win_idx
-                      << " (T" << type_done << ") | "
-                      << print_state_str() << "\n";
-            int nd = trace_and_assign();
-            if (nd == 0) std::cout << "      (no candidates)\n";
-
-        } else if (win_kind == 0) {
-            // Arrival
-            queues[(size_t)win_idx].push_back(t);
-            next_arrival[(size_t)win_idx] =
-                t + exp_sample(arrival_rates[(size_t)win_idx]);
-
-            std::cout << std::fixed << std::setprecision(3)
-                      << "t=" << std::setw(7) << t
-                      << "  ARRIVAL   T" << win_idx
-                      << "           | "
-                      << print_state_str() << "\n";
-            int nd = trace_and_assign();
-            if (nd == 0) std::cout << "      (no candidates)\n";
-
-        } else {
-            // Tick
-            next_tick += tick_interval;
-
-            std::cout << std::fixed << std::setprecision(3)
-                      << "t=" << std::setw(7) << t
-                      << "  TICK                  | "
-                      << print_state_str() << "\n";
-            int nd = trace_and_assign();
-            if (nd == 0) std::cout << "      (no deferred actions)\n";
-        }
+        std::cout << std::fixed << std::setprecision(3) << "t=" << std::setw(7) << system.Now();
+        if (c.kind == Clock::Completion)
+            std::cout << "  COMPLETION S" << system.ServerPool(c.index) << " (T" << type_done << ") | ";
+        else if (c.kind == Clock::Arrival)
+            std::cout << "  ARRIVAL   T" << c.index << "           | ";
+        else
+            std::cout << "  TICK                  | ";
+        std::cout << print_state_str() << "\n";
+
+        if (MakeAssignments(system, query, policy_fn, observer) == 0)
+            std::cout << (c.kind == Clock::Tick ? "      (no deferred actions)\n" : "      (no candidates)\n");
     }
 
     std::cout << "  " << std::string(70, '-') << "\n";
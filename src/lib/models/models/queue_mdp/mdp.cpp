@@ -7,6 +7,7 @@
 #include <iostream>
 #include <iomanip>
 #include <functional>
+#include <random>
 #include <span>
 #include <thread>
 #include <fstream>
@@ -65,6 +66,26 @@ namespace DynaPlex::Models {
 			std::cout << " ]\n";
 		}
 
+		// The incremental queue updates must reproduce a full generate_actions exactly.
+		static void DebugCheckActionQueue(const MDP::State& state, bool sort_descending, const char* prefix)
+		{
+			MDP::ServerDynamicState full = state.server_manager;
+			full.generate_actions(state.queue_manager.get_FIL_waiting(), sort_descending);
+			const auto& AQ = state.server_manager.action_queue;
+			bool same = (AQ.size() == full.action_queue.size());
+			for (size_t i = 0; same && i < AQ.size(); ++i) {
+				const auto& a = AQ[i];
+				const auto& b = full.action_queue[i];
+				same = a.server_index == b.server_index && a.job_type == b.job_type &&
+				       a.is_fifo_winner == b.is_fifo_winner && a.is_cmu_winner == b.is_cmu_winner &&
+				       a.is_rfq_winner == b.is_rfq_winner;
+			}
+			if (!same) {
+				DebugPrintActionQueue(state, prefix);
+				throw DynaPlex::Error("queue_mdp: incremental action queue differs from generate_actions");
+			}
+		}
+
 		#endif // QUEUE_MDP_DEBUG
 		// ===== END DEBUG UTILITIES =====
 		// helper for using config file
@@ -78,6 +99,7 @@ namespace DynaPlex::Models {
 		{
 			VarGroup vars;
 			vars.Add("valid_actions", per_event_mode ? (n_jobs + 1)
+			                        : joint_mode ? joint_action_count
 			                        : (enable_skip_all ? 3 : 2));
 			vars.Add("discount_factor", discount_factor);
 
@@ -131,7 +153,7 @@ namespace DynaPlex::Models {
 						// entry was consumed (counter advanced in ModifyStateWithAction);
 						// earlier idle decisions stay committed.  No regeneration —
 						// remaining units' masks read the live state.
-						state.stochastic_draws = event.stochastic_draws;
+						state.stochastic_key = StochasticKey(event);
 						if (state.server_manager.get_action_counter() <
 						    (int64_t)state.server_manager.action_queue.size()) {
 							state.cat = StateCategory::AwaitAction();
@@ -139,25 +161,60 @@ namespace DynaPlex::Models {
 							state.server_manager.set_action_counter(0);
 							state.cat = StateCategory::AwaitEvent();
 						}
-						state.last_event_category = "fil_refresh";
+						state.last_event_category = EventCategory::FilRefresh;
 						return shaping_cost;
 					}
 
-					// regenerate actions because FIL changed
-					state.server_manager.generate_actions(state.queue_manager.get_FIL_waiting(), cost_rates, sort_descending);
+					if (joint_mode) {
+						// refresh the remaining types of the joint assignment first; the
+						// next epoch starts from candidates rebuilt after the last one.
+						state.stochastic_key = StochasticKey(event);
+						state.last_event_category = EventCategory::FilRefresh;
+						if (state.pending_fil_mask != 0) {
+							state.next_fil_job_type = std::countr_zero(state.pending_fil_mask);
+							state.pending_fil_mask &= state.pending_fil_mask - 1;
+							state.cat = StateCategory::AwaitEvent();
+							return shaping_cost;
+						}
+						BuildCandidates(state);
+						state.server_manager.set_action_counter(0);
+						state.cat = state.server_manager.action_queue.empty()
+							? StateCategory::AwaitEvent()
+							: StateCategory::AwaitAction();
+						return shaping_cost;
+					}
+
+					// FIL of type n changed: re-rank its candidates.  The serving pool's
+					// infeasible entries were already pruned by take_action; its labels are
+					// recomputed together with the rest.
+					UpdateCandidatesForType(state, n);
+					#if QUEUE_MDP_DEBUG
+					DebugCheckActionQueue(state, sort_descending, "[QMDP]   AFTER fil refresh");
+					#endif
 					state.server_manager.set_action_counter(0);
-					state.stochastic_draws = event.stochastic_draws;
+					state.stochastic_key = StochasticKey(event);
 
 					// go back to decision-making
 					state.cat = state.server_manager.action_queue.empty()
 						? StateCategory::AwaitEvent()
 						: StateCategory::AwaitAction();
 
-					state.last_event_category = "fil_refresh";
+					state.last_event_category = EventCategory::FilRefresh;
 					return shaping_cost;
 				}
 
 
+				if (state.skipped_idle_run) {
+					// SkipIdlePeriods already consumed the idle steps before this one, so this
+					// step is an arrival or completion: rescale the draw onto those buckets.
+					state.skipped_idle_run = false;
+					const double arrival = state.queue_manager.arrival_tree.total();
+					const double active = arrival + state.server_manager.completion_tree.total();
+					event_sample = event_sample / uniformization_rate * active;
+					if (event_sample >= arrival)
+						event_sample += state.queue_manager.total_tick_rate;
+				}
+
 				Event_type event_type = GetEventType(event_sample, state);
 			
 			
@@ -170,7 +227,7 @@ namespace DynaPlex::Models {
 					DebugPrintBusyOn(state, "[QMDP]   BEFORE complete_job");
 				#endif
 					
-					state.last_event_category = "completion";
+					state.last_event_category = EventCategory::Completion;
 				
 					//complete job at server
 					state.server_manager.complete_job(event_type.server_index, event_type.job_type);
@@ -182,10 +239,15 @@ namespace DynaPlex::Models {
 
 					if (per_event_mode)
 						state.server_manager.generate_actions_per_event(state.queue_manager.get_FIL_waiting());
-					else
-						state.server_manager.generate_actions(state.queue_manager.get_FIL_waiting(), cost_rates, sort_descending);
+					else {
+						// only pool k gained idle capacity
+						UpdateCandidatesForPool(state, event_type.server_index);
+						#if QUEUE_MDP_DEBUG
+						DebugCheckActionQueue(state, sort_descending, "[QMDP]   AFTER completion");
+						#endif
+					}
 					state.server_manager.set_action_counter(0);
-					state.stochastic_draws = event.stochastic_draws;
+					state.stochastic_key = StochasticKey(event);
 					if (!state.server_manager.action_queue.empty()) {
 						state.cat = StateCategory::AwaitAction();
 					}
@@ -203,19 +265,25 @@ namespace DynaPlex::Models {
 					return 0.0; // no cost for job completion
 				}
 				else if (event_type.type == Event_type::Type::Arrival) {
-					state.last_event_category = "arrival";
+					state.last_event_category = EventCategory::Arrival;
 
-
-				
-					state.queue_manager.arrival(event_type.arrival_index);
+					// The FIL (and with it the candidate set) only changes when the type was empty.
+					const int64_t n = event_type.arrival_index;
+					const bool fil_changed = state.queue_manager.waiting[(size_t)n].empty();
+					state.queue_manager.arrival(n);
 
 
 					if (per_event_mode)
 						state.server_manager.generate_actions_per_event(state.queue_manager.get_FIL_waiting());
-					else
-						state.server_manager.generate_actions(state.queue_manager.get_FIL_waiting(), cost_rates, sort_descending);
+					else {
+						if (fil_changed)
+							UpdateCandidatesForType(state, n);
+						#if QUEUE_MDP_DEBUG
+						DebugCheckActionQueue(state, sort_descending, "[QMDP]   AFTER arrival");
+						#endif
+					}
 					state.server_manager.set_action_counter(0);
-					state.stochastic_draws = event.stochastic_draws;
+					state.stochastic_key = StochasticKey(event);
 
 					// if there are pending actions, go to await action
 					if (!state.server_manager.action_queue.empty()) {
@@ -236,10 +304,10 @@ namespace DynaPlex::Models {
 					return 0.0; // cost for arrival
 				}
 				else if (event_type.type == Event_type::Type::Tick) {
-					state.last_event_category = "tick";
+					state.last_event_category = EventCategory::Tick;
 
 				
-					state.queue_manager.tick();
+					kernels->tick(state.queue_manager);
 				
 					// Charge tick cost using the configurable reward function (post-tick FIL)
 					double cost = ComputeTickCost(state);
@@ -262,7 +330,7 @@ namespace DynaPlex::Models {
 					return cost; // cost for tick
 				}
 				else {
-					state.last_event_category = "nothing";
+					state.last_event_category = EventCategory::Nothing;
 
 					#if QUEUE_MDP_DEBUG
 					std::cout << "[QMDP]   AFTER event handling\n";
@@ -305,6 +373,25 @@ namespace DynaPlex::Models {
 					return 0.0;
 				}
 
+				if (joint_mode) {
+					// joint: start every (pool, type) pair of the assignment at once, then
+					// refresh the served types' FILs one event at a time, lowest type
+					// first.  Serving nothing idles until the next event.
+					const ActionQueue assignment = DecodeJointAction(action);
+					uint32_t served = 0;
+					for (const Action& a : assignment) {
+						state.server_manager.assign_job(a.server_index, a.job_type);
+						served |= uint32_t{ 1 } << a.job_type;
+					}
+					state.server_manager.set_action_counter(0);
+					state.cat = StateCategory::AwaitEvent();
+					if (served != 0) {
+						state.next_fil_job_type = std::countr_zero(served);
+						state.pending_fil_mask = served & (served - 1);
+					}
+					return 0.0;
+				}
+
 				Action current_action = state.server_manager.action_queue.at((size_t)acnt);
 
 				if (per_event_mode && action >= 1) {
@@ -394,8 +481,56 @@ namespace DynaPlex::Models {
 		}
 	
 		std::vector<MDP::nextStateProbability> MDP::getNextStateProbability(const MDP::State& state, int64_t action) const{
-			
-			std::vector<MDP::nextStateProbability> out;   // <-- define it
+			std::vector<MDP::nextStateProbability> out;
+			getNextStateProbability(state, action, out);
+			return out;
+		}
+
+		void MDP::getNextStateProbability(const MDP::State& state, int64_t action,
+		                                  std::vector<nextStateProbability>& out) const{
+			out.clear();   // keeps the capacity of the caller's buffer
+
+			if (state.cat == StateCategory::AwaitAction() && joint_mode) {
+				// joint twin: start all pairs of the assignment, enumerate the product of
+				// the served types' FIL-refresh distributions inline and rebuild the
+				// candidates (mirrors ModifyStateWithAction + the refresh events).  A
+				// refresh serves the FIL and draws the new bottom of the tracked queue from
+				// the old one, as multi_queue::complete_job does.
+				MDP::State modified_state = state;
+				const ActionQueue assignment = DecodeJointAction(action);
+				for (const Action& a : assignment)
+					modified_state.server_manager.assign_job(a.server_index, a.job_type);
+				modified_state.server_manager.set_action_counter(0);
+				if (assignment.empty()) {
+					modified_state.cat = StateCategory::AwaitEvent();
+					out.push_back({ std::move(modified_state), 1.0 });
+					return;
+				}
+
+				const double gamma = state.queue_manager.total_tick_rate;
+				out.push_back({ std::move(modified_state), 1.0 });
+				for (const Action& a : assignment) {
+					const int64_t n = a.job_type;
+					const auto bottom_dist = NextFILDistribution(state.queue_manager.waiting[(size_t)n].back(), arrival_rates[(size_t)n], gamma);
+					std::vector<MDP::nextStateProbability> next;
+					next.reserve(out.size() * bottom_dist.size());
+					for (const auto& entry : out)
+						for (auto [new_bottom, p_bottom] : bottom_dist) {
+							MDP::State s2 = entry.next_state;
+							s2.queue_manager.serve_fil(n, new_bottom);
+							next.push_back({ std::move(s2), entry.probability * p_bottom });
+						}
+					out = std::move(next);
+				}
+				for (auto& entry : out) {
+					BuildCandidates(entry.next_state);
+					entry.next_state.server_manager.set_action_counter(0);
+					entry.next_state.cat = entry.next_state.server_manager.action_queue.empty()
+						? StateCategory::AwaitEvent()
+						: StateCategory::AwaitAction();
+				}
+				return;
+			}
 
 			if (state.cat == StateCategory::AwaitAction()) {
 				MDP::State modified_state = state;
@@ -416,15 +551,15 @@ namespace DynaPlex::Models {
 					modified_state.server_manager.assign_job(current_server_type, n);
 					modified_state.server_manager.set_action_counter(action_counter + 1);
 
-					const int64_t i = state.queue_manager.get_FIL_waiting()[(size_t)n];
+					const int64_t bottom = state.queue_manager.waiting[(size_t)n].back();
 					const double lambda = arrival_rates[(size_t)n];
 					const double gamma = state.queue_manager.total_tick_rate;
 
-					auto fil_dist = NextFILDistribution(i, lambda, gamma);
+					auto bottom_dist = NextFILDistribution(bottom, lambda, gamma);
 
-					for (auto [next_fil, p_fil] : fil_dist) {
+					for (auto [new_bottom, p_bottom] : bottom_dist) {
 						MDP::State s2 = modified_state;
-						s2.queue_manager.set_fil(n, next_fil);
+						s2.queue_manager.serve_fil(n, new_bottom);
 						s2.queue_manager.update_total_arrival_rate(arrival_rates);
 
 						if (s2.server_manager.get_action_counter() <
@@ -434,39 +569,38 @@ namespace DynaPlex::Models {
 							s2.server_manager.set_action_counter(0);
 							s2.cat = StateCategory::AwaitEvent();
 						}
-						out.push_back({ std::move(s2), p_fil });
+						out.push_back({ std::move(s2), p_bottom });
 					}
-					return out;
+					return;
 				}
 
 				if (action == 1) {
 					// Generate vector of states, each equal to modified state, but with the FIL of the current action
 					modified_state.server_manager.take_action(action);
 
-					// RVI is FIL-projected: read and write only the FIL (position 0) for this type.
-					const int64_t i = state.queue_manager.get_FIL_waiting()[(size_t)current_job_type];
+					// The FIL refresh: the served FIL leaves, the tracked positions behind it
+					// move up, and the new bottom is drawn from the old one (complete_job).
+					const int64_t bottom = state.queue_manager.waiting[(size_t)current_job_type].back();
 					const double lambda = arrival_rates[current_job_type];
 					const double gamma = state.queue_manager.total_tick_rate;
 
-					auto fil_dist = NextFILDistribution(i, lambda, gamma);
+					auto bottom_dist = NextFILDistribution(bottom, lambda, gamma);
 
-					for (auto [next_fil, p_fil] : fil_dist) {
+					for (auto [new_bottom, p_bottom] : bottom_dist) {
 						MDP::State s2 = modified_state;
-
-						// Set new FIL for this job type (clears any deeper positions — FIL-projected)
-						s2.queue_manager.set_fil(current_job_type, next_fil);
+						s2.queue_manager.serve_fil(current_job_type, new_bottom);
 
 						// Update derived rates to reflect new FIL
 						s2.queue_manager.update_total_arrival_rate(arrival_rates);
 
 						// Regenerate action queue from scratch using new FIL values
-						s2.server_manager.generate_actions(s2.queue_manager.get_FIL_waiting(), cost_rates, sort_descending);
+						BuildCandidates(s2);
 						s2.server_manager.set_action_counter(0);
 						s2.cat = s2.server_manager.action_queue.empty()
 							? StateCategory::AwaitEvent()
 							: StateCategory::AwaitAction();
 
-						out.push_back({ std::move(s2), p_fil });
+						out.push_back({ std::move(s2), p_bottom });
 					}
 
 
@@ -490,7 +624,7 @@ namespace DynaPlex::Models {
 					}
 					out.push_back({ std::move(modified_state), 1 });
 				}
-				return out;
+				return;
 				
 			}
 			// if awaitevent
@@ -500,7 +634,7 @@ namespace DynaPlex::Models {
 				// 1) ARRIVALS (only if queue not full for that type)
 				double A = 0.0;
 				for (int64_t n = 0; n < n_jobs; ++n) {
-					if (state.queue_manager.waiting[(size_t)n].empty()) {
+					if ((int64_t)state.queue_manager.waiting[(size_t)n].size() < max_queue_depth) {
 						const double r = arrival_rates[(size_t)n];
 
 						MDP::State s2 = state;
@@ -513,7 +647,7 @@ namespace DynaPlex::Models {
 						if (per_event_mode)
 							s2.server_manager.generate_actions_per_event(s2.queue_manager.get_FIL_waiting());
 						else
-							s2.server_manager.generate_actions(s2.queue_manager.get_FIL_waiting(), cost_rates, sort_descending);
+							BuildCandidates(s2);
 						s2.server_manager.set_action_counter(0);
 						
 						s2.cat = s2.server_manager.action_queue.empty()
@@ -556,7 +690,7 @@ namespace DynaPlex::Models {
 						if (per_event_mode)
 							s2.server_manager.generate_actions_per_event(s2.queue_manager.get_FIL_waiting());
 						else
-							s2.server_manager.generate_actions(s2.queue_manager.get_FIL_waiting(), cost_rates, sort_descending);
+							BuildCandidates(s2);
 						s2.server_manager.set_action_counter(0);
 						s2.cat = s2.server_manager.action_queue.empty()
 							? StateCategory::AwaitEvent()
@@ -580,7 +714,6 @@ namespace DynaPlex::Models {
 
 
 			}
-			return out;
 		}
 
 		double MDP::JobUrgency(int64_t n, int64_t t) const {
@@ -595,94 +728,228 @@ namespace DynaPlex::Models {
 		}
 
 		double MDP::ComputeTickCost(const State& state, int64_t rtype) const {
+			return kernels->tick_cost(*this, state, rtype);
+		}
+
+		void MDP::AddTypeTickCost(size_t n, const int64_t* ages, size_t depth, int64_t rtype, double& cost) const {
+			if (rtype == 0 || rtype == 2) {
+				// Binary: only FIL matters (flat cost if FIL > deadline)
+				if (ages[0] > (int64_t)due_times[n])
+					cost += cost_rates[n];
+
+				// Shaping (rtype 2): the FIL just aged one tick, so the potential
+				// Phi = -JobUrgency(FIL) dropped by u(t)-u(t-1) = cost_rate/D for
+				// 1 <= t <= D.  Charged here; refunded on service (fil_refresh).
+				if (rtype == 2) {
+					const int64_t t = ages[0];
+					const int64_t D = (int64_t)due_times[n];
+					if (D >= 1 && t >= 1 && t <= D)
+						cost += cost_rates[n] / (double)D;
+				}
+			}
+			else if (rtype == 4) {
+				// Tardiness flux ("fraction served late"): each job charges c_n
+				// ONCE, at the tick its age crosses the deadline (age D -> D+1).
+				// Long-run average = c_n * (late jobs per unit time), i.e. the
+				// minimize-late-fraction objective charged at the decision-
+				// relevant moment instead of at departure.
+				//
+				// Two contributions per tick:
+				//   (a) tracked positions crossing right now (age == D+1), exact;
+				//   (b) untracked jobs behind the deepest tracked position.  The
+				//       coefficient is the EXPECTED NUMBER of arrivals per tick-slot,
+				//       lambda/nu — NOT alpha = lambda/(lambda+nu), which is only the
+				//       probability that a slot is non-empty.  A slot holding k jobs
+				//       produces k crossings, so a count needs a mean, not a
+				//       Bernoulli probability.  This also makes the objective
+				//       tick-rate invariant: nu ticks/time * (lambda/nu) = lambda
+				//       crossings per unit time whenever the queue stays backed up,
+				//       independent of nu (which is the whole design goal).
+				//       The slot reaching age D+1 lies strictly behind the deepest
+				//       tracked job only if that job is at least D+2 old; at exactly
+				//       D+1 the tracked job is the only one crossing.
+				//
+				// NOTE: no abandonment degeneracy — a late FIL left unserved keeps
+				// the flux term charging indefinitely, so clearing late queues is
+				// strictly incentivized.
+				const int64_t D = (int64_t)due_times[n];
+				const double c_real  = cost_rates[n] * tick_rate;
+				const double density = arrival_rates[n] / tick_rate;
+				for (const int64_t t : std::span(ages, depth))
+					if (t == D + 1)
+						cost += c_real;
+				if (ages[depth - 1] >= D + 2)
+					cost += c_real * density;
+			}
+			else {
+				// Queue-lateness: exact excess summed over all tracked positions,
+				// plus a Koole tail approximation for untracked positions beyond max_queue_depth.
+
+				// Exact contribution from tracked positions
+				for (const int64_t t : std::span(ages, depth)) {
+					const double excess = (double)t - due_times[n];
+					if (excess > 0.0)
+						cost += cost_rates[n] * excess;
+				}
+
+				// Tail approximation for jobs beyond max_queue_depth:
+				// Same Koole formula as the old single-position formula, but now anchored
+				// at the deepest tracked position (ages[depth - 1]) instead of the FIL.
+				// At max_queue_depth==1, ages[depth - 1]==ages[0]==FIL, so this is identical
+				// to the original formula — full backward compatibility.
+				const double bottom_excess = (double)ages[depth - 1] - due_times[n];
+				if (bottom_excess > 0.0) {
+					const double tail = (arrival_rates[n] / tick_rate)
+					                  * std::max(0.0, bottom_excess - 1.0) * bottom_excess / 2.0;
+					cost += cost_rates[n] * tail;
+				}
+
+				// Shaping (rtype 3): same FIL urgency potential as rtype 2 — the
+				// accrual spreads exactly one first-late-tick QL charge (c_n) over
+				// the pre-deadline window as c_n/D per tick; refunded on service.
+				if (rtype == 3) {
+					const int64_t t = ages[0];
+					const int64_t D = (int64_t)due_times[n];
+					if (D >= 1 && t >= 1 && t <= D)
+						cost += cost_rates[n] / (double)D;
+				}
+			}
+		}
+
+		double MDP::ComputeTickRunCost(const State& state, int64_t ticks) const {
+			if (ticks <= 0) return 0.0;
+			if (reward_type == 4) {
+				State s = state;
+				double cost = 0.0;
+				for (int64_t i = 0; i < ticks; ++i) {
+					s.queue_manager.tick();
+					cost += ComputeTickCost(s);
+				}
+				return cost;
+			}
+
+			// Tick i (1..ticks) sees age t + i.  For an age offset x and threshold h, the ticks
+			// with x + i > h are i = first..ticks; count and sums of i and i^2 over that range.
+			const double K = (double)ticks;
+			struct Range { double count = 0.0, sum_i = 0.0, sum_i2 = 0.0; };
+			auto range_above = [&](double x, double h) {
+				Range r;
+				const double first = std::max(1.0, std::floor(h - x) + 1.0);
+				if (first > K) return r;
+				auto sq = [](double m) { return m * (m + 1.0) * (2.0 * m + 1.0) / 6.0; };
+				r.count  = K - first + 1.0;
+				r.sum_i  = (first + K) * r.count / 2.0;
+				r.sum_i2 = sq(K) - sq(first - 1.0);
+				return r;
+			};
+
+			const bool binary = (reward_type == 0 || reward_type == 2);
+			const bool shaped = (reward_type == 2 || reward_type == 3);
 			double cost = 0.0;
 			for (size_t n = 0; n < (size_t)n_jobs; ++n) {
 				const auto& q = state.queue_manager.waiting[n];
 				if (q.empty()) continue;
+				const int64_t f = q.front();
 
-				if (rtype == 0 || rtype == 2) {
-					// Binary: only FIL matters (flat cost if FIL > deadline)
-					if (q.front() > (int64_t)due_times[n])
-						cost += cost_rates[n];
-
-					// Shaping (rtype 2): the FIL just aged one tick, so the potential
-					// Phi = -JobUrgency(FIL) dropped by u(t)-u(t-1) = cost_rate/D for
-					// 1 <= t <= D.  Charged here; refunded on service (fil_refresh).
-					if (rtype == 2) {
-						const int64_t t = q.front();
-						const int64_t D = (int64_t)due_times[n];
-						if (D >= 1 && t >= 1 && t <= D)
-							cost += cost_rates[n] / (double)D;
-					}
-				}
-				else if (rtype == 4) {
-					// Tardiness flux ("fraction served late"): each job charges c_n
-					// ONCE, at the tick its age crosses the deadline (age D -> D+1).
-					// Long-run average = c_n * (late jobs per unit time), i.e. the
-					// minimize-late-fraction objective charged at the decision-
-					// relevant moment instead of at departure.
-					//
-					// Two contributions per tick:
-					//   (a) tracked positions crossing right now (age == D+1), exact;
-					//   (b) untracked jobs behind the deepest tracked position.  The
-					//       coefficient is the EXPECTED NUMBER of arrivals per tick-slot,
-					//       lambda/nu — NOT alpha = lambda/(lambda+nu), which is only the
-					//       probability that a slot is non-empty.  A slot holding k jobs
-					//       produces k crossings, so a count needs a mean, not a
-					//       Bernoulli probability.  This also makes the objective
-					//       tick-rate invariant: nu ticks/time * (lambda/nu) = lambda
-					//       crossings per unit time whenever the queue stays backed up,
-					//       independent of nu (which is the whole design goal).
-					//       The slot reaching age D+1 lies strictly behind the deepest
-					//       tracked job only if that job is at least D+2 old; at exactly
-					//       D+1 the tracked job is the only one crossing.
-					//
-					// NOTE: no abandonment degeneracy — a late FIL left unserved keeps
-					// the flux term charging indefinitely, so clearing late queues is
-					// strictly incentivized.
+				if (binary) {
+					// cost_rates[n] for every tick with FIL > D
 					const int64_t D = (int64_t)due_times[n];
-					const double c_real  = cost_rates[n] * tick_rate;
-					const double density = arrival_rates[n] / tick_rate;
-					for (const int64_t t : q)
-						if (t == D + 1)
-							cost += c_real;
-					if (q.back() >= D + 2)
-						cost += c_real * density;
+					cost += cost_rates[n] * range_above((double)f, (double)D).count;
 				}
 				else {
-					// Queue-lateness: exact excess summed over all tracked positions,
-					// plus a Koole tail approximation for untracked positions beyond max_queue_depth.
-
-					// Exact contribution from tracked positions
+					// sum over ticks of the excess of every tracked position
 					for (const int64_t t : q) {
-						const double excess = (double)t - due_times[n];
-						if (excess > 0.0)
-							cost += cost_rates[n] * excess;
+						const double x = (double)t - due_times[n];
+						const Range r = range_above(x, 0.0);
+						cost += cost_rates[n] * (r.count * x + r.sum_i);
 					}
+					// Koole tail: (lambda/nu) * (e - 1) * e / 2 for bottom excess e > 1
+					const double x = (double)q.back() - due_times[n];
+					const Range r = range_above(x, 1.0);
+					const double sum_e  = r.count * x + r.sum_i;
+					const double sum_e2 = r.count * x * x + 2.0 * x * r.sum_i + r.sum_i2;
+					cost += cost_rates[n] * (arrival_rates[n] / tick_rate) * (sum_e2 - sum_e) / 2.0;
+				}
 
-					// Tail approximation for jobs beyond max_queue_depth:
-					// Same Koole formula as the old single-position formula, but now anchored
-					// at the deepest tracked position (q.back()) instead of the FIL.
-					// At max_queue_depth==1, q.back()==q.front()==FIL, so this is identical
-					// to the original formula — full backward compatibility.
-					const double bottom_excess = (double)q.back() - due_times[n];
-					if (bottom_excess > 0.0) {
-						const double tail = (arrival_rates[n] / tick_rate)
-						                  * std::max(0.0, bottom_excess - 1.0) * bottom_excess / 2.0;
-						cost += cost_rates[n] * tail;
-					}
+				if (shaped) {
+					// cost_rates[n]/D for every tick with 1 <= FIL <= D
+					const int64_t D = (int64_t)due_times[n];
+					if (D >= 1)
+						cost += cost_rates[n] / (double)D * (double)std::clamp<int64_t>(D - f, 0, ticks);
+				}
+			}
+			return cost;
+		}
 
-					// Shaping (rtype 3): same FIL urgency potential as rtype 2 — the
-					// accrual spreads exactly one first-late-tick QL charge (c_n) over
-					// the pre-deadline window as c_n/D per tick; refunded on service.
-					if (rtype == 3) {
-						const int64_t t = q.front();
-						const int64_t D = (int64_t)due_times[n];
-						if (D >= 1 && t >= 1 && t <= D)
-							cost += cost_rates[n] / (double)D;
-					}
+		double MDP::SkipIdlePeriods(State& state, DynaPlex::RNG& rng, int64_t max_periods, int64_t& periods,
+			IdleRunStats* stats) const
+		{
+			periods = 0;
+			if (!skip_idle_steps || max_periods <= 0 || state.skipped_idle_run
+				|| state.cat != StateCategory::AwaitEvent() || state.next_fil_job_type != -1
+				|| !state.server_manager.action_queue.empty())
+				return 0.0;
+
+			// Each step is an arrival or completion (rate `active`: the run stops and that step is
+			// left to the next event), a tick (rate T) or a self-loop.  The run length is geometric
+			// and, given the length, the tick count is binomial, so a run costs O(1) draws and is
+			// charged in closed form.  With stats, the per-step costs depend on the level between
+			// ticks, so the run is drawn one level at a time instead (O(ticks)).
+			const double active = state.queue_manager.arrival_tree.total() + state.server_manager.completion_tree.total();
+			const double T = state.queue_manager.total_tick_rate;
+			// failures before the first success of a per-step success probability p
+			auto geometric = [&rng](double p, int64_t cap) -> int64_t {
+				if (!(p > 0.0)) return cap;
+				if (p >= 1.0) return 0;
+				return std::min(cap, std::geometric_distribution<int64_t>(p)(rng.gen()));
+			};
+
+			double cost = 0.0;
+			EventCategory last = EventCategory::Nothing;
+			if (!stats) {
+				periods = geometric(active / uniformization_rate, max_periods);
+				if (periods < max_periods)
+					state.skipped_idle_run = true;
+				if (periods == 0)
+					return 0.0;
+				const double idle = uniformization_rate - active;
+				const double p_tick = idle > 0.0 ? std::clamp(T / idle, 0.0, 1.0) : 0.0;
+				const int64_t ticks = std::binomial_distribution<int64_t>(periods, p_tick)(rng.gen());
+				// the steps of the run are exchangeable, so the last one is a tick w.p. ticks/periods
+				if (rng.genUniform() * (double)periods < (double)ticks)
+					last = EventCategory::Tick;
+				cost = ComputeTickRunCost(state, ticks);
+				state.queue_manager.tick(ticks);
+				state.last_event_category = last;
+				return cost;
+			}
+
+			// Per level: a geometric number of self-loops, then a tick or the stopping step.
+			const double moving = active + T;
+			while (periods < max_periods) {
+				const int64_t loops = geometric(moving / uniformization_rate, max_periods - periods);
+				const bool capped = periods + loops >= max_periods;
+				const bool tick = !capped && !(rng.genUniform() * moving < active);
+				const int64_t level_steps = loops + (tick ? 1 : 0);
+				if (level_steps > 0) {
+					stats->binary_cost += (double)level_steps * ComputeTickCost(state, 0);
+					stats->tick_cost   += (double)level_steps * ComputeTickCost(state);
+				}
+				periods += level_steps;
+				if (loops > 0)
+					last = EventCategory::Nothing;
+				if (capped)
+					break;
+				if (!tick) {
+					state.skipped_idle_run = true;
+					break;
 				}
+				last = EventCategory::Tick;
+				state.queue_manager.tick();
+				cost += ComputeTickCost(state);
 			}
+			if (periods > 0)
+				state.last_event_category = last;
 			return cost;
 		}
 
@@ -691,14 +958,36 @@ namespace DynaPlex::Models {
 			return (tick_rate / uniformization_rate) * ComputeTickCost(state);
 		}
 
+		std::string MDP::EventCategoryName(EventCategory c) {
+			switch (c) {
+			case EventCategory::Arrival:    return "arrival";
+			case EventCategory::Tick:       return "tick";
+			case EventCategory::Completion: return "completion";
+			case EventCategory::Nothing:    return "nothing";
+			case EventCategory::FilRefresh: return "fil_refresh";
+			default:                        return "";
+			}
+		}
+
+		MDP::EventCategory MDP::EventCategoryFromName(const std::string& name) {
+			if (name == "arrival")     return EventCategory::Arrival;
+			if (name == "tick")        return EventCategory::Tick;
+			if (name == "completion")  return EventCategory::Completion;
+			if (name == "nothing")     return EventCategory::Nothing;
+			if (name == "fil_refresh") return EventCategory::FilRefresh;
+			return EventCategory::Unknown;
+		}
+
 		DynaPlex::VarGroup MDP::State::ToVarGroup() const {
 			DynaPlex::VarGroup vars;
 			vars.Add("cat", cat);
-			vars.Add("last_event_category", last_event_category);
+			vars.Add("last_event_category", EventCategoryName(last_event_category));
 
 			vars.Add("server", server_manager.ToVarGroup());
 			vars.Add("queue", queue_manager.ToVarGroup());
 			vars.Add("next_fil_job_type", next_fil_job_type);
+			vars.Add("pending_fil_mask", (int64_t)pending_fil_mask);
+			vars.Add("skipped_idle_run", skipped_idle_run);
 			return vars;
 		}
 
@@ -717,8 +1006,17 @@ namespace DynaPlex::Models {
 				<< "\n";
 			*/
 			vars.Get("cat", state.cat);
-			vars.Get("last_event_category", state.last_event_category);
+			std::string last_event_category;
+			vars.Get("last_event_category", last_event_category);
+			state.last_event_category = EventCategoryFromName(last_event_category);
 			vars.Get("next_fil_job_type", state.next_fil_job_type);
+			if (vars.HasKey("pending_fil_mask")) {
+				int64_t mask;
+				vars.Get("pending_fil_mask", mask);
+				state.pending_fil_mask = (uint32_t)mask;
+			}
+			if (vars.HasKey("skipped_idle_run"))
+				vars.Get("skipped_idle_run", state.skipped_idle_run);
 
 			VarGroup qvg, svg;
 			vars.Get("queue", qvg);
@@ -735,7 +1033,7 @@ namespace DynaPlex::Models {
 
 			// Restore arrival_rates (MDP parameter; not always stored in VarGroup)
 			if (state.queue_manager.arrival_rates.empty())
-				state.queue_manager.arrival_rates = arrival_rates;
+				state.queue_manager.arrival_rates.assign(arrival_rates.begin(), arrival_rates.end());
 			// Recompute derived queue rates
 			state.queue_manager.update_total_arrival_rate(arrival_rates);
 			state.queue_manager.update_total_tick_rate(tick_rate);
@@ -812,16 +1110,23 @@ namespace DynaPlex::Models {
 				std::string am;
 				config.Get("action_mode", am);
 				if (am == "per_event")            per_event_mode = true;
+				else if (am == "joint")           joint_mode = true;
 				else if (am == "candidate_queue") per_event_mode = false;
 				else throw DynaPlex::Error("queue_mdp: unknown action_mode '" + am +
-					"' (use \"candidate_queue\" or \"per_event\")");
+					"' (use \"candidate_queue\", \"per_event\" or \"joint\")");
 			}
 			if (per_event_mode && enable_skip_all)
 				throw DynaPlex::Error("queue_mdp: action_mode=per_event is incompatible with enable_skip_all");
+			if (joint_mode && enable_skip_all)
+				throw DynaPlex::Error("queue_mdp: action_mode=joint is incompatible with enable_skip_all (the all-idle assignment is action 0)");
 			if (config.HasKey("force_late_service"))
 				config.Get("force_late_service", force_late_service);
 			if (force_late_service && !per_event_mode)
 				throw DynaPlex::Error("queue_mdp: force_late_service requires action_mode=per_event (escalation semantics are defined on capacity-unit decisions)");
+			if (config.HasKey("skip_idle_steps"))
+				config.Get("skip_idle_steps", skip_idle_steps);
+			if (config.HasKey("live_service_rate_feature"))
+				config.Get("live_service_rate_feature", live_service_rate_feature);
 
 			// action_sort: order in which routing candidates are presented.
 			//   "fifo"         -> FIL descending (oldest first)  [default]
@@ -838,6 +1143,8 @@ namespace DynaPlex::Models {
 				throw DynaPlex::Error("queue_mdp: action_mode=per_event is incompatible with action_sort=reverse_fifo (no candidate ordering exists in per-event mode)");
 			if (per_event_mode && macro_features)
 				throw DynaPlex::Error("queue_mdp: action_mode=per_event does not support macro_features yet (they summarize the candidate queue)");
+			if (joint_mode && macro_features)
+				throw DynaPlex::Error("queue_mdp: action_mode=joint does not support macro_features (they summarize the queue suffix after the current candidate)");
 
 			// enable_action_labels: master toggle for the 3 policy-hint label features.
 			// Default true; set false to reproduce the pre-label (paper) feature vector.
@@ -896,6 +1203,45 @@ namespace DynaPlex::Models {
 				serverConfig.Get("can_serve", server_static_info[i].can_serve);
 			}
 
+			// The State is flat (inline FixedVector storage); reject instances that do
+			// not fit the compile-time capacities instead of overflowing at runtime.
+			if (n_jobs < 1 || (size_t)n_jobs > MaxJobTypes)
+				throw DynaPlex::Error("queue_mdp: n_jobs=" + std::to_string(n_jobs) +
+					" outside [1, " + std::to_string(MaxJobTypes) + "] (raise MDP::MaxJobTypes)");
+			if (k_servers < 1 || (size_t)k_servers > MaxPools)
+				throw DynaPlex::Error("queue_mdp: k_servers=" + std::to_string(k_servers) +
+					" outside [1, " + std::to_string(MaxPools) + "] (raise MDP::MaxPools)");
+			if (max_queue_depth < 1 || (size_t)max_queue_depth > MaxQueueDepth)
+				throw DynaPlex::Error("queue_mdp: max_queue_depth=" + std::to_string(max_queue_depth) +
+					" outside [1, " + std::to_string(MaxQueueDepth) + "] (raise MDP::MaxQueueDepth)");
+			int64_t total_units = 0;
+			for (auto& si : server_static_info) {
+				if (si.can_serve.size() > MaxJobTypes)
+					throw DynaPlex::Error("queue_mdp: a server pool lists more than MaxJobTypes can_serve entries");
+				for (const auto& n : si.can_serve)
+					if (n < 0 || n >= n_jobs)
+						throw DynaPlex::Error("queue_mdp: can_serve entry " + std::to_string(n) +
+							" outside [0, n_jobs=" + std::to_string(n_jobs) + ")");
+				si.BuildLookup(cost_rates);
+				total_units += si.servers;
+			}
+			// per_event mode queues one entry per idle server; the other modes queue at
+			// most one per (pool, type) pair, which MaxCandidates always holds.
+			if (per_event_mode && (size_t)total_units > MaxCandidates)
+				throw DynaPlex::Error("queue_mdp: action_mode=per_event with total servers " + std::to_string(total_units) +
+					" exceeds MDP::MaxCandidates=" + std::to_string(MaxCandidates));
+			if (joint_mode) {
+				// one digit of radix |can_serve_k| + 1 per server (DecodeJointAction)
+				joint_action_count = 1;
+				for (const auto& si : server_static_info)
+					for (int64_t u = 0; u < si.servers; ++u) {
+						joint_action_count *= (int64_t)si.can_serve.size() + 1;
+						if (joint_action_count > MaxJointActions)
+							throw DynaPlex::Error("queue_mdp: action_mode=joint needs more than MDP::MaxJointActions=" +
+								std::to_string(MaxJointActions) + " actions for this instance");
+					}
+			}
+
 			uniformization_rate = tick_rate;
 			// + sum of arrival rates
 			for (const auto& rate : arrival_rates) {
@@ -908,6 +1254,13 @@ namespace DynaPlex::Models {
 				uniformization_rate += max_mu * server_static_info[i].servers;
 			}
 
+			// Shape-specialized kernels (see ShapeKernels), default on
+			bool shape_kernels = true;
+			if (config.HasKey("shape_kernels"))
+				config.Get("shape_kernels", shape_kernels);
+			kernels = shape_kernels ? &SelectKernels(n_jobs, k_servers, max_queue_depth)
+			                        : &SelectKernels(0, 0, 0);
+
 		int_hash = config.Int64Hash();
 
 		#if QUEUE_MDP_DEBUG
@@ -926,12 +1279,8 @@ namespace DynaPlex::Models {
 			MDP::Event event;
 			event.event_sample = event_sample;
 			event.uniform_rate_next_fil = uniform_rate_next_fil;
-			// Draw one uniform per candidate slot for StochasticFIFOPolicy.
-			// Upper bound on candidates: k_servers * n_jobs.
-			int64_t max_candidates = k_servers * n_jobs;
-			event.stochastic_draws.resize((size_t)max_candidates);
-			for (auto& d : event.stochastic_draws)
-				d = rng.genUniform();
+			// StochasticFIFOPolicy's per-slot draws are derived from these two on demand
+			// (StochasticKey / State::StochasticDraw), so no further uniforms are consumed.
 			return event;
 
 		}
@@ -975,33 +1324,36 @@ namespace DynaPlex::Models {
 			std::cout << "[QMDP]   completion start  = "
 				<< (arrival_rate + tick_rate) << "\n";
 		#endif
-			if (event_sample < state.queue_manager.total_arrival_rate) {
+			// Arrival and completion buckets are selected by descending the rate trees kept in the
+			// state (O(log n)) rather than by a cumulative scan; the buckets, their order and the
+			// single draw consumed are the same, so the selected event matches the scan up to
+			// rounding of the partial sums exactly at a bucket boundary.  The bounds between the
+			// arrival, tick and completion ranges are the tree totals, so a sample below a bound
+			// always finds a bucket in its tree.
+			const double arrival_bound = state.queue_manager.arrival_tree.total();
+			const double tick_bound = arrival_bound + state.queue_manager.total_tick_rate;
+			if (event_sample < arrival_bound) {
 				// Arrival event — fires for types whose queue is not yet full
-				double cumulative_rate = 0.0;
-				for (int64_t n = 0; n < n_jobs; ++n) {
-					if ((int64_t)state.queue_manager.waiting[(size_t)n].size() < state.queue_manager.max_queue_depth) {
-						cumulative_rate += arrival_rates[(size_t)n];
-						if (event_sample < cumulative_rate)
-							return Event_type::MakeArrival(n);
-					}
-				}
+				const size_t n = state.queue_manager.arrival_tree.find(event_sample);
+				if (n < (size_t)n_jobs)
+					return Event_type::MakeArrival((int64_t)n);
 			}
 			
-			else if (event_sample < state.queue_manager.total_arrival_rate + state.queue_manager.total_tick_rate) {
+			else if (event_sample < tick_bound) {
 				// Tick event
 				return Event_type::MakeTick();
 			}
 			
 			else {
-				// Job completion event
-				double cumulative_rate = state.queue_manager.total_arrival_rate + state.queue_manager.total_tick_rate;
-				for (int64_t k = 0; k < k_servers; ++k) {
-					for (size_t j = 0; j < server_static_info[(size_t)k].can_serve.size(); ++j) {
-						cumulative_rate += state.server_manager.busy_on[(size_t)k][j] * server_static_info[(size_t)k].mu_kj[j];
-						if (event_sample < cumulative_rate) {							
-							int64_t job_type = server_static_info[k].can_serve[j];
-							return Event_type::MakeCompletion(k, job_type);
-						}
+				// Job completion event; the remainder past the tree total is the "nothing" mass
+				const double completion_sample = event_sample - tick_bound;
+				const auto& completion_tree = state.server_manager.completion_tree;
+				if (completion_sample < completion_tree.total()) {
+					const size_t leaf = completion_tree.find(completion_sample);
+					if (leaf < completion_tree.Capacity()) {
+						const size_t k = leaf / MaxJobTypes;
+						const size_t j = leaf % MaxJobTypes;
+						return Event_type::MakeCompletion((int64_t)k, server_static_info[k].can_serve[j]);
 					}
 				}
 			}
@@ -1043,11 +1395,8 @@ namespace DynaPlex::Models {
 		{
 			// ----- (1) Event category as an integer -----
 			// arrival=0, tick=1, completion=2, nothing=3, unknown=-1
-			int64_t last_evt = -1;
-			if (state.last_event_category == "arrival")     last_evt = 0;
-			else if (state.last_event_category == "tick")        last_evt = 1;
-			else if (state.last_event_category == "completion")  last_evt = 2;
-			else if (state.last_event_category == "nothing")     last_evt = 3;
+			int64_t last_evt = static_cast<int64_t>(state.last_event_category);
+			if (state.last_event_category == EventCategory::FilRefresh) last_evt = -1;
 			features.Add(last_evt);
 
 			// ----- (2) Queue state -----
@@ -1086,7 +1435,8 @@ namespace DynaPlex::Models {
 			features.Add(total_busy_all);
 
 			// Also include the server-side derived rate (you maintain this)
-			features.Add(state.server_manager.total_service_rate);
+			features.Add(live_service_rate_feature ? state.server_manager.completion_tree.total()
+			                                       : state.server_manager.total_service_rate);
 
 			// ----- (4) Action-list state (this is CRUCIAL for learning "defer") -----
 			const int64_t qsize = static_cast<int64_t>(state.server_manager.action_queue.size());
@@ -1116,6 +1466,23 @@ namespace DynaPlex::Models {
 				}
 				return;
 			}
+			// joint mode: one decision covers all candidates, so instead of the current
+			// candidate every (pool, served type) slot is described: 1 if it is a
+			// candidate now, then its labels (-1 when it is not a candidate).  Constant
+			// width sum_k |can_serve_k| * (1 + #labels).
+			if (joint_mode) {
+				for (size_t k = 0; k < server_static_info.size(); ++k)
+					for (const int64_t n : server_static_info[k].can_serve) {
+						const Action* cand = nullptr;
+						for (const Action& a : state.server_manager.action_queue)
+							if (a.server_index == (int64_t)k && a.job_type == n) { cand = &a; break; }
+						features.Add(cand ? 1 : 0);
+						if (label_fifo) features.Add(cand ? (int64_t)cand->is_fifo_winner : -1);
+						if (label_cmu)  features.Add(cand ? (int64_t)cand->is_cmu_winner : -1);
+						if (label_rfq)  features.Add(cand ? (int64_t)cand->is_rfq_winner : -1);
+					}
+				return;
+			}
 			// The 3 policy-hint label features (is_fifo/cmu/rfq_winner) are included only
 			// when enable_action_labels is set (config key "enable_action_labels", default
 			// true).  Disable to reproduce the paper's no-label results and isolate the
@@ -1228,6 +1595,8 @@ namespace DynaPlex::Models {
 			DebugPrintActionQueue(state, "[QMDP]   ");
 		#endif
 			
+			if (joint_mode)
+				return IsAllowedJointAction(state, action);
 			Action current_action = state.server_manager.action_queue.at(state.server_manager.get_action_counter());
 			if (per_event_mode) {
 				// SLA escalation: if this unit can serve a LATE FIL, the assignment
@@ -1287,6 +1656,67 @@ namespace DynaPlex::Models {
 			}
 		}
 
+		MDP::ActionQueue MDP::DecodeJointAction(int64_t action) const {
+			ActionQueue assignment;
+			for (size_t k = 0; k < server_static_info.size(); ++k) {
+				const auto& can_serve = server_static_info[k].can_serve;
+				const int64_t radix = (int64_t)can_serve.size() + 1;
+				for (int64_t u = 0; u < server_static_info[k].servers; ++u) {
+					const int64_t digit = action % radix;
+					action /= radix;
+					if (digit > 0)
+						assignment.push_back(Action{ (int64_t)k, can_serve[(size_t)digit - 1] });
+				}
+			}
+			return assignment;
+		}
+
+		int64_t MDP::EncodeJointAction(const ActionQueue& assignment) const {
+			int64_t action = 0, stride = 1;
+			for (size_t k = 0; k < server_static_info.size(); ++k) {
+				const auto& info = server_static_info[k];
+				const int64_t radix = (int64_t)info.can_serve.size() + 1;
+				int64_t used = 0;
+				for (size_t j = 0; j < info.can_serve.size(); ++j) {
+					const bool serve = std::any_of(assignment.begin(), assignment.end(), [&](const Action& a) {
+						return a.server_index == (int64_t)k && a.job_type == info.can_serve[j]; });
+					if (!serve) continue;
+					if (++used > info.servers)
+						throw DynaPlex::Error("queue_mdp: joint assignment uses more servers than pool " + std::to_string(k) + " has");
+					action += (int64_t)(j + 1) * stride;
+					stride *= radix;
+				}
+				for (; used < info.servers; ++used)
+					stride *= radix;
+			}
+			return action;
+		}
+
+		bool MDP::IsAllowedJointAction(const State& state, int64_t action) const {
+			if (action < 0 || action >= joint_action_count) return false;
+			uint32_t served = 0;
+			for (size_t k = 0; k < server_static_info.size(); ++k) {
+				const auto& info = server_static_info[k];
+				const int64_t radix = (int64_t)info.can_serve.size() + 1;
+				const int64_t idle = info.servers - state.server_manager.pool_busy[k];
+				int64_t prev = 0, used = 0;
+				bool closed = false;   // an idle digit ends the pool's served prefix
+				for (int64_t u = 0; u < info.servers; ++u) {
+					const int64_t digit = action % radix;
+					action /= radix;
+					if (digit == 0) { closed = true; continue; }
+					if (closed || digit <= prev) return false;   // not canonical
+					prev = digit;
+					const int64_t n = info.can_serve[(size_t)digit - 1];
+					const uint32_t bit = uint32_t{ 1 } << n;
+					if (++used > idle || (served & bit) || state.queue_manager.waiting[(size_t)n].empty())
+						return false;
+					served |= bit;
+				}
+			}
+			return true;
+		}
+
 
 		// -----------------------------------------------------------------------
 		// EvaluatePolicyPerStep
@@ -1357,6 +1787,20 @@ namespace DynaPlex::Models {
 			return result;
 		}
 
+		// Skip-ahead for the raw evaluators (skip_idle_steps): consumes an idle run as
+		// real-event steps with the same per-step bookkeeping as the step-by-step loop.
+		// Returns the number of steps consumed (0 if the state does not qualify).
+		static int64_t SkipIdleRunRaw(const MDP& mdp, MDP::State& state, DynaPlex::RNG& rng, int64_t max_steps,
+			double& cumcost, double& cumcost_rvi, double& cumcost_gic)
+		{
+			MDP::IdleRunStats stats;
+			int64_t periods = 0;
+			cumcost += mdp.SkipIdlePeriods(state, rng, max_steps, periods, &stats);
+			cumcost_rvi += (mdp.tick_rate / mdp.uniformization_rate) * stats.binary_cost;
+			cumcost_gic += (mdp.tick_rate / mdp.uniformization_rate) * stats.tick_cost;
+			return periods;
+		}
+
 		// -----------------------------------------------------------------------
 		// EvaluatePolicyRaw
 		// Simulates the policy at the raw MDP level so we can classify every step
@@ -1399,6 +1843,9 @@ namespace DynaPlex::Models {
 						mdp.ModifyStateWithAction(state, a);
 					}
 					else {
+						int64_t skipped = 0;
+						mdp.SkipIdlePeriods(state, rng_provider.GetEventRNG(0), warmup_steps - s, skipped);
+						if ((s += skipped) >= warmup_steps) break;
 						MDP::Event evt = mdp.GetEvent(rng_provider.GetEventRNG(0));
 						mdp.ModifyStateWithEvent(state, evt);
 					}
@@ -1414,6 +1861,10 @@ namespace DynaPlex::Models {
 						++action_steps;
 					}
 					else {
+						const int64_t skipped = SkipIdleRunRaw(mdp, state, rng_provider.GetEventRNG(0),
+							steps_per_traj - s, cumcost, cumcost_rvi, cumcost_gic);
+						real_event_steps += skipped;
+						if ((s += skipped) >= steps_per_traj) break;
 						bool is_fil_refresh = (state.next_fil_job_type != -1);
 						// RVI-style: charge per-step at AwaitEvent states with FIL > due_time
 						// (before applying the event, using the current state's FIL — same as RVI)
@@ -1609,6 +2060,9 @@ namespace DynaPlex::Models {
 						if (state.cat == DynaPlex::StateCategory::AwaitAction())
 							mdp.ModifyStateWithAction(state, get_action(state));
 						else {
+							int64_t skipped = 0;
+							mdp.SkipIdlePeriods(state, rng_provider.GetEventRNG(0), warmup_steps - s, skipped);
+							if ((s += skipped) >= warmup_steps) break;
 							MDP::Event evt = mdp.GetEvent(rng_provider.GetEventRNG(0));
 							mdp.ModifyStateWithEvent(state, evt);
 						}
@@ -1623,6 +2077,10 @@ namespace DynaPlex::Models {
 							mdp.ModifyStateWithAction(state, get_action(state));
 							++action_steps;
 						} else {
+							const int64_t skipped = SkipIdleRunRaw(mdp, state, rng_provider.GetEventRNG(0),
+								steps_per_traj - s, cumcost, cumcost_rvi, cumcost_gic);
+							real_event_steps += skipped;
+							if ((s += skipped) >= steps_per_traj) break;
 							bool is_fil_refresh = (state.next_fil_job_type != -1);
 							if (!is_fil_refresh) {
 								double rvi_step_cost = 0.0;
@@ -1830,9 +2288,9 @@ namespace DynaPlex::Models {
 					s.server_manager.busy_on[0][0] = 1;
 
 					// Generate the action queue and reset counter
-					s.server_manager.generate_actions(s.queue_manager.get_FIL_waiting(), mdp.cost_rates, mdp.sort_descending);
-					s.server_manager.set_action_counter(0);
 					s.server_manager.update_total_service_rate();
+					s.server_manager.generate_actions(s.queue_manager.get_FIL_waiting(), mdp.sort_descending);
+					s.server_manager.set_action_counter(0);
 
 					s.next_fil_job_type = -1;
 					s.cat = DynaPlex::StateCategory::AwaitAction();
@@ -1919,9 +2377,9 @@ namespace DynaPlex::Models {
 					s.queue_manager.set_fil(1, (int64_t)f1);
 					s.server_manager.initialize(&mdp.server_static_info, mdp.n_jobs);
 					s.server_manager.busy_on[0][0] = 1;
-					s.server_manager.generate_actions(s.queue_manager.get_FIL_waiting(), mdp.cost_rates, mdp.sort_descending);
-					s.server_manager.set_action_counter(0);
 					s.server_manager.update_total_service_rate();
+					s.server_manager.generate_actions(s.queue_manager.get_FIL_waiting(), mdp.sort_descending);
+					s.server_manager.set_action_counter(0);
 					s.next_fil_job_type = -1;
 					s.cat = DynaPlex::StateCategory::AwaitAction();
 
@@ -2036,9 +2494,9 @@ namespace DynaPlex::Models {
 					s.queue_manager.set_fil(1, (int64_t)f1);
 					s.server_manager.initialize(&mdp.server_static_info, mdp.n_jobs);
 					s.server_manager.busy_on[0][0] = 1;
-					s.server_manager.generate_actions(s.queue_manager.get_FIL_waiting(), mdp.cost_rates, mdp.sort_descending);
-					s.server_manager.set_action_counter(0);
 					s.server_manager.update_total_service_rate();
+					s.server_manager.generate_actions(s.queue_manager.get_FIL_waiting(), mdp.sort_descending);
+					s.server_manager.set_action_counter(0);
 					s.next_fil_job_type = -1;
 					s.cat = DynaPlex::StateCategory::AwaitAction();
 
@@ -2135,9 +2593,9 @@ namespace DynaPlex::Models {
 					s.queue_manager.set_fil(1, (int64_t)f1);
 					s.server_manager.initialize(&mdp.server_static_info, mdp.n_jobs);
 					s.server_manager.busy_on[0][0] = 1;
-					s.server_manager.generate_actions(s.queue_manager.get_FIL_waiting(), mdp.cost_rates, mdp.sort_descending);
-					s.server_manager.set_action_counter(0);
 					s.server_manager.update_total_service_rate();
+					s.server_manager.generate_actions(s.queue_manager.get_FIL_waiting(), mdp.sort_descending);
+					s.server_manager.set_action_counter(0);
 					s.next_fil_job_type = -1;
 					s.cat = DynaPlex::StateCategory::AwaitAction();
 
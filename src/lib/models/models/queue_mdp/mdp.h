@@ -1,6 +1,8 @@
 ﻿#pragma once
 #include "dynaplex/dynaplex_model_includes.h"
 #include "dynaplex/modelling/discretedist.h"
+#include "dynaplex/modelling/fixedvector.h"
+#include "dynaplex/modelling/ratetree.h"
 #include "dynaplex/mdp.h"       // DynaPlex::MDP, DynaPlex::Trajectory
 #include "dynaplex/policy.h"    // DynaPlex::Policy
 #include <deque>
@@ -8,8 +10,19 @@
 #include <sstream>
 #include <algorithm>
 #include <cstdint>
+#include <array>
+#include <bit>
+#include <bitset>
+#include <compare>
+#include <cstring>
+#include <iomanip>
+#include <iterator>
+#include <memory>
+#include <ostream>
+#include <type_traits>
 #include <vector>
 #include <functional>
+#include <span>
 #include <unordered_map>
 #include <cmath>
 #include <cstdlib>
@@ -21,11 +34,77 @@ namespace DynaPlex::Models {
 		{			
 		public:	
 			double discount_factor;
+
+			// Compile-time capacity of the flat State.  All per-state containers are
+			// DynaPlex::FixedVector with inline storage, so State is trivially copyable
+			// and clone / assignment is a single block copy.  The constructor rejects
+			// configs that exceed these limits; raise them here if an instance needs more.
+			static constexpr size_t MaxJobTypes   = 8;
+			static constexpr size_t MaxPools      = 8;
+			static constexpr size_t MaxQueueDepth = 8;
+			static constexpr size_t MaxCandidates = MaxPools * MaxJobTypes;  // also bounds sum of servers in per_event mode
+
+			// Instance shape the hot-path kernels are compiled for (see ShapeKernels).
+			// DynamicShape takes the sizes from the instance at run time; FixedShape<N, K, D>
+			// makes them compile-time constants, so the loops get constant trip counts and
+			// the scratch arrays shrink to the instance.
+			struct DynamicShape {
+				static constexpr bool   fixed = false;
+				static constexpr size_t jobs = MaxJobTypes, pools = MaxPools, depth = MaxQueueDepth;
+			};
+			template <size_t N_JOBS, size_t K_POOLS, size_t DEPTH>
+			struct FixedShape {
+				static_assert(N_JOBS >= 1 && N_JOBS <= MaxJobTypes, "queue_mdp::FixedShape: N_JOBS outside [1, MaxJobTypes]");
+				static_assert(K_POOLS >= 1 && K_POOLS <= MaxPools, "queue_mdp::FixedShape: K_POOLS outside [1, MaxPools]");
+				static_assert(DEPTH >= 1 && DEPTH <= MaxQueueDepth, "queue_mdp::FixedShape: DEPTH outside [1, MaxQueueDepth]");
+				static constexpr bool   fixed = true;
+				static constexpr size_t jobs = N_JOBS, pools = K_POOLS, depth = DEPTH;
+			};
 			
 			struct ServerStaticInfo {
 				int64_t servers = 0;
 				std::vector<double> mu_kj;       // mu_kj[j] = service rate for can_serve[j]
 				std::vector<int64_t> can_serve;  // types of jobs it can serve
+
+				// Dense lookup derived from can_serve by BuildLookup() (called by the MDP constructor):
+				// slot_of_type[n] = index of type n in can_serve (-1 if not served), and
+				// serve_mask has bit n set iff the pool can serve type n.
+				std::array<int, MaxJobTypes> slot_of_type = [] { std::array<int, MaxJobTypes> a{}; a.fill(-1); return a; }();
+				uint32_t serve_mask = 0;
+				// cmu_better_mask[n] = served types whose c*mu in this pool is strictly larger than
+				// that of type n.  The c*mu rank of a candidate is a popcount against the pool's
+				// candidate mask (see LabelActionQueue).
+				std::array<uint32_t, MaxJobTypes> cmu_better_mask{};
+
+				void BuildLookup(const std::vector<double>& cost_rates) {
+					slot_of_type.fill(-1);
+					serve_mask = 0;
+					for (size_t j = 0; j < can_serve.size(); ++j) {
+						const int64_t n = can_serve[j];
+						if (n < 0 || (size_t)n >= MaxJobTypes)
+							throw DynaPlex::Error("queue_mdp: can_serve entry " + std::to_string(n) + " outside [0, MaxJobTypes)");
+						if (slot_of_type[(size_t)n] < 0) {   // first occurrence wins (matches a linear find)
+							slot_of_type[(size_t)n] = (int)j;
+							serve_mask |= (uint32_t{ 1 } << n);
+						}
+					}
+					if (mu_kj.size() < can_serve.size())
+						throw DynaPlex::Error("queue_mdp: a server pool has fewer service_rates than can_serve entries");
+
+					auto cmu_of = [&](size_t n) {
+						const double c = (n < cost_rates.size()) ? cost_rates[n] : 0.0;
+						return mu_kj[(size_t)slot_of_type[n]] * c;
+					};
+					cmu_better_mask.fill(0);
+					for (uint32_t a = serve_mask; a != 0; a &= a - 1) {
+						const size_t n = (size_t)std::countr_zero(a);
+						for (uint32_t b = serve_mask; b != 0; b &= b - 1) {
+							const size_t m = (size_t)std::countr_zero(b);
+							if (cmu_of(m) > cmu_of(n))
+								cmu_better_mask[n] |= (uint32_t{ 1 } << m);
+						}
+					}
+				}
 			};
 
 			struct Action {
@@ -73,59 +152,94 @@ namespace DynaPlex::Models {
 				}
 			};
 
+			// Flat per-state containers (inline storage, see Max* above).
+			using FILVector   = DynaPlex::FixedVector<int64_t, MaxJobTypes>;     // one entry per job type, -1 = empty
+			using BusyRow     = DynaPlex::FixedVector<int64_t, MaxJobTypes>;     // busy_on[k][j], j indexes can_serve
+			using ActionQueue = DynaPlex::FixedVector<Action, MaxCandidates>;
+			using WaitingList = DynaPlex::FixedVector<int64_t, MaxQueueDepth>;  // [0]=FIL, [1]=SIL, ...
+
+			// Category of the last event applied to the state.  The integer values
+			// are the NN feature encoding (arrival=0, tick=1, completion=2,
+			// nothing=3, unknown=-1); fil_refresh is reported as unknown.
+			enum class EventCategory : int64_t {
+				Unknown = -1, Arrival = 0, Tick = 1, Completion = 2, Nothing = 3, FilRefresh = 4
+			};
+			// String form used in VarGroup round-trips (backward compatible with saved states).
+			static std::string EventCategoryName(EventCategory c);
+			static EventCategory EventCategoryFromName(const std::string& name);
+
 
 			struct ServerDynamicState{
 				// Reference to static info (not owned)
 				const std::vector<ServerStaticInfo>* static_info = nullptr;
-				std::vector<std::vector<int64_t>> busy_on;
+				DynaPlex::FixedVector<BusyRow, MaxPools> busy_on;
 				
-				std::deque<Action> action_queue;
-				int64_t action_counter;
-
-				double total_service_rate;
+				ActionQueue action_queue;
+				int64_t action_counter = 0;
+
+				// Derived from busy_on and kept current by assign_job / complete_job.
+				// Code that writes busy_on directly must call update_total_service_rate() afterwards.
+				DynaPlex::FixedVector<int64_t, MaxPools> pool_busy;   // pool_busy[k] = sum_j busy_on[k][j]
+				// NN feature input, with its original semantics: sum_kj busy_on[k][j] * mu_kj as of the
+				// last update_total_service_rate() (0 after initialize); assign_job and complete_job leave
+				// it alone.  The live busy rate is completion_tree.total() (see live_service_rate_feature).
+				double total_service_rate = 0.0;
+				// completion_tree leaf CompletionLeaf(k, j) = busy_on[k][j] * mu_kj[j]; GetEventType
+				// samples the completing (pool, type) bucket from it in O(log(MaxPools * MaxJobTypes)).
+				DynaPlex::RateTree<MaxPools * MaxJobTypes> completion_tree;
+
+				static size_t CompletionLeaf(size_t k, size_t j) { return k * MaxJobTypes + j; }
 
 				ServerDynamicState() = default;
 				
 
+				// Candidate order: FIL first, then smaller pool index, then smaller job index.
 				// descending=true  -> FIFO order   (oldest first, larger FIL first)
 				// descending=false -> reverse-FIFO (newest first, smaller FIL first)
 				// Only the primary (FIL) key flips; tie-breakers stay deterministic so the
-				// queue order is reproducible in both modes.
-				void SortActionsFIFO(std::deque<Action>& actions,
-					const std::vector<int64_t>& FIL_waiting,
-					bool descending = true)
+				// queue order is reproducible in both modes.  (k, job) pairs are unique in the
+				// queue, so this is a strict total order and the sorted queue is unique.
+				static bool ActionPrecedes(const Action& a, const Action& b,
+					const FILVector& FIL_waiting, bool descending)
 				{
-					// Stable sort so that ties keep previous relative order (useful for reproducibility)
-					std::stable_sort(actions.begin(), actions.end(),
-						[&](const Action& a, const Action& b) {
-							const int64_t wa = (a.job_type >= 0 && (size_t)a.job_type < FIL_waiting.size())
-								? FIL_waiting[(size_t)a.job_type]
-								: INT64_MIN;
-							const int64_t wb = (b.job_type >= 0 && (size_t)b.job_type < FIL_waiting.size())
-								? FIL_waiting[(size_t)b.job_type]
-								: INT64_MIN;
+					const int64_t wa = (a.job_type >= 0 && (size_t)a.job_type < FIL_waiting.size())
+						? FIL_waiting[(size_t)a.job_type]
+						: INT64_MIN;
+					const int64_t wb = (b.job_type >= 0 && (size_t)b.job_type < FIL_waiting.size())
+						? FIL_waiting[(size_t)b.job_type]
+						: INT64_MIN;
 
-							// Primary: FIL order (descending = oldest first; ascending = newest first)
-							if (wa != wb) return descending ? (wa > wb) : (wa < wb);
+					// Primary: FIL order (descending = oldest first; ascending = newest first)
+					if (wa != wb) return descending ? (wa > wb) : (wa < wb);
 
-							// Secondary: smaller server pool index first
-							if (a.server_index != b.server_index) return a.server_index < b.server_index;
+					// Secondary: smaller server pool index first
+					if (a.server_index != b.server_index) return a.server_index < b.server_index;
 
-							// Tertiary: smaller job index first
-							return a.job_type < b.job_type;
-						});
+					// Tertiary: smaller job index first
+					return a.job_type < b.job_type;
+				}
+
+				void SortActionsFIFO(ActionQueue& actions,
+					const FILVector& FIL_waiting,
+					bool descending = true)
+				{
+					std::sort(actions.begin(), actions.end(),
+						[&](const Action& a, const Action& b) { return ActionPrecedes(a, b, FIL_waiting, descending); });
 				}
 
 				void initialize(const std::vector<ServerStaticInfo>* static_info_ptr, int64_t n_jobs) {
 					static_info = static_info_ptr;
 					busy_on.clear();
+					pool_busy.clear();
 					if (!static_info) return;
 					busy_on.resize(static_info->size());
+					pool_busy.resize(static_info->size(), 0);
 					for (size_t k = 0; k < static_info->size(); ++k) {
 						busy_on[k].resize((*static_info)[k].can_serve.size(), 0);
 					}
 
 					total_service_rate = 0.0;
+					completion_tree.clear();
 					//initialize empty queue
 					action_queue.clear();
 					action_counter = 0;
@@ -135,54 +249,77 @@ namespace DynaPlex::Models {
 				
 				// -----------------------------------------------------------------
 				// LabelActionQueue
-				// For each entry in action_queue, sets the three winner flags using a
-				// capacity-aware full-queue scan:
+				// For each entry in action_queue, sets the three winner flags:
 				//   is_X_winner = 1  iff  (# same-pool entries with strictly better X) < capacity_k
 				// where capacity_k = static_info[k].servers - n_servers_busy_server_k(k).
-				// Must be called AFTER SortActionsFIFO and BEFORE any actions are taken.
+				// The counts are rank queries, O(queue) in total: the queue is sorted by FIL,
+				// so within a pool the entries with strictly larger (smaller) FIL are those
+				// before (after) the entry's FIL tie group; the c*mu count is a popcount of
+				// the pool's candidate types against the static cmu_better_mask.
+				// Must be called on a sorted queue (SortActionsFIFO) and BEFORE any actions are taken.
 				// -----------------------------------------------------------------
-				void LabelActionQueue(const std::vector<int64_t>& FIL_waiting,
-				                      const std::vector<double>& cost_rates)
-				{
-					const int64_t n = static_cast<int64_t>(action_queue.size());
-
-					// Helper: c*µ for pool k serving job type j.
-					auto cmu_of = [&](int64_t k, int64_t j) -> double {
-						int idx = canServeIndex(*static_info, k, j);
-						if (idx < 0) return 0.0;
-						const double mu = (*static_info)[static_cast<size_t>(k)].mu_kj[static_cast<size_t>(idx)];
-						const double c  = (j >= 0 && static_cast<size_t>(j) < cost_rates.size())
-						                  ? cost_rates[static_cast<size_t>(j)] : 0.0;
-						return mu * c;
-					};
+				void LabelActionQueue(const FILVector& FIL_waiting, bool descending = true) {
+					LabelActions(action_queue, *static_info, pool_busy, FIL_waiting, descending);
+				}
 
-					// Helper: FIL for job type j (-INT64_MAX when type has no entry).
+				// Static form for candidate queues held outside a ServerDynamicState (BatchSimulator)
+				// and for the ShapeKernels; pool_busy is any container indexed by pool.
+				template <typename Shape = DynamicShape, typename PoolBusy>
+				static void LabelActions(ActionQueue& action_queue, const std::vector<ServerStaticInfo>& static_info,
+					const PoolBusy& pool_busy, const FILVector& FIL_waiting, bool descending)
+				{
+					const size_t n = action_queue.size();
 					auto fil_of = [&](int64_t j) -> int64_t {
 						return (j >= 0 && static_cast<size_t>(j) < FIL_waiting.size())
 						       ? FIL_waiting[static_cast<size_t>(j)] : INT64_MIN;
 					};
 
-					for (int64_t i = 0; i < n; ++i) {
-						Action& a    = action_queue[static_cast<size_t>(i)];
-						const int64_t k   = a.server_index;
-						const int64_t fil_a = fil_of(a.job_type);
-						const double  cmu_a = cmu_of(k, a.job_type);
+					// Forward pass: per entry, # same-pool entries before its FIL tie group.
+					// (before[i] is written for every entry before it is read.)
+					std::array<int64_t, Shape::pools> seen{}, group_start{};
+					std::array<int64_t, Shape::pools> group_fil;
+					group_fil.fill(INT64_MIN);
+					std::array<bool, Shape::pools> started{};
+					std::array<uint32_t, Shape::pools> types_in_pool{};
+					std::array<int64_t, Shape::jobs * Shape::pools> before;
+					for (size_t i = 0; i < n; ++i) {
+						const Action& a = action_queue[i];
+						const size_t k = (size_t)a.server_index;
+						const int64_t f = fil_of(a.job_type);
+						if (!started[k] || f != group_fil[k]) {
+							started[k] = true;
+							group_fil[k] = f;
+							group_start[k] = seen[k];
+						}
+						before[i] = group_start[k];
+						++seen[k];
+						if (a.job_type >= 0 && (size_t)a.job_type < MaxJobTypes)
+							types_in_pool[k] |= (uint32_t{ 1 } << a.job_type);
+					}
 
-						// capacity_k: idle servers available in pool k right now
-						const int64_t cap = (*static_info)[static_cast<size_t>(k)].servers
-						                  - n_servers_busy_server_k(k);
-
-						int64_t cnt_fifo = 0, cnt_cmu = 0, cnt_rfq = 0;
-						for (int64_t m = 0; m < n; ++m) {
-							if (m == i) continue;
-							const Action& b = action_queue[static_cast<size_t>(m)];
-							if (b.server_index != k) continue;
-							const int64_t fil_b = fil_of(b.job_type);
-							const double  cmu_b = cmu_of(k, b.job_type);
-							if (fil_b > fil_a) ++cnt_fifo;
-							if (cmu_b > cmu_a) ++cnt_cmu;
-							if (fil_b < fil_a) ++cnt_rfq;
+					// Backward pass: # same-pool entries after the tie group, then label.
+					std::array<int64_t, Shape::pools> seen_back{}, group_end{};
+					started.fill(false);
+					for (size_t i = n; i-- > 0;) {
+						Action& a = action_queue[i];
+						const size_t k = (size_t)a.server_index;
+						const int64_t f = fil_of(a.job_type);
+						if (!started[k] || f != group_fil[k]) {
+							started[k] = true;
+							group_fil[k] = f;
+							group_end[k] = seen_back[k];
 						}
+						const int64_t after = group_end[k];
+						++seen_back[k];
+
+						const int64_t cnt_fifo = descending ? before[i] : after;   // strictly larger FIL
+						const int64_t cnt_rfq  = descending ? after : before[i];   // strictly smaller FIL
+						const ServerStaticInfo& info = static_info[k];
+						const int64_t cnt_cmu = (a.job_type >= 0 && (size_t)a.job_type < MaxJobTypes)
+							? std::popcount(types_in_pool[k] & info.cmu_better_mask[(size_t)a.job_type]) : 0;
+
+						// capacity_k: idle servers available in pool k right now
+						const int64_t cap = info.servers - pool_busy[k];
 
 						a.is_fifo_winner = (cnt_fifo < cap) ? 1 : 0;
 						a.is_cmu_winner  = (cnt_cmu  < cap) ? 1 : 0;
@@ -190,8 +327,7 @@ namespace DynaPlex::Models {
 					}
 				}
 
-				void generate_actions(std::vector<int64_t> FIL_waiting,
-				                      const std::vector<double>& cost_rates,
+				void generate_actions(const FILVector& FIL_waiting,
 				                      bool sort_descending = true) {
 					#if QUEUE_MDP_DEBUG
 					std::cout << "\n[QMDP] generate_actions called\n";
@@ -199,36 +335,105 @@ namespace DynaPlex::Models {
 						<< ", old action_counter = " << action_counter << "\n";
 					#endif
 							
-					// generate possible actions based on current busy_on and FIL_waiting
-					// if FIL_waiting[n] >=0 and there is idle server for job n, add action
-					action_queue.clear();
-					
-					for (size_t n = 0; n < FIL_waiting.size(); ++n) {
-						if (FIL_waiting[n] >= 0) { // job n is waiting
-							for (size_t k = 0; k < busy_on.size(); ++k) {
-								int idx = canServeIndex(*static_info, static_cast<int64_t>(k), static_cast<int64_t>(n));
-								int64_t busy_servers = n_servers_busy_server_k(k);
-								if (idx >= 0) { // server k can serve job n
-									if (busy_servers < (*static_info)[k].servers) {
-										// there is idle server for job n
-										// add option as many times as there is capacity
-										action_queue.push_back(Action{ static_cast<int64_t>(k), static_cast<int64_t>(n) });
-										
-									}
-								}
-
-							}
-						}
-					}
+					BuildActions(action_queue, *static_info, pool_busy, FIL_waiting, sort_descending);
 
 					#if QUEUE_MDP_DEBUG
 					std::cout << "[QMDP]   new queue size = " << action_queue.size()
 						<< ", action_counter (unchanged) = " << action_counter << "\n";
 					#endif
+				}
+
+				// generate possible actions based on pool_busy and FIL_waiting:
+				// one (k, n) entry for every pool k with an idle server that can serve a waiting type n.
+				// Insertion order is irrelevant: the sort imposes a total order on (FIL, k, n).
+				template <typename Shape = DynamicShape, typename PoolBusy>
+				static void BuildActions(ActionQueue& action_queue, const std::vector<ServerStaticInfo>& static_info,
+					const PoolBusy& pool_busy, const FILVector& FIL_waiting, bool sort_descending)
+				{
+					action_queue.clear();
+
+					const uint32_t waiting_mask = WaitingMask(FIL_waiting);
+					for (size_t k = 0; k < NumPools<Shape>(static_info); ++k) {
+						const ServerStaticInfo& info = static_info[k];
+						if (pool_busy[k] >= info.servers) continue;
+						for (uint32_t m = info.serve_mask & waiting_mask; m != 0; m &= m - 1)
+							action_queue.push_back(Action{ static_cast<int64_t>(k), static_cast<int64_t>(std::countr_zero(m)) });
+					}
+
+					std::sort(action_queue.begin(), action_queue.end(),
+						[&](const Action& a, const Action& b) { return ActionPrecedes(a, b, FIL_waiting, sort_descending); });
+					LabelActions<Shape>(action_queue, static_info, pool_busy, FIL_waiting, sort_descending);
+				}
+
+				template <typename Shape>
+				static size_t NumPools(const std::vector<ServerStaticInfo>& static_info) {
+					if constexpr (Shape::fixed)
+						return Shape::pools;
+					else
+						return static_info.size();
+				}
+
+				// -----------------------------------------------------------------
+				// Incremental counterparts of generate_actions.
+				// Precondition: action_queue equals what generate_actions produced for the
+				// state just before the change (the simulation event path maintains this;
+				// truncated RVI states, whose FIL is clamped in place, do not and must use
+				// generate_actions).  Only the entries of the changed job type / pool are
+				// removed and re-inserted at their sorted position, then the labels are
+				// recomputed; the result equals a full generate_actions.
+				// -----------------------------------------------------------------
+
+				// FIL of job type n changed (became waiting, was refreshed, or emptied).
+				void update_actions_for_type(int64_t n, const FILVector& FIL_waiting,
+				                             bool sort_descending = true) {
+					UpdateActionsForType(action_queue, *static_info, pool_busy, n, FIL_waiting, sort_descending);
+				}
+
+				// Idle capacity of pool k changed (completion or assignment).
+				void update_actions_for_pool(int64_t k, const FILVector& FIL_waiting,
+				                             bool sort_descending = true) {
+					UpdateActionsForPool(action_queue, *static_info, pool_busy, k, FIL_waiting, sort_descending);
+				}
 
-					SortActionsFIFO(action_queue, FIL_waiting, sort_descending);
-					LabelActionQueue(FIL_waiting, cost_rates);
+				// Static forms of the two updates above (see LabelActions).
+				template <typename Shape = DynamicShape, typename PoolBusy>
+				static void UpdateActionsForType(ActionQueue& action_queue, const std::vector<ServerStaticInfo>& static_info,
+					const PoolBusy& pool_busy, int64_t n, const FILVector& FIL_waiting, bool sort_descending)
+				{
+					action_queue.erase(
+						std::remove_if(action_queue.begin(), action_queue.end(),
+							[n](const Action& a) { return a.job_type == n; }),
+						action_queue.end());
+					if (FIL_waiting[(size_t)n] >= 0) {
+						for (size_t k = 0; k < NumPools<Shape>(static_info); ++k) {
+							const ServerStaticInfo& info = static_info[k];
+							if (info.slot_of_type[(size_t)n] < 0 || pool_busy[k] >= info.servers) continue;
+							InsertSorted(action_queue, Action{ static_cast<int64_t>(k), n }, FIL_waiting, sort_descending);
+						}
+					}
+					LabelActions<Shape>(action_queue, static_info, pool_busy, FIL_waiting, sort_descending);
+				}
+
+				template <typename Shape = DynamicShape, typename PoolBusy>
+				static void UpdateActionsForPool(ActionQueue& action_queue, const std::vector<ServerStaticInfo>& static_info,
+					const PoolBusy& pool_busy, int64_t k, const FILVector& FIL_waiting, bool sort_descending)
+				{
+					action_queue.erase(
+						std::remove_if(action_queue.begin(), action_queue.end(),
+							[k](const Action& a) { return a.server_index == k; }),
+						action_queue.end());
+					const ServerStaticInfo& info = static_info[(size_t)k];
+					if (pool_busy[(size_t)k] < info.servers) {
+						for (uint32_t m = info.serve_mask & WaitingMask(FIL_waiting); m != 0; m &= m - 1)
+							InsertSorted(action_queue, Action{ k, static_cast<int64_t>(std::countr_zero(m)) }, FIL_waiting, sort_descending);
+					}
+					LabelActions<Shape>(action_queue, static_info, pool_busy, FIL_waiting, sort_descending);
+				}
 
+				static void InsertSorted(ActionQueue& action_queue, const Action& a, const FILVector& FIL_waiting, bool sort_descending) {
+					auto pos = std::upper_bound(action_queue.begin(), action_queue.end(), a,
+						[&](const Action& x, const Action& y) { return ActionPrecedes(x, y, FIL_waiting, sort_descending); });
+					action_queue.insert(pos, a);
 				}
 
 				// Per-event action space (action_mode="per_event"): one queue entry per
@@ -238,46 +443,36 @@ namespace DynaPlex::Models {
 				// waiting type; the queue is built once per epoch and not regenerated
 				// mid-epoch (mid-epoch feasibility loss degrades an entry to idle-only,
 				// absorbed as a trivial state).
-				void generate_actions_per_event(std::vector<int64_t> FIL_waiting) {
+				void generate_actions_per_event(const FILVector& FIL_waiting) {
 					action_queue.clear();
 
+					const uint32_t waiting_mask = WaitingMask(FIL_waiting);
 					for (size_t k = 0; k < busy_on.size(); ++k) {
 						const int64_t cap = (*static_info)[k].servers - n_servers_busy_server_k((int64_t)k);
 						if (cap <= 0) continue;
-						bool feasible = false;
-						for (size_t n = 0; n < FIL_waiting.size(); ++n) {
-							if (FIL_waiting[n] >= 0 &&
-							    canServeIndex(*static_info, (int64_t)k, (int64_t)n) >= 0) {
-								feasible = true;
-								break;
-							}
-						}
-						if (!feasible) continue;
+						if (((*static_info)[k].serve_mask & waiting_mask) == 0) continue;
 						for (int64_t c = 0; c < cap; ++c)
 							action_queue.push_back(Action{ static_cast<int64_t>(k), -1 });
 					}
 				}
 
-				int64_t n_servers_busy_server_k(int64_t k) const {
-					int64_t total_busy = 0;
+				// bit n set iff job type n has a waiting job
+				static uint32_t WaitingMask(const FILVector& FIL_waiting) {
+					uint32_t mask = 0;
+					for (size_t n = 0; n < FIL_waiting.size(); ++n)
+						if (FIL_waiting[n] >= 0)
+							mask |= (uint32_t{ 1 } << n);
+					return mask;
+				}
 
-					for (size_t j = 0; j < busy_on[k].size(); ++j) {
-						total_busy += busy_on[k][j];
-					}
-					return total_busy;
+				int64_t n_servers_busy_server_k(int64_t k) const {
+					return pool_busy[(size_t)k];
 				}
 
 				// can_assign job if action can be taken based on current busy_on
 				bool can_assign_job(int64_t k, int64_t job) const {
-					int idx = canServeIndex(*static_info, k, job);
-					if (idx < 0) return false;
-
-					// Check if the number of busy servers for this server type is less than the total servers
-					if (n_servers_busy_server_k(k) >= (*static_info)[(size_t)k].servers)
-						return false;
-
-					// Check if this specific job slot is available for this server type
-					return true;
+					if (canServeIndex(*static_info, k, job) < 0) return false;
+					return pool_busy[(size_t)k] < (*static_info)[(size_t)k].servers;
 				}
 
 
@@ -301,57 +496,26 @@ namespace DynaPlex::Models {
 						throw std::runtime_error("action_counter out of bounds in take_action");
 					}
 
-					// Snapshot old state
-					std::deque<Action> old_queue = action_queue;
-					int64_t old_counter = action_counter;
-
-					Action taken_action = action_queue[(size_t)action_counter];
+					const int64_t old_counter = action_counter;
+					const Action taken_action = action_queue[(size_t)action_counter];
 
 					// --- Perform the action (busy_on, etc.) ---
 					assign_job(taken_action.server_index, taken_action.job_type);
 
 					// --- Update action_queue: remove ONLY impossible actions ---
-					
-					action_queue.erase(
-						std::remove_if(
-							action_queue.begin(),
-							action_queue.end(),
-							[this](const Action& a) {
-								return !can_assign_job(a.server_index, a.job_type);
-							}
-						),
-						action_queue.end()
-					);
-
-					// --- Recompute action_counter ---
-					//
-					// processed = old_queue[0 .. old_counter]  (INCLUSIVE!)
-					// new_counter = number of actions at the front of action_queue
-					//               that belong to processed.
-
+					// Compaction keeps the relative order, so the surviving entries of the
+					// processed prefix old_queue[0 .. old_counter] (INCLUSIVE: the executed
+					// action counts as processed) form the prefix of the new queue, and the
+					// new action_counter is simply how many of them survive.
 					int64_t new_counter = 0;
-
-					for (const auto& new_act : action_queue) {
-						bool was_processed = false;
-
-						// Note the <= : we include the executed action as "processed"
-						for (int64_t i = 0; i <= old_counter; ++i) {
-							const auto& old_act = old_queue[(size_t)i];
-							if (old_act.server_index == new_act.server_index &&
-								old_act.job_type == new_act.job_type) {
-								was_processed = true;
-								break;
-							}
-						}
-
-						if (was_processed) {
-							++new_counter;
-						}
-						else {
-							// First unprocessed action in the new queue  stop
-							break;
-						}
+					size_t kept = 0;
+					for (size_t i = 0; i < action_queue.size(); ++i) {
+						const Action a = action_queue[i];
+						if (!can_assign_job(a.server_index, a.job_type)) continue;
+						if ((int64_t)i <= old_counter) ++new_counter;
+						action_queue[kept++] = a;
 					}
+					action_queue.resize(kept);
 
 					action_counter = new_counter;
 				}
@@ -368,9 +532,11 @@ namespace DynaPlex::Models {
 				void assign_job(int64_t k, int64_t job) {
 					int idx = canServeIndex(*static_info, k, job);
 					if (idx < 0) return;
-					if (busy_on[(size_t)k][(size_t)idx] >= (*static_info)[(size_t)k].servers) return;
+					const ServerStaticInfo& info = (*static_info)[(size_t)k];
+					if (busy_on[(size_t)k][(size_t)idx] >= info.servers) return;
 					busy_on[(size_t)k][(size_t)idx] += 1;
-
+					pool_busy[(size_t)k] += 1;
+					refresh_completion_leaf((size_t)k, (size_t)idx);
 				}
 
 				// Free one server in pool k from job type `job`.
@@ -380,23 +546,36 @@ namespace DynaPlex::Models {
 					if (idx < 0) return;
 					if (busy_on[(size_t)k][(size_t)idx] <= 0) return;
 					busy_on[(size_t)k][(size_t)idx] -= 1;
+					pool_busy[(size_t)k] -= 1;
+					refresh_completion_leaf((size_t)k, (size_t)idx);
+				}
+
+				void refresh_completion_leaf(size_t k, size_t j) {
+					completion_tree.set(CompletionLeaf(k, j), busy_on[k][j] * (*static_info)[k].mu_kj[j]);
 				}
 
 				//returns the index of job in can_serve vector of server k, -1 if cannot serve
 				static int canServeIndex(const std::vector<ServerStaticInfo>& S, int64_t k, int64_t job) {
-					const auto& v = S[(size_t)k].can_serve;
-					auto it = std::find(v.begin(), v.end(), job);
-					return (it == v.end()) ? -1 : (int)std::distance(v.begin(), it);
+					if (job < 0 || (size_t)job >= MaxJobTypes) return -1;
+					return S[(size_t)k].slot_of_type[(size_t)job];
 				}
 
 				
-				//update total service rate
+				// Recomputes pool_busy, completion_tree and total_service_rate from busy_on.
 				void update_total_service_rate() {
-					if (!static_info) {
-						total_service_rate = 0.0;
-						return;
+					pool_busy.resize(busy_on.size());
+					for (size_t k = 0; k < busy_on.size(); ++k) {
+						int64_t total_busy = 0;
+						for (const auto& b : busy_on[k]) total_busy += b;
+						pool_busy[k] = total_busy;
 					}
-					total_service_rate = get_total_service_rate(*this, *static_info);
+					completion_tree.clear();
+					total_service_rate = 0.0;
+					if (!static_info) return;
+					for (size_t k = 0; k < busy_on.size(); ++k)
+						for (size_t j = 0; j < busy_on[k].size(); ++j)
+							refresh_completion_leaf(k, j);
+					total_service_rate = completion_tree.total();
 				}
 
 				inline double get_total_service_rate(const ServerDynamicState& dyn,
@@ -414,8 +593,7 @@ namespace DynaPlex::Models {
 					int idx = canServeIndex(S, k, job);
 					if (idx < 0) return false;
 					if (dyn.busy_on[(size_t)k][(size_t)idx] >= S[(size_t)k].servers) return false;
-					dyn.busy_on[(size_t)k][(size_t)idx] += 1;
-					total_service_rate += S[(size_t)k].mu_kj[(size_t)idx];  // idx already computed above
+					dyn.assign_job(k, job);
 					return true;
 				}
 
@@ -451,12 +629,18 @@ namespace DynaPlex::Models {
 					vg.Get("busy_on_rows", rows);
 
 					busy_on.clear();
-					busy_on.reserve((size_t)rows);
 
 					for (int64_t k = 0; k < rows; ++k) {
-						std::vector<int64_t> row;
+						BusyRow row;
 						vg.Get("busy_on_" + std::to_string(k), row);
-						busy_on.push_back(std::move(row));
+						busy_on.push_back(row);
+					}
+					// total_service_rate needs static_info; the owner recomputes it once attached.
+					pool_busy.clear();
+					for (const auto& row : busy_on) {
+						int64_t total_busy = 0;
+						for (const auto& b : row) total_busy += b;
+						pool_busy.push_back(total_busy);
 					}
 
 					// service rate might be derived; only load if you truly store it
@@ -499,6 +683,16 @@ namespace DynaPlex::Models {
 			// capacity unit decides once per epoch: 0 = idle, a in 1..n_jobs = serve
 			// type a-1's FIL; valid_actions = n_jobs+1, strict masking).
 			bool per_event_mode = false;
+			// joint action space (config "action_mode": "joint"): ONE decision per
+			// epoch assigns any subset of the current candidates at once -- each
+			// waiting type's FIL to at most one pool, at most the idle capacity per
+			// pool.  The served types' FILs are then refreshed one event at a time
+			// (State::pending_fil_mask) before the next epoch.  The candidate queue is
+			// maintained as in candidate_queue mode; valid_actions =
+			// joint_action_count, encoding in DecodeJointAction.
+			bool joint_mode = false;
+			int64_t joint_action_count = 1;
+			static constexpr int64_t MaxJointActions = int64_t{ 1 } << 16;
 			// SLA escalation (config "force_late_service", per_event only): when a
 			// capacity unit can serve a LATE FIL (age > due), the assignment is
 			// FORCED via IsAllowedAction masking (oldest late first, ties -> lower
@@ -506,6 +700,19 @@ namespace DynaPlex::Models {
 			// trivial-state machinery auto-plays them: the learned policy only
 			// ever decides pre-deadline.  Non-preemptive, per-pool.
 			bool force_late_service = false;
+			// Simulation shortcut (config "skip_idle_steps", default off): runs of uniformized
+			// steps that change nothing but FIL ages (ticks and self-loops while no decision is
+			// pending) are sampled and applied in one shot by SkipIdlePeriods.  Used by the
+			// EvaluatePolicyRaw* evaluators and, if discount_factor is 1, by the generic
+			// MDPAdapter (PolicyComparer and the other trajectory-based algorithms); skipped steps
+			// count as periods there.  Trajectories differ from step-by-step simulation for the
+			// same seed, but not in distribution.
+			bool skip_idle_steps = false;
+			// Feature fix (config "live_service_rate_feature", default off): the total service rate
+			// feature reports the live busy rate, completion_tree.total(), instead of
+			// ServerDynamicState::total_service_rate, which assign_job / complete_job do not update.
+			// Changes the NN inputs, so networks trained without it must be retrained.
+			bool live_service_rate_feature = false;
 			int64_t max_queue_depth;  // tracked positions per job type: 1=FIL only (default)
 			int64_t feature_queue_depth; // NN feature slots per job type (>= max_queue_depth; pads with 0)
 			int64_t int_hash = 0;        // config hash — used by EvaluatePolicyRaw(Policy) to build type-erased states
@@ -513,27 +720,32 @@ namespace DynaPlex::Models {
 			struct multi_queue {
 				// waiting[n] = deque of waiting times for job type n, front = FIL (oldest).
 				// Empty deque means no job of type n is currently waiting.
-				int64_t max_queue_depth;                     // max tracked positions (from MDP config)
-				std::vector<std::deque<int64_t>> waiting;    // waiting[n][0]=FIL, [1]=SIL, [2]=TIL, ...
-				std::vector<double> arrival_rates;
-				double total_tick_rate;
-				double total_arrival_rate;
+				int64_t max_queue_depth = 1;                            // max tracked positions (from MDP config)
+				DynaPlex::FixedVector<WaitingList, MaxJobTypes> waiting; // waiting[n][0]=FIL, [1]=SIL, [2]=TIL, ...
+				DynaPlex::FixedVector<double, MaxJobTypes> arrival_rates;
+				double total_tick_rate = 0.0;
+				double total_arrival_rate = 0.0;
+				// arrival_tree leaf n = arrival rate of type n while its queue has room, 0 once full
+				// (the buckets get_total_arrival_rate sums).  Kept current by arrival / complete_job /
+				// update_total_arrival_rate; GetEventType samples the arriving type from it.
+				DynaPlex::RateTree<MaxJobTypes> arrival_tree;
 
 				multi_queue() = default;
 
 				void initialize(int64_t n_jobs, double tick_rate,
-				                std::vector<double> rates, int64_t depth = 1) {
+				                const std::vector<double>& rates, int64_t depth = 1) {
 					max_queue_depth   = depth;
-					waiting.assign((size_t)n_jobs, std::deque<int64_t>{});
+					waiting.assign((size_t)n_jobs, WaitingList{});
 					total_tick_rate   = tick_rate;
 					total_arrival_rate = 0.0;
 					for (const auto& r : rates) total_arrival_rate += r;
-					this->arrival_rates = std::move(rates);
+					arrival_rates.assign(rates.begin(), rates.end());
+					rebuild_arrival_tree(rates);
 				}
 
 				// ---- Computed FIL shim (backward-compatible; used by generate_actions, RVI, etc.) ----
-				std::vector<int64_t> get_FIL_waiting() const {
-					std::vector<int64_t> out(waiting.size());
+				FILVector get_FIL_waiting() const {
+					FILVector out(waiting.size());
 					for (size_t n = 0; n < waiting.size(); ++n)
 						out[n] = waiting[n].empty() ? -1 : waiting[n].front();
 					return out;
@@ -545,14 +757,14 @@ namespace DynaPlex::Models {
 					waiting[(size_t)n].clear();
 					if (val >= 0)
 						waiting[(size_t)n].push_back(val);
-					total_arrival_rate = get_total_arrival_rate(arrival_rates);
+					update_total_arrival_rate(arrival_rates);
 				}
 
-				// ---- Clamp FIL to M for each type (RVI truncation) ----
+				// ---- Clamp every tracked waiting time to M (RVI truncation; the FIL is the largest) ----
 				void clamp_fil(int64_t M) {
 					for (auto& q : waiting)
-						if (!q.empty())
-							q.front() = std::min(q.front(), M);
+						for (auto& t : q)
+							t = std::min(t, M);
 				}
 
 				// ---- Arrival: job of type n joins the back of the queue at waiting time 0 ----
@@ -562,17 +774,19 @@ namespace DynaPlex::Models {
 					if ((int64_t)waiting[(size_t)n].size() < max_queue_depth) {
 						waiting[(size_t)n].push_back(0);
 						// If this filled the last slot, remove from arrival process
-						if ((int64_t)waiting[(size_t)n].size() == max_queue_depth)
+						if ((int64_t)waiting[(size_t)n].size() == max_queue_depth) {
 							total_arrival_rate -= arrival_rates[(size_t)n];
+							arrival_tree.set((size_t)n, 0.0);
+						}
 					}
 					// If already at max_queue_depth: event cannot fire (total_arrival_rate excludes it)
 				}
 
-				// ---- Tick: increment all tracked waiting times by 1 ----
-				void tick() {
+				// ---- Tick: increment all tracked waiting times by 1 (or by `ticks` at once) ----
+				void tick(int64_t ticks = 1) {
 					for (auto& q : waiting)
 						for (auto& t : q)
-							++t;
+							t += ticks;
 				}
 
 				// ---- complete_job: FIL served -> shift-up, Koole-sample new bottom position ----
@@ -609,17 +823,36 @@ namespace DynaPlex::Models {
 						new_bottom = (int64_t)sample_next_fil_after_completion(
 							(int)old_bottom, arrival_rates[(size_t)n], total_tick_rate, uniform_draw);
 					}
+					refill_bottom(n, was_full, new_bottom);
+				}
 
+				// ---- serve_fil: complete_job with the new bottom given instead of sampled ----
+				// RVI enumerates new_bottom over NextFILDistribution(waiting[n].back()).
+				void serve_fil(int64_t n, int64_t new_bottom) {
+					auto& q = waiting[(size_t)n];
+					if (q.empty())
+						throw std::runtime_error("serve_fil: queue is empty for type " + std::to_string(n));
+					const bool was_full = ((int64_t)q.size() == max_queue_depth);
+					q.pop_front();
+					refill_bottom(n, was_full, new_bottom);
+				}
+
+				// Appends the new bottom (if any) after the FIL of type n was popped.
+				void refill_bottom(int64_t n, bool was_full, int64_t new_bottom) {
+					auto& q = waiting[(size_t)n];
 					if (new_bottom >= 0)
 						q.push_back(new_bottom);
 
 					// If queue was full and is now not full, re-enable arrivals for this type
-					if (was_full && (int64_t)q.size() < max_queue_depth)
+					if (was_full && (int64_t)q.size() < max_queue_depth) {
 						total_arrival_rate += arrival_rates[(size_t)n];
+						arrival_tree.set((size_t)n, arrival_rates[(size_t)n]);
+					}
 				}
 
 				// ---- Rate helpers ----
-				double get_total_arrival_rate(const std::vector<double>& rates) const {
+				template <typename Rates>
+				double get_total_arrival_rate(const Rates& rates) const {
 					double total = 0.0;
 					for (size_t n = 0; n < waiting.size(); ++n)
 						if ((int64_t)waiting[n].size() < max_queue_depth)
@@ -627,8 +860,21 @@ namespace DynaPlex::Models {
 					return total;
 				}
 
-				void update_total_arrival_rate(const std::vector<double>& rates) {
+				template <typename Rates>
+				void update_total_arrival_rate(const Rates& rates) {
 					total_arrival_rate = get_total_arrival_rate(rates);
+					rebuild_arrival_tree(rates);
+				}
+
+				void update_total_arrival_rate(const std::vector<double>& rates) {
+					update_total_arrival_rate<std::vector<double>>(rates);
+				}
+
+				template <typename Rates>
+				void rebuild_arrival_tree(const Rates& rates) {
+					arrival_tree.clear();
+					for (size_t n = 0; n < waiting.size(); ++n)
+						arrival_tree.set(n, ((int64_t)waiting[n].size() < max_queue_depth) ? rates[n] : 0.0);
 				}
 
 				void update_total_tick_rate(double tick_rate) {
@@ -650,7 +896,7 @@ namespace DynaPlex::Models {
 				}
 
 				// ---- Koole geometric sampler (unchanged logic) ----
-				inline int sample_next_fil_after_completion(
+				static int sample_next_fil_after_completion(
 					int i,
 					double lambda,   // arrival rate for this job type
 					double gamma,    // tick rate
@@ -691,11 +937,8 @@ namespace DynaPlex::Models {
 					int64_t n_types = 0;
 					vg.Get("n_types", n_types);
 					waiting.resize((size_t)n_types);
-					for (int64_t n = 0; n < n_types; ++n) {
-						std::vector<int64_t> q;
-						vg.Get("waiting_" + std::to_string(n), q);
-						waiting[(size_t)n] = std::deque<int64_t>(q.begin(), q.end());
-					}
+					for (int64_t n = 0; n < n_types; ++n)
+						vg.Get("waiting_" + std::to_string(n), waiting[(size_t)n]);
 					vg.Get("total_tick_rate",    total_tick_rate);
 					vg.Get("total_arrival_rate", total_arrival_rate);
 					if (vg.HasKey("arrival_rates"))
@@ -716,20 +959,38 @@ namespace DynaPlex::Models {
 				multi_queue queue_manager;
 
 				int64_t next_fil_job_type = -1;  // which queue needs refresh
+				// joint mode: bit n set iff type n was served by the last joint action and
+				// its FIL refresh follows the current one (lowest type first)
+				uint32_t pending_fil_mask = 0;
+
+				// Set by SkipIdlePeriods when it stopped at the first step that is an arrival or
+				// completion: that step is left to the next event, which is then drawn
+				// conditionally on not being idle.  Cleared by ModifyStateWithEvent.
+				bool skipped_idle_run = false;
 
 
-				std::string last_event_category;
+				EventCategory last_event_category = EventCategory::Unknown;
 
-				// Ephemeral uniform draws for StochasticFIFOPolicy.
-				// Populated from Event.stochastic_draws at every AwaitAction entry.
-				// Not serialised — defaults to empty (policy falls back to action=1).
-				std::vector<double> stochastic_draws;
+				// Key of the ephemeral uniform draws for StochasticFIFOPolicy, set from the last
+				// event at every AwaitAction entry (see StochasticKey).  Draw i is computed on
+				// demand by StochasticDraw(i); nothing is stored per slot.
+				// Not serialised — 0 means "no draws yet" (policy falls back to action=1).
+				uint64_t stochastic_key = 0;
+
+				// Counter-based uniform in [0,1) for candidate slot i: SplitMix64 output at
+				// position i of the stream seeded by stochastic_key.
+				double StochasticDraw(int64_t slot) const {
+					XoshiroCpp::SplitMix64 gen{ stochastic_key + 0x9e3779b97f4a7c15ULL * (uint64_t)slot };
+					return XoshiroCpp::DoubleFromBits(gen());
+				}
 
 				DynaPlex::StateCategory cat;
 				DynaPlex::VarGroup ToVarGroup() const;
 
 
 			};
+			static_assert(std::is_trivially_copyable_v<State>,
+				"queue_mdp::MDP::State must stay trivially copyable (flat, allocation-free clone)");
 			//Event may also be struct or class like.
 			struct Event_type {
 				enum class Type { Arrival, Tick, JobCompletion, Nothing };
@@ -783,8 +1044,15 @@ namespace DynaPlex::Models {
 			struct Event {
 				double event_sample;
 				double uniform_rate_next_fil;
-				std::vector<double> stochastic_draws;  // one uniform draw per candidate slot
 			};
+			// Key for State::StochasticDraw.  The two uniforms of an event are a function of
+			// (trajectory seed, event index), so hashing their bits keys the per-slot draws on
+			// the same; never 0.
+			static uint64_t StochasticKey(const Event& event) {
+				XoshiroCpp::SplitMix64 gen{ std::bit_cast<uint64_t>(event.event_sample)
+					^ std::rotl(std::bit_cast<uint64_t>(event.uniform_rate_next_fil), 32) };
+				return gen() | 1;
+			}
 
 			struct nextStateProbability {
 				MDP::State next_state;
@@ -815,30 +1083,551 @@ namespace DynaPlex::Models {
 			
 			static std::vector<std::pair<int64_t, double>> NextFILDistribution(int64_t i, double lambda, double gamma);
 			std::vector<nextStateProbability> getNextStateProbability(const MDP::State& state, int64_t action) const;
+			// Same, into out (cleared first): a caller that enumerates many states keeps one
+			// buffer instead of allocating and freeing a vector of States per call.
+			void getNextStateProbability(const MDP::State& state, int64_t action,
+			                             std::vector<nextStateProbability>& out) const;
 			double GetImmediateCost(const State& state) const;
 			double ComputeTickCost(const State& state) const;
 			// rtype-override variant: lets RVI evaluate the BINARY base cost when
 			// reward_type==2 (shaping preserves the optimal policy; RVI's state-cost
 			// structure cannot represent the action-tied shaping terms).
 			double ComputeTickCost(const State& state, int64_t rtype) const;
+			// Contribution of job type n to ComputeTickCost, for tracked ages ages[0..depth)
+			// (ages[0] = FIL, depth >= 1), added to cost in the same order ComputeTickCost adds it.
+			void AddTypeTickCost(size_t n, const int64_t* ages, size_t depth, int64_t rtype, double& cost) const;
+
+			// Hot paths of the event and transition code, compiled per instance shape.  The
+			// constructor selects the FixedShape instantiation matching (n_jobs, k_servers,
+			// max_queue_depth) from the table in kernels.cpp, or the DynamicShape fallback for
+			// any other shape (config "shape_kernels": false forces the fallback).  Every
+			// instantiation computes the same values in the same order, so the choice never
+			// changes a trajectory.
+			struct ShapeKernels {
+				const char* shape;   // "NxKxD", or "dynamic"
+				void (*build_actions)(ActionQueue&, const std::vector<ServerStaticInfo>&,
+					const int64_t* pool_busy, const FILVector&, bool sort_descending);
+				void (*update_actions_for_type)(ActionQueue&, const std::vector<ServerStaticInfo>&,
+					const int64_t* pool_busy, int64_t n, const FILVector&, bool sort_descending);
+				void (*update_actions_for_pool)(ActionQueue&, const std::vector<ServerStaticInfo>&,
+					const int64_t* pool_busy, int64_t k, const FILVector&, bool sort_descending);
+				FILVector (*fil_waiting)(const multi_queue&);
+				void (*tick)(multi_queue&);
+				double (*tick_cost)(const MDP&, const State&, int64_t rtype);
+			};
+			static const ShapeKernels& SelectKernels(int64_t n_jobs, int64_t n_pools, int64_t depth);
+			const ShapeKernels* kernels = nullptr;
+			// Candidate-queue maintenance of the event / transition code, through kernels.
+			void BuildCandidates(State& state) const;
+
+			// Joint action space (joint_mode).  An action is a mixed-radix number with one
+			// digit per server, pools in index order and the pool's servers least
+			// significant first: digit 0 = idle, d = serve can_serve[d-1] of the pool.
+			// The digits of a pool are its factor of the assignment; the canonical code
+			// of a pool serving a set of types puts their slots, increasing, in its first
+			// servers and zeros after (servers of a pool are interchangeable).
+			ActionQueue DecodeJointAction(int64_t action) const;              // (pool, type) pairs, pool-major
+			int64_t EncodeJointAction(const ActionQueue& assignment) const;   // canonical code
+			// Canonical code whose pairs are all current candidates, each type at most once.
+			bool IsAllowedJointAction(const State& state, int64_t action) const;
+			// Joint action that walks the candidate queue in order and serves every
+			// candidate a with take(a), while its pool has idle capacity left and its
+			// type is not served yet.  take = always true gives FIFO.
+			template <typename Take>
+			int64_t GreedyJointAction(const State& state, Take take) const {
+				const auto& sm = state.server_manager;
+				std::array<int64_t, MaxPools> idle{};
+				for (size_t k = 0; k < server_static_info.size(); ++k)
+					idle[k] = server_static_info[k].servers - sm.pool_busy[k];
+				uint32_t served = 0;
+				ActionQueue assignment;
+				for (const Action& a : sm.action_queue) {
+					const uint32_t bit = uint32_t{ 1 } << a.job_type;
+					if ((served & bit) || idle[(size_t)a.server_index] <= 0 || !take(a)) continue;
+					served |= bit;
+					--idle[(size_t)a.server_index];
+					assignment.push_back(a);
+				}
+				return EncodeJointAction(assignment);
+			}
+			void UpdateCandidatesForType(State& state, int64_t n) const;
+			void UpdateCandidatesForPool(State& state, int64_t k) const;
 			// urgency of a waiting job of type n with waiting time t (ticks):
 			// cost_rates[n] * min(t,D)/D, 0 when D<1.  The potential is
 			// Phi(s) = -sum_n JobUrgency(n, FIL_n).
 			double JobUrgency(int64_t n, int64_t t) const;
+			// Sum of the tick costs of `ticks` consecutive ticks applied to state (closed form
+			// except for reward_type 4, which is stepped).
+			double ComputeTickRunCost(const State& state, int64_t ticks) const;
+
+			// Per-step sums over the idle steps consumed by SkipIdlePeriods, evaluated at each
+			// step's pre-event state: ComputeTickCost(state, 0) and ComputeTickCost(state).
+			// Lets EvaluatePolicyRaw keep its RVI-style diagnostics exact under skip-ahead.
+			struct IdleRunStats {
+				double binary_cost = 0.0;
+				double tick_cost = 0.0;
+			};
+			// Skip-ahead (see skip_idle_steps).  If the state awaits an event with no decision
+			// pending, samples the number of consecutive idle steps (ticks and self-loops) before
+			// the next arrival or completion, capped at max_periods, applies their ticks and returns
+			// their summed tick cost.  Without stats this takes a geometric draw for the run length
+			// and a binomial draw for its ticks; with stats one geometric draw per tick.  `periods` receives the number of steps consumed (0 if the
+			// state does not qualify or skip_idle_steps is off).
+			double SkipIdlePeriods(State& state, DynaPlex::RNG& rng, int64_t max_periods, int64_t& periods,
+				IdleRunStats* stats = nullptr) const;
+
+			// Key of a state in RVI: an unsigned 128-bit integer, in two words so that it is
+			// the same on every compiler.  It has just what the mixed-radix encoding needs:
+			// push_digit appends a digit below the others (Horner), pop_digit takes the lowest
+			// one off; every radix is below 2^32.  A key with hi == 0 is narrow, and the
+			// solver keeps one word per state while all its keys are narrow.
+			struct RVIKey {
+				uint64_t lo = 0, hi = 0;
+
+				constexpr RVIKey() = default;
+				constexpr RVIKey(uint64_t lo, uint64_t hi = 0) : lo(lo), hi(hi) {}
+				constexpr bool narrow() const { return hi == 0; }
+
+				// *this = *this * radix + digit, modulo 2^128.
+				constexpr void push_digit(uint64_t radix, uint64_t digit) {
+					const uint64_t l0 = (lo & 0xffffffffu) * radix + digit;
+					const uint64_t l1 = (lo >> 32) * radix + (l0 >> 32);
+					lo = (l1 << 32) | (l0 & 0xffffffffu);
+					hi = hi * radix + (l1 >> 32);
+				}
+				// Divides by radix and returns the remainder.
+				constexpr uint64_t pop_digit(uint64_t radix) {
+					if (hi == 0) {
+						const uint64_t digit = lo % radix;
+						lo /= radix;
+						return digit;
+					}
+					const uint64_t r = hi % radix;
+					hi /= radix;
+					const uint64_t upper = (r << 32) | (lo >> 32);
+					const uint64_t lower = ((upper % radix) << 32) | (lo & 0xffffffffu);
+					lo = ((upper / radix) << 32) | (lower / radix);
+					return lower % radix;
+				}
+				// Key >> bits and key & (2^bits - 1), for 0 < bits < 64.
+				constexpr RVIKey shifted(unsigned bits) const { return { (lo >> bits) | (hi << (64 - bits)), hi >> bits }; }
+				constexpr RVIKey unshifted(unsigned bits, uint64_t low) const { return { (lo << bits) | low, (hi << bits) | (lo >> (64 - bits)) }; }
+
+				// 64-bit mix of both words (the murmur3 finaliser).
+				constexpr uint64_t hash() const {
+					uint64_t x = lo ^ (hi * 0x9e3779b97f4a7c15ull);
+					x ^= x >> 33;
+					x *= 0xff51afd7ed558ccdull;
+					x ^= x >> 33;
+					x *= 0xc4ceb9fe1a85ec53ull;
+					return x ^ (x >> 33);
+				}
+
+				friend constexpr bool operator==(const RVIKey&, const RVIKey&) = default;
+				friend constexpr std::strong_ordering operator<=>(const RVIKey& a, const RVIKey& b) {
+					if (a.hi != b.hi) return a.hi <=> b.hi;
+					return a.lo <=> b.lo;
+				}
+				friend std::ostream& operator<<(std::ostream& out, RVIKey key) {
+					if (key.narrow()) return out << key.lo;
+					std::vector<uint64_t> chunks;   // nine decimal digits each, lowest first
+					while (!key.narrow())
+						chunks.push_back(key.pop_digit(1000000000));
+					std::ostringstream text;
+					text << key.lo << std::setfill('0');
+					for (auto c = chunks.rbegin(); c != chunks.rend(); ++c)
+						text << std::setw(9) << *c;
+					return out << text.str();
+				}
+			};
+			struct RVIKeyHash {
+				size_t operator()(const RVIKey& key) const { return (size_t)key.hash(); }
+			};
+
+			// Mixed-radix key of the states RVI works on, lowest digit first: the waiting
+			// times of the depth tracked positions of each type (type by type, FIL first),
+			// clamped to M and shifted by one so that an empty position is 0 (radix M+2),
+			// busy_on[k][j] (radix servers_k + 1), the AwaitAction flag and the
+			// action_counter.  encode clamps on the fly, so a live state is looked up without
+			// copying it; positions beyond depth are not encoded.  The key space is the
+			// product of the radices; wide is set when it needs more than 64 bits, and then
+			// keys are built in 128-bit arithmetic.  The constructor throws if even that is
+			// too small.
+			struct RVIKeyEncoder {
+				static constexpr size_t MaxDigits = MaxJobTypes * MaxQueueDepth + MaxCandidates;  // waiting-time and busy digits
+				int M = 0;
+				int depth = 1;                     // tracked positions per type: the MDP's max_queue_depth
+				std::vector<uint64_t> busy_radix;  // busy_on digits in [k][j] order
+				bool wide = false;
+
+				RVIKeyEncoder() = default;
+				RVIKeyEncoder(const MDP& mdp, int M);
+
+				RVIKey encode(const State& state) const {
+					if (wide) return encode_wide(state);
+					uint64_t key = 0, stride = 1;
+					for (const auto& q : state.queue_manager.waiting)
+						for (size_t p = 0; p < (size_t)depth; ++p) {
+							const int64_t age = p < q.size() ? std::min(q[p], (int64_t)M) : -1;
+							key += (uint64_t)(age + 1) * stride;
+							stride *= (uint64_t)M + 2;
+						}
+					size_t d = 0;
+					for (const auto& row : state.server_manager.busy_on)
+						for (int64_t b : row) {
+							key += (uint64_t)b * stride;
+							stride *= busy_radix[d++];
+						}
+					if (state.cat == DynaPlex::StateCategory::AwaitAction())
+						key += stride;
+					stride *= 2;
+					return key + (uint64_t)state.server_manager.get_action_counter() * stride;
+				}
+				RVIKey encode_wide(const State& state) const;
+			};
+
+			// Interchangeable job types and server pools, for runRVI's lump_symmetric.  Two
+			// types are interchangeable when their arrival rate, cost rate and due time agree
+			// and every pool serves both at the same rate or neither; two pools when their
+			// servers, can_serve and service_rates agree.  Permuting them maps the chain onto
+			// itself, so the AwaitEvent states of one orbit share their relative value and the
+			// solve keeps a single one.  canonical maps the key of an AwaitEvent state to the
+			// key of its orbit: the least key over the type permutations, each taken with the
+			// busy rows of interchangeable pools sorted.  Action states are not lumped: the
+			// order in which a decision epoch visits its candidates depends on the indices.
+			struct RVISymmetry {
+				size_t order = 1;    // orbit size bound: type permutations times pool permutations
+				size_t n_types = 0;
+				size_t depth = 1;    // waiting-time digits per type
+				std::vector<std::vector<uint16_t>> digit_of;  // per type permutation: new position of each waiting-time and busy digit
+				std::vector<std::vector<size_t>> pool_classes; // interchangeable pools, two or more per class
+				std::vector<size_t> row_begin;                 // first busy digit of each pool, then the end; row_begin[0] = n_types * depth
+
+				RVISymmetry() = default;
+				explicit RVISymmetry(const MDP& mdp);
+				bool trivial() const { return order == 1; }
+				RVIKey canonical(const RVIKeyEncoder& encoder, RVIKey key) const;
+			};
+
+			// Two-level paged array indexed by an RVIKeyEncoder key: a page holds PageSize
+			// consecutive keys and a bit per key that is present.  Pages of keys below
+			// 2^DenseBits are found through a dense index, so such a lookup is a shift, two
+			// loads and a bit test; in that range the key space is about ten times the number
+			// of reachable states (most busy_on and category digit combinations never occur),
+			// and only the pages that hold a key are allocated.  Pages of larger (wide) keys
+			// are found through an open-addressing hash table of page numbers.  Iteration
+			// visits the dense keys in ascending order, then the other pages one by one.
+			// Insertion invalidates references to values.  A table can also be a read-only
+			// view of pages inside a mapped cache file (see LoadRVISolution); the mapping is
+			// shared by every copy of the view.
+			template <class T>
+			class RVIKeyTable {
+				static constexpr unsigned PageBits = 10;
+				static constexpr uint64_t PageSize = uint64_t{ 1 } << PageBits;
+				static constexpr unsigned DenseBits = 32;
+				struct Page {
+					std::array<T, PageSize> value{};
+					std::bitset<PageSize> present;
+				};
+				struct Slot {
+					RVIKey page;         // page number: key >> PageBits
+					uint64_t index = 0;  // 1 + index into the pages, 0 = empty slot
+				};
+				static_assert(std::is_trivially_copyable_v<std::bitset<PageSize>> && std::is_standard_layout_v<Page>
+				              && std::is_trivially_copyable_v<Slot> && sizeof(Slot) == 24,
+					"queue_mdp::RVIKeyTable: pages are written to and mapped from cache files byte for byte");
+
+				std::vector<uint32_t> own_index;  // own_index[key >> PageBits] = 1 + index into own_pages, 0 = none
+				std::vector<Slot> own_slots;      // power-of-two size, at most half full
+				std::vector<Page> own_pages;
+				std::shared_ptr<const void> mapping;  // set for a view of a mapped file
+				std::span<const uint32_t> page_of;    // own_index, or the index inside the mapping
+				std::span<const Slot> slots;          // own_slots, or the slots inside the mapping
+				std::span<const Page> pages;          // own_pages, or the pages inside the mapping
+				size_t count = 0;
+				size_t n_slots_used = 0;
+
+				void sync() { page_of = own_index; slots = own_slots; pages = own_pages; }
+				static bool dense(const RVIKey& key) { return key.narrow() && (key.lo >> DenseBits) == 0; }
+				// Slot of page number p: the one holding it, else the empty one that ends its probe.
+				size_t probe(const RVIKey& p) const {
+					const size_t mask = slots.size() - 1;
+					size_t s = (size_t)p.hash() & mask;
+					while (slots[s].index != 0 && slots[s].page != p) s = (s + 1) & mask;
+					return s;
+				}
+				const Page* page(const RVIKey& key) const {
+					if (dense(key)) {
+						const uint64_t p = key.lo >> PageBits;
+						return p < page_of.size() && page_of[p] != 0 ? &pages[page_of[p] - 1] : nullptr;
+					}
+					if (slots.empty()) return nullptr;
+					const Slot& slot = slots[probe(key.shifted(PageBits))];
+					return slot.index != 0 ? &pages[slot.index - 1] : nullptr;
+				}
+
+			public:
+				class const_iterator {
+				public:
+					using iterator_category = std::forward_iterator_tag;
+					using value_type        = std::pair<RVIKey, T>;
+					using difference_type   = std::ptrdiff_t;
+					using pointer           = const value_type*;
+					using reference         = const value_type&;
+
+					const_iterator() = default;
+					reference operator*() const { return current; }
+					pointer operator->() const { return &current; }
+					const_iterator& operator++() {
+						if (dense_key < dense_end()) ++dense_key;
+						else ++offset;
+						seek();
+						return *this;
+					}
+					const_iterator operator++(int) { const_iterator old = *this; ++*this; return old; }
+					bool operator==(const const_iterator& other) const {
+						return dense_key == other.dense_key && slot == other.slot && offset == other.offset;
+					}
+					bool operator!=(const const_iterator& other) const { return !(*this == other); }
+
+				private:
+					friend class RVIKeyTable;
+					const_iterator(const RVIKeyTable* table, bool at_end) : table(table) {
+						if (at_end) {
+							dense_key = dense_end();
+							slot = table->slots.size();
+						}
+						else seek();
+					}
+					uint64_t dense_end() const { return (uint64_t)table->page_of.size() << PageBits; }
+
+					// Advances to the next present key (or the end): dense keys first, then the
+					// keys of the hashed pages, slot by slot.
+					void seek() {
+						for (const uint64_t end = dense_end(); dense_key < end; ++dense_key) {
+							const uint32_t p = table->page_of[dense_key >> PageBits];
+							if (p == 0) { dense_key |= PageSize - 1; continue; }
+							const Page& page = table->pages[p - 1];
+							if (page.present[dense_key & (PageSize - 1)]) {
+								current = { RVIKey(dense_key), page.value[dense_key & (PageSize - 1)] };
+								return;
+							}
+						}
+						for (; slot < table->slots.size(); ++slot, offset = 0) {
+							const Slot& s = table->slots[slot];
+							if (s.index == 0) continue;
+							const Page& page = table->pages[s.index - 1];
+							for (; offset < PageSize; ++offset)
+								if (page.present[offset]) {
+									current = { s.page.unshifted(PageBits, offset), page.value[offset] };
+									return;
+								}
+						}
+						offset = 0;
+					}
+
+					const RVIKeyTable* table = nullptr;
+					uint64_t dense_key = 0;
+					size_t slot = 0;
+					uint64_t offset = 0;
+					value_type current{};
+				};
+
+				RVIKeyTable() = default;
+				RVIKeyTable(const RVIKeyTable& other)
+					: own_index(other.own_index), own_slots(other.own_slots), own_pages(other.own_pages),
+					  mapping(other.mapping), page_of(other.page_of), slots(other.slots), pages(other.pages),
+					  count(other.count), n_slots_used(other.n_slots_used) {
+					if (!mapping) sync();
+				}
+				// Vector buffers, and so the spans into them, move along.
+				RVIKeyTable(RVIKeyTable&& other) noexcept
+					: own_index(std::move(other.own_index)), own_slots(std::move(other.own_slots)),
+					  own_pages(std::move(other.own_pages)), mapping(std::move(other.mapping)),
+					  page_of(other.page_of), slots(other.slots), pages(other.pages),
+					  count(other.count), n_slots_used(other.n_slots_used) {
+					other.page_of = {};
+					other.slots = {};
+					other.pages = {};
+					other.count = 0;
+					other.n_slots_used = 0;
+				}
+				RVIKeyTable& operator=(RVIKeyTable other) noexcept {
+					std::swap(own_index, other.own_index);
+					std::swap(own_slots, other.own_slots);
+					std::swap(own_pages, other.own_pages);
+					std::swap(mapping, other.mapping);
+					std::swap(page_of, other.page_of);
+					std::swap(slots, other.slots);
+					std::swap(pages, other.pages);
+					std::swap(count, other.count);
+					std::swap(n_slots_used, other.n_slots_used);
+					return *this;
+				}
+
+				// Pointer to the value stored for key, nullptr if there is none.
+				const T* find(const RVIKey& key) const {
+					const Page* p = page(key);
+					return p && p->present[key.lo & (PageSize - 1)] ? &p->value[key.lo & (PageSize - 1)] : nullptr;
+				}
+				bool contains(const RVIKey& key) const { return find(key) != nullptr; }
+
+				// Value stored for key, value-initialised and inserted if there is none.
+				T& operator[](const RVIKey& key) {
+					if (mapping)
+						throw DynaPlex::Error("queue_mdp::RVIKeyTable: a view of a cache file is read-only");
+					uint64_t index;   // 1 + index into own_pages
+					if (dense(key)) {
+						const uint64_t p = key.lo >> PageBits;
+						if (p >= own_index.size()) own_index.resize(p + 1, 0);
+						if (own_index[p] == 0) {
+							own_pages.emplace_back();
+							own_index[p] = (uint32_t)own_pages.size();
+						}
+						index = own_index[p];
+					}
+					else {
+						if (2 * (n_slots_used + 1) > own_slots.size()) {   // rehash into twice the slots
+							std::vector<Slot> old(std::max<size_t>(64, 2 * own_slots.size()));
+							old.swap(own_slots);
+							sync();
+							for (const Slot& s : old)
+								if (s.index != 0) own_slots[probe(s.page)] = s;
+						}
+						sync();
+						const RVIKey p = key.shifted(PageBits);
+						Slot& slot = own_slots[probe(p)];
+						if (slot.index == 0) {
+							own_pages.emplace_back();
+							slot = { p, own_pages.size() };
+							++n_slots_used;
+						}
+						index = slot.index;
+					}
+					sync();
+					Page& page = own_pages[index - 1];
+					if (!page.present[key.lo & (PageSize - 1)]) {
+						page.present.set(key.lo & (PageSize - 1));
+						++count;
+					}
+					return page.value[key.lo & (PageSize - 1)];
+				}
+
+				size_t size() const { return count; }
+				bool empty() const { return count == 0; }
+				void clear() { *this = RVIKeyTable(); }
+				static constexpr size_t page_bytes() { return sizeof(Page); }
+
+				const_iterator begin() const { return const_iterator(this, false); }
+				const_iterator end() const { return const_iterator(this, true); }
+
+				// Cache file layout of a table: four uint64 (count, index length, slot count,
+				// page count), the dense index padded to 8 bytes, the slots, then the pages.
+				// write appends it to out; view points this table at one inside a mapping that
+				// starts at base and returns the offset just past it (throws if it would pass size).
+				void write(std::ostream& out) const {
+					const uint64_t head[4] = { count, page_of.size(), slots.size(), pages.size() };
+					const uint64_t zero = 0;
+					out.write(reinterpret_cast<const char*>(head), sizeof(head));
+					out.write(reinterpret_cast<const char*>(page_of.data()), (std::streamsize)page_of.size_bytes());
+					out.write(reinterpret_cast<const char*>(&zero), (std::streamsize)((8 - page_of.size_bytes() % 8) % 8));
+					out.write(reinterpret_cast<const char*>(slots.data()), (std::streamsize)slots.size_bytes());
+					out.write(reinterpret_cast<const char*>(pages.data()), (std::streamsize)pages.size_bytes());
+				}
+				size_t view(std::shared_ptr<const void> file, const char* base, size_t offset, size_t size) {
+					uint64_t head[4];
+					if (offset + sizeof(head) > size)
+						throw DynaPlex::Error("queue_mdp::RVIKeyTable: truncated cache file");
+					std::memcpy(head, base + offset, sizeof(head));
+					offset += sizeof(head);
+					if (head[1] > size || head[2] > size || head[3] > size)
+						throw DynaPlex::Error("queue_mdp::RVIKeyTable: truncated cache file");
+					const size_t index_bytes = head[1] * sizeof(uint32_t), pad = (8 - index_bytes % 8) % 8;
+					if (offset + index_bytes + pad + head[2] * sizeof(Slot) + head[3] * sizeof(Page) > size)
+						throw DynaPlex::Error("queue_mdp::RVIKeyTable: truncated cache file");
+					if (head[2] & (head[2] - 1))
+						throw DynaPlex::Error("queue_mdp::RVIKeyTable: corrupt cache file");
+					*this = RVIKeyTable();
+					count = (size_t)head[0];
+					page_of = { reinterpret_cast<const uint32_t*>(base + offset), (size_t)head[1] };
+					offset += index_bytes + pad;
+					slots = { reinterpret_cast<const Slot*>(base + offset), (size_t)head[2] };
+					offset += head[2] * sizeof(Slot);
+					pages = { reinterpret_cast<const Page*>(base + offset), (size_t)head[3] };
+					mapping = std::move(file);
+					for (uint32_t p : page_of)
+						if (p > pages.size())
+							throw DynaPlex::Error("queue_mdp::RVIKeyTable: corrupt cache file");
+					for (const Slot& s : slots)
+						if (s.index > pages.size())
+							throw DynaPlex::Error("queue_mdp::RVIKeyTable: corrupt cache file");
+					return offset + head[3] * sizeof(Page);
+				}
+			};
 
 			struct RVISolution {
 				double g_star;  // optimal average cost per time unit
+				// Certified bounds g_lower <= g* <= g_upper for the truncated chain at M
+				// (see runRVI's rel_gap); they say nothing about the truncation error.
+				double g_lower = 0.0, g_upper = 0.0;
 				int M;          // truncation level used
-				std::unordered_map<uint64_t, int64_t> action_map;  // encoded state key -> optimal action
+				RVIKeyEncoder encoder;  // state -> key, with FILs clamped to M
+				RVIKeyTable<int64_t> action_map;  // encoded state key -> optimal action
 				// Action-value gap |Q(s,0) - Q(s,1)| for every AwaitAction state.
 				// Large gap = confident decision; near-zero gap = near-tie (potential noise).
-				std::unordered_map<uint64_t, double> gap_map;
+				RVIKeyTable<double> gap_map;
 				// Raw Q-values: q_map[key] = {Q(s,0), Q(s,1)}.
 				// Q(s,0) = expected h-cost if we skip the top candidate.
 				// Q(s,1) = expected h-cost if we assign the top candidate.
 				// Stored for every AwaitAction state where both actions are reachable.
-				std::unordered_map<uint64_t, std::pair<double,double>> q_map;
+				RVIKeyTable<std::pair<double,double>> q_map;
+				// Set by a lumped solve (lump_symmetric): the relative value of every AwaitEvent
+				// orbit, by canonical key.  EvaluateRVIPolicy decides an action state the solve
+				// did not reach by looking ahead to these values.
+				RVISymmetry symmetry;
+				RVIKeyTable<double> event_value;
 			};
+			// Solver settings of runRVI.  Only M, rel_tol, rel_gap and lump_symmetric select
+			// which problem is solved; the others change how (and how fast) it is solved.
+			struct RVIOptions {
+				// Truncation level of the FILs: solve at this M, or 0 to auto-select M (grow M
+				// by 2 until g* changes by less than rel_tol).
+				int M = 0;
+				double rel_tol = 1e-4;
+				// Sweeps per solve (policy iteration: improvement steps, typically tens).
+				int max_iter = 10000;
+				bool silent = false;
+				// Splits each Bellman sweep over state ranges (0 = hardware_concurrency); the
+				// solution is bit-identical for every thread count.
+				int64_t num_threads = 1;
+				// Updates h in place, sweeping states by decreasing FIL, with over-relaxation
+				// factor relaxation in (0, 2); single-threaded, needs fewer sweeps and one value
+				// array instead of two, and has the same fixed point.
+				bool gauss_seidel = false;
+				double relaxation = 1.0;
+				// Policy iteration instead of value iteration: each policy is evaluated by a
+				// preconditioned BiCGSTAB solve of its Poisson equation.  Single-threaded;
+				// ignores gauss_seidel, relaxation and mixed_precision.  An evaluation that
+				// needs more than max_krylov BiCGSTAB steps ends policy iteration: the solve
+				// continues with value iteration (with these settings) from the last h.
+				bool policy_iteration = false;
+				int max_krylov = 2000;
+				// Every solver reports lower and upper bounds on g* (RVISolution::g_lower/g_upper);
+				// rel_gap > 0 stops the solve as soon as (upper - lower) / lower < rel_gap.
+				double rel_gap = 0.0;
+				// Solve on one AwaitEvent state per orbit of interchangeable types and pools
+				// (see RVISymmetry); same g*, up to order times fewer states.
+				bool lump_symmetric = false;
+				// Non-empty: keep the transition table and the BFS frontier in temporary files
+				// there, mapped, instead of on the heap (out-of-core solve): RAM then holds the
+				// state index, the value vectors and the pages a pass touches.
+				std::string scratch_dir;
+				// Value iteration mostly in single precision: float sweeps solve for corrections
+				// to a double h (AVX2 gather kernel where the CPU has it), and a few double sweeps
+				// finish, so g* keeps double accuracy.
+				bool mixed_precision = false;
+			};
+			RVISolution runRVI(const RVIOptions& options) const;
 			RVISolution runRVI(int M, int max_iter = 10000, bool silent = false) const;  // solve at fixed M
 			RVISolution runRVI(double rel_tol = 1e-4, bool silent = false) const;       // auto-select M via heuristic + convergence check
 			int64_t EvaluateRVIPolicy(const RVISolution& sol, const State& state) const;
@@ -849,6 +1638,20 @@ namespace DynaPlex::Models {
 			// Returns {-1,-1} if the state is not in q_map (e.g. not AwaitAction).
 			std::pair<double,double> EvaluateRVIQValues(const RVISolution& sol, const State& state) const;
 
+			// RVI solution cache (rvi_cache.cpp).  A solution is stored as one binary file in
+			// dir named after int_hash, reward_type and the solve request: a fixed M, or M = 0
+			// and the rel_tol of the auto-M solve, and the options that shape the result
+			// (rel_gap, lump_symmetric, policy_iteration, gauss_seidel with its relaxation,
+			// mixed_precision).  The file is written to a temporary name and renamed, so
+			// readers never see a partial file.  LoadRVISolution maps it read-only and points
+			// the solution's tables into the mapping, so concurrent processes share one copy;
+			// it returns false if the file is missing or was written for another MDP, request
+			// or build layout.  SaveRVISolution returns false, with a warning, if the entry
+			// cannot be written.
+			std::string RVICacheFile(const std::string& dir, const RVIOptions& options) const;
+			bool LoadRVISolution(const std::string& path, const RVIOptions& options, RVISolution& sol) const;
+			bool SaveRVISolution(const std::string& path, const RVIOptions& options, const RVISolution& sol) const;
+
 			// ----------------------------------------------------------------
 			// Continuous-time event-driven simulator
 			// ----------------------------------------------------------------
@@ -857,7 +1660,15 @@ namespace DynaPlex::Models {
 			// The policy is queried at every assignment decision point by
 			// converting exact sojourn times tau_n to tick counts
 			// f_n = floor(tau_n * tick_rate) and constructing a canonical
-			// AwaitAction state.
+			// AwaitAction state.  Each server of a pool has its own service
+			// clock; pending clocks are kept in a DynaPlex::EventHeap.
+			//
+			// Trajectory i draws its events and the Policy overload's policy RNG
+			// from the streams of RNGProvider::SeedEventStreams(true, rng_seed, 0, i),
+			// so the result does not depend on num_threads (default 1; 0 = hardware
+			// concurrency).  With num_threads != 1 the std::function overload calls
+			// policy_fn concurrently, so it must be thread-safe; the Policy overload
+			// gives every thread its own query trajectory.
 			//
 			// Returns:
 			//   mean_cost_per_time  - time-averaged cost rate  (g*_time = g* x E[Lambda])
@@ -879,7 +1690,17 @@ namespace DynaPlex::Models {
 				std::function<int64_t(const State&)> policy_fn,
 				int    n_traj   = 100,
 				double t_max    = 500000.0,
-				double t_warmup =  50000.0) const;
+				double t_warmup =  50000.0,
+				int64_t rng_seed    = 42,
+				int64_t num_threads = 1) const;
+
+			ContinuousSimResult SimulateContinuous(
+				const DynaPlex::Policy& policy,
+				int    n_traj   = 100,
+				double t_max    = 500000.0,
+				double t_warmup =  50000.0,
+				int64_t rng_seed    = 42,
+				int64_t num_threads = 1) const;
 
 			// ----------------------------------------------------------------
 			// TraceContinuous
@@ -986,6 +1807,158 @@ namespace DynaPlex::Models {
 			int64_t rng_seed       = 42,
 			int64_t num_threads    = 0);
 
+		/**
+		 * Structure-of-arrays batched simulator: B trajectories of one MDP advanced in lockstep,
+		 * one uniformized step (action or event) per lane per round, exactly as EvaluatePolicyRaw
+		 * steps a single trajectory.  Queue ages are stored as [type][depth][B], busy counts as
+		 * [pool slot][B] and rates, categories and cost accumulators as [B], so the event round
+		 * (draw, classify, tick) runs as loops over the batch; arrivals, completions and FIL
+		 * refreshes are applied to the lanes that drew them.  Candidate queues stay per lane.
+		 *
+		 * Lane b of Reset(rng_seed, first, count) uses the event stream of trajectory first + b in
+		 * EvaluatePolicyRaw, so for the same policy both produce the same trajectories.
+		 * Candidate-queue action mode only; skip_idle_steps is ignored (every lane steps).
+		 */
+		class BatchSimulator {
+		public:
+			/// Per-lane totals since the last Reset, over the recorded rounds (see Step).
+			struct LaneTotals {
+				double  cost = 0.0;          // event costs, as summed by EvaluatePolicyRaw
+				double  cost_rvi = 0.0;      // RVI-style per-step binary cost
+				double  cost_gic = 0.0;      // GetImmediateCost at non-refresh event steps
+				int64_t action_steps = 0;
+				int64_t real_event_steps = 0;
+				int64_t fil_refresh_steps = 0;
+			};
+
+			BatchSimulator(const MDP& mdp, int64_t capacity);
+
+			/// Restarts lanes [0, count) in the initial state, lane b on trajectory first_trajectory + b.
+			void Reset(int64_t rng_seed, int64_t first_trajectory, int64_t count);
+
+			int64_t Size() const { return lanes; }
+			int64_t NumFeatures() const { return num_features; }
+			int64_t NumActions() const { return num_actions; }
+
+			/// Lanes awaiting an action in the current round, ascending.
+			const std::vector<int64_t>& DecisionLanes() const { return decision_lanes; }
+
+			/// Row i describes DecisionLanes()[i]: features is [rows][NumFeatures()] with the values of
+			/// MDP::GetFeatures, allowed is [rows][NumActions()] with MDP::IsAllowedAction.
+			void GetDecisionInputs(std::span<float> features, std::span<uint8_t> allowed) const;
+
+			/// The lane's state as a concrete MDP::State (what EvaluatePolicyRaw would hold).
+			void GetState(int64_t lane, MDP::State& state) const;
+
+			/// Advances every lane by one step: actions[i] is applied to DecisionLanes()[i], every other
+			/// lane incorporates an event.  Costs and step counts are accumulated only if record is set.
+			void Step(std::span<const int64_t> actions, bool record);
+
+			LaneTotals Totals(int64_t lane) const;
+
+		private:
+			enum class EventKind : uint8_t { None, Arrival, Tick, Completion, Nothing, FilRefresh };
+
+			const MDP& mdp;
+			int64_t capacity;
+			int64_t lanes = 0;
+			int64_t n_types, depth, n_pools, n_slots;
+			// busy slot s = pool_first_slot[k] + j for can_serve entry j of pool k
+			std::vector<int64_t> pool_first_slot;
+			int64_t num_features, num_actions;
+			MDP::State initial_state;
+			mutable MDP::State query_state;
+
+			// Lane data, element [row * capacity + lane].
+			std::vector<int64_t> age;             // row n * depth + d: tracked age d of type n
+			std::vector<int64_t> queue_len;       // row n
+			std::vector<int64_t> busy;            // row s
+			std::vector<int64_t> pool_busy;       // row k
+			std::vector<double>  arrival_rate;    // queue_manager.total_arrival_rate
+			std::vector<double>  service_rate;    // server_manager.completion_tree.total()
+			std::vector<double>  tick_cost;       // ComputeTickCost of the current ages
+			std::vector<double>  binary_cost;     // ComputeTickCost(.., 0) of the current ages
+			std::vector<int64_t> next_fil;
+			std::vector<uint8_t> awaits_action;
+			std::vector<MDP::EventCategory> last_event;
+			std::vector<uint64_t> stochastic_key;
+			std::vector<DynaPlex::RateTree<MDP::MaxJobTypes>> arrival_tree;                 // as QueueManager
+			std::vector<DynaPlex::RateTree<MDP::MaxPools * MDP::MaxJobTypes>> completion_tree;  // as ServerDynamicState
+			std::vector<MDP::ActionQueue> candidates;
+			std::vector<int64_t> action_counter;
+			std::vector<DynaPlex::RNG> rng;
+			// LaneTotals, one array per field.
+			std::vector<double>  acc_cost, acc_cost_rvi, acc_cost_gic;
+			std::vector<int64_t> acc_action_steps, acc_real_event_steps, acc_fil_refresh_steps;
+
+			// Per-round scratch.
+			std::vector<int64_t> decision_lanes, event_lanes;
+			std::vector<double> event_sample, fil_draw;
+			std::vector<int64_t> tick_step;
+			std::array<size_t, 6> kind_count{};   // lanes per EventKind this round
+			std::vector<int64_t> kind_lanes;      // [kind][capacity], first kind_count[kind] valid
+
+			size_t Row(int64_t row, int64_t b) const { return (size_t)(row * capacity + b); }
+			int64_t& Age(int64_t n, int64_t d, int64_t b) { return age[Row(n * depth + d, b)]; }
+			int64_t Age(int64_t n, int64_t d, int64_t b) const { return age[Row(n * depth + d, b)]; }
+			MDP::FILVector LaneFIL(int64_t b) const;
+			void RefreshCosts(int64_t b);
+			std::array<int64_t, MDP::MaxPools> LanePoolBusy(int64_t b) const;
+			void SetCompletionLeaf(int64_t b, int64_t k, int64_t j);
+			void UpdateCandidatesForType(int64_t b, int64_t n);
+			void UpdateCandidatesForPool(int64_t b, int64_t k);
+			void RebuildLaneLists();
+			void ApplyAction(int64_t b, int64_t action);
+			double ApplyArrival(int64_t b);
+			double ApplyCompletion(int64_t b);
+			double ApplyFilRefresh(int64_t b);
+		};
+
+		/// One decision round of EvaluatePolicyBatched: row i of features / allowed belongs to the
+		/// i-th lane awaiting an action; the policy writes actions[i] for every row.
+		struct BatchDecision {
+			std::span<const float>   features;      // [rows][num_features]
+			std::span<const uint8_t> allowed;       // [rows][num_actions]
+			int64_t                  num_features;
+			int64_t                  num_actions;
+			std::span<int64_t>       actions;       // [rows]
+		};
+		using BatchPolicy = std::function<void(const BatchDecision&)>;
+
+		/// EvaluatePolicyRaw on a BatchSimulator: trajectories are run batch_size at a time in
+		/// lockstep and the policy is queried once per round with the feature matrix of all lanes
+		/// awaiting an action.  Same trajectories (seeding) and the same RawEvalResult breakdown as
+		/// EvaluatePolicyRaw with skip_idle_steps off.
+		RawEvalResult EvaluatePolicyBatched(
+			const MDP&         mdp,
+			const BatchPolicy& policy,
+			int64_t n_trajectories = 200,
+			int64_t steps_per_traj = 100000,
+			int64_t warmup_steps   = 10000,
+			int64_t rng_seed       = 42,
+			int64_t batch_size     = 1024);
+
+		/// Per-state policy: queried lane by lane with the concrete state (no feature matrix).
+		RawEvalResult EvaluatePolicyBatched(
+			const MDP&                                  mdp,
+			std::function<int64_t(const MDP::State&)>   get_action,
+			int64_t n_trajectories = 200,
+			int64_t steps_per_traj = 100000,
+			int64_t warmup_steps   = 10000,
+			int64_t rng_seed       = 42,
+			int64_t batch_size     = 1024);
+
+		/// DynaPlex::Policy: all lanes awaiting an action are passed to one SetAction call, so
+		/// neural-network policies evaluate the whole round as one batch.
+		RawEvalResult EvaluatePolicyBatched(
+			const MDP&              mdp,
+			const DynaPlex::Policy& policy,
+			int64_t n_trajectories = 200,
+			int64_t steps_per_traj = 100000,
+			int64_t warmup_steps   = 10000,
+			int64_t rng_seed       = 42,
+			int64_t batch_size     = 1024);
+
 		/**
 		 * Prints a console heatmap of a policy's job-type assignment decisions.
 		 * X-axis: FIL_waiting[0], Y-axis: FIL_waiting[1].
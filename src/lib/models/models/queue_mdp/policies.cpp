@@ -33,6 +33,11 @@ namespace DynaPlex::Models {
 				}
 				return best;
 			}
+			if (mdp->joint_mode) {
+				// FIFO as one joint assignment: serve candidates in FIL order while
+				// capacity lasts.
+				return mdp->GreedyJointAction(state, [](const MDP::Action&) { return true; });
+			}
 			//Implement custom policy, and remove below line.
 			//throw DynaPlex::NotImplementedError();
 			return 1; // always assign job
@@ -43,8 +48,8 @@ namespace DynaPlex::Models {
 		FIFOPolicySorted::FIFOPolicySorted(std::shared_ptr<const MDP> mdp, const VarGroup& config)
 			:mdp{ mdp }
 		{
-			if (mdp->per_event_mode)
-				throw DynaPlex::Error("queue_mdp: FIFOPolicySorted is not ported to action_mode=per_event yet");
+			if (mdp->per_event_mode || mdp->joint_mode)
+				throw DynaPlex::Error("queue_mdp: FIFOPolicySorted is not ported to action_mode=per_event/joint yet");
 		}
 
 		int64_t FIFOPolicySorted::GetAction(const MDP::State& state) const
@@ -58,9 +63,10 @@ namespace DynaPlex::Models {
 		// Supports an optional "feature_queue_depth" config key (default = mdp->max_queue_depth).
 		// When feature_queue_depth=1 is requested on a depth>1 MDP, a temporary depth=1 MDP is
 		// constructed from the same parameters and RVI is solved on that instead.  The resulting
-		// action_map uses the FIL-only encoder, which is also what EvaluateRVIPolicy reads via
-		// get_FIL_waiting() -- so the look-up is depth-agnostic and the policy is valid for the
-		// original (depth=2) MDP despite the internal depth-1 solve.
+		// encoder keys on one position per type, the FIL, so EvaluateRVIPolicy looks a deeper
+		// state up by its FILs and the policy is valid for the original (depth=2) MDP despite
+		// the internal depth-1 solve.  Without it, RVI solves the depth>1 MDP itself, with
+		// every tracked position in the state key.
 		RVI_optimal::RVI_optimal(std::shared_ptr<const MDP> mdp, const VarGroup& config)
 			: mdp{ mdp }, varGroup{ config }
 		{
@@ -118,16 +124,77 @@ namespace DynaPlex::Models {
 				          << "  solving on depth=" << solve_on->max_queue_depth << "\n";
 			}
 
+			MDP::RVIOptions options;
+			options.silent = silent;
+			// Threads for the Bellman sweep (0 = all hardware threads); does not change the result.
+			if (config.HasKey("num_threads"))
+				config.Get("num_threads", options.num_threads);
+			// In-place (Gauss-Seidel) sweeps with optional over-relaxation; same g* and action map.
+			if (config.HasKey("gauss_seidel")) {
+				int64_t gs;
+				config.Get("gauss_seidel", gs);
+				options.gauss_seidel = (gs != 0);
+			}
+			if (config.HasKey("relaxation"))
+				config.Get("relaxation", options.relaxation);
+			// Policy iteration with Krylov policy evaluation instead of value iteration.
+			if (config.HasKey("policy_iteration")) {
+				int64_t pi;
+				config.Get("policy_iteration", pi);
+				options.policy_iteration = (pi != 0);
+			}
+
+			// Stop each solve once the bounds on g* are within this relative gap (0 = off).
+			if (config.HasKey("rel_gap"))
+				config.Get("rel_gap", options.rel_gap);
+
+			// Solve on one state per orbit of interchangeable job types and pools.
+			if (config.HasKey("lump_symmetric")) {
+				int64_t lump;
+				config.Get("lump_symmetric", lump);
+				options.lump_symmetric = (lump != 0);
+			}
+
+			// Out-of-core solve: transition table in scratch files in this directory
+			// (local disk).  Does not change the result, so it is not part of the cache key.
+			if (config.HasKey("scratch_dir"))
+				config.Get("scratch_dir", options.scratch_dir);
+
+			// Value iteration mostly in single precision, finished in double.  Converges to
+			// the same tolerances; like gauss_seidel it is part of the cache key, as the
+			// solutions agree only to those tolerances.
+			if (config.HasKey("mixed_precision")) {
+				int64_t mixed;
+				config.Get("mixed_precision", mixed);
+				options.mixed_precision = (mixed != 0);
+			}
+
+			// 0 = auto-select M
 			if (config.HasKey("M")) {
 				int64_t M;
 				config.Get("M", M);
-				sol = solve_on->runRVI((int)M, 10000, silent);
+				options.M = (int)M;
+			}
+			if (config.HasKey("rel_tol"))
+				config.Get("rel_tol", options.rel_tol);
+
+			// Optional solution cache, e.g. cache_dir = dp.System().filepath("rvi_cache", "").
+			// An entry for the same MDP and request is mapped instead of solving again.
+			std::string cache_file;
+			if (config.HasKey("cache_dir")) {
+				std::string cache_dir;
+				config.Get("cache_dir", cache_dir);
+				cache_file = solve_on->RVICacheFile(cache_dir, options);
+			}
+			if (!cache_file.empty() && solve_on->LoadRVISolution(cache_file, options, sol)) {
+				if (!silent)
+					std::cout << "[RVI_optimal] loaded " << cache_file << "  g*=" << sol.g_star
+					          << " in [" << sol.g_lower << ", " << sol.g_upper << "]  M=" << sol.M << "\n";
 			}
 			else {
-				double rel_tol = 1e-4;
-				if (config.HasKey("rel_tol"))
-					config.Get("rel_tol", rel_tol);
-				sol = solve_on->runRVI(rel_tol, silent);
+				sol = solve_on->runRVI(options);
+				if (!cache_file.empty())
+					solve_on->SaveRVISolution(cache_file, options, sol);
 			}
 
 			// Debug: count action=0 vs action=1 in the map
@@ -148,8 +215,8 @@ namespace DynaPlex::Models {
 			std::shared_ptr<const MDP> mdp, const VarGroup& cfg)
 			: mdp{ mdp }, threshold{ 0.0 }
 		{
-			if (mdp->per_event_mode)
-				throw DynaPlex::Error("queue_mdp: StochasticFIFOPolicy is not ported to action_mode=per_event yet");
+			if (mdp->per_event_mode || mdp->joint_mode)
+				throw DynaPlex::Error("queue_mdp: StochasticFIFOPolicy is not ported to action_mode=per_event/joint yet");
 			if (cfg.HasKey("threshold"))
 				cfg.Get("threshold", threshold);
 		}
@@ -158,10 +225,10 @@ namespace DynaPlex::Models {
 		{
 			int64_t acnt = state.server_manager.get_action_counter();
 			// If the draw for this candidate slot is below the threshold, skip it.
-			// Fall back to action=1 if draws vector is not yet populated (safe default).
+			// Fall back to action=1 if no event has keyed the draws yet (safe default).
 			if (acnt >= 0
-				&& acnt < (int64_t)state.stochastic_draws.size()
-				&& state.stochastic_draws[(size_t)acnt] < threshold)
+				&& state.stochastic_key != 0
+				&& state.StochasticDraw(acnt) < threshold)
 				return 0;  // probabilistic skip
 			return 1;      // assign (FIFO default)
 		}
@@ -193,6 +260,10 @@ namespace DynaPlex::Models {
 				}
 				return best_action;
 			}
+			if (mdp->joint_mode) {
+				// every cmu winner whose type is still unserved
+				return mdp->GreedyJointAction(state, [](const MDP::Action& a) { return a.is_cmu_winner != 0; });
+			}
 			const auto& queue = state.server_manager.action_queue;
 			const int64_t cnt = state.server_manager.get_action_counter();
 			if (cnt < 0 || cnt >= (int64_t)queue.size())
@@ -208,8 +279,8 @@ namespace DynaPlex::Models {
 			std::shared_ptr<const MDP> mdp, const VarGroup& /*config*/)
 			: mdp{ mdp }
 		{
-			if (mdp->per_event_mode)
-				throw DynaPlex::Error("queue_mdp: ReverseFIFOPolicy is not ported to action_mode=per_event yet");
+			if (mdp->per_event_mode || mdp->joint_mode)
+				throw DynaPlex::Error("queue_mdp: ReverseFIFOPolicy is not ported to action_mode=per_event/joint yet");
 		}
 
 		int64_t ReverseFIFOPolicy::GetAction(const MDP::State& state) const
@@ -226,8 +297,8 @@ namespace DynaPlex::Models {
 			std::shared_ptr<const MDP> mdp, const VarGroup& /*config*/)
 			: mdp{ mdp }
 		{
-			if (mdp->per_event_mode)
-				throw DynaPlex::Error("queue_mdp: EnforcedFIFOPolicy is not ported to action_mode=per_event yet");
+			if (mdp->per_event_mode || mdp->joint_mode)
+				throw DynaPlex::Error("queue_mdp: EnforcedFIFOPolicy is not ported to action_mode=per_event/joint yet");
 		}
 
 		int64_t EnforcedFIFOPolicy::GetAction(const MDP::State& state) const
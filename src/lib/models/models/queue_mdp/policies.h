@@ -39,7 +39,7 @@ namespace DynaPlex::Models {
 		};
 
 		/// FIFO with probabilistic skipping.
-		/// At each AwaitAction step, if stochastic_draws[action_counter] < threshold
+		/// At each AwaitAction step, if state.StochasticDraw(action_counter) < threshold
 		/// the policy skips the current candidate (action=0); otherwise it assigns (action=1).
 		/// threshold=0.0 (default) is identical to plain FIFO.
 		/// Useful as a DCL base policy to inject action=0 training examples.
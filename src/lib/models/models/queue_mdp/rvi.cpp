@@ -1,6 +1,5 @@
 #include "mdp.h"
-#include <queue>
-#include <unordered_map>
+#include "rvi_scratch.h"
 #include <array>
 #include <vector>
 #include <limits>
@@ -8,87 +7,353 @@
 #include <algorithm>
 #include <iostream>
 #include <iomanip>
+#include <barrier>
+#include <functional>
+#include <thread>
+#include <type_traits>
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#include <immintrin.h>
+#define QUEUE_MDP_AVX2_KERNEL
+#endif
 
 namespace DynaPlex::Models {
 namespace queue_mdp {
 
-namespace {
+MDP::RVIKeyEncoder::RVIKeyEncoder(const MDP& mdp, int M) : M(M), depth((int)mdp.max_queue_depth) {
+	for (const auto& info : mdp.server_static_info)
+		busy_radix.insert(busy_radix.end(), info.can_serve.size(), (uint64_t)info.servers + 1);
 
-struct Transition {
-	size_t next_state_idx;
-	double probability;
-};
+	// Bits of the key space.  The action_counter, the top digit, stays below
+	// MaxCandidates + 1; the margin keeps rounding in log2 on the safe side.
+	double bits = (double)(mdp.n_jobs * depth) * std::log2((double)M + 2.0) + 1.0 + std::log2((double)MaxCandidates + 1.0);
+	for (uint64_t radix : busy_radix)
+		bits += std::log2((double)radix);
+	if (bits > 128.0 - 1e-6)
+		throw DynaPlex::Error("queue_mdp::RVIKeyEncoder: state keys need " + std::to_string((int)std::ceil(bits))
+			+ " bits at M=" + std::to_string(M) + ", more than 128; lower M, max_queue_depth or the number of types and pools");
+	wide = bits > 64.0 - 1e-6;
+}
 
-struct StateEncoder {
-	int M;
-	std::vector<std::vector<int>> busy_dims;  // busy_dims[k][j] = servers[k] + 1
+MDP::RVIKey MDP::RVIKeyEncoder::encode_wide(const State& state) const {
+	// encode's digits, pushed from the top down.
+	std::array<uint64_t, MaxDigits> digit;
+	size_t n = 0;
+	for (const auto& q : state.queue_manager.waiting)
+		for (size_t p = 0; p < (size_t)depth; ++p)
+			digit[n++] = (uint64_t)((p < q.size() ? std::min(q[p], (int64_t)M) : -1) + 1);
+	const size_t n_queue = n;
+	for (const auto& row : state.server_manager.busy_on)
+		for (int64_t b : row) digit[n++] = (uint64_t)b;
+	RVIKey key((uint64_t)state.server_manager.get_action_counter());
+	key.push_digit(2, state.cat == DynaPlex::StateCategory::AwaitAction() ? 1 : 0);
+	for (size_t d = n; d-- > 0;)
+		key.push_digit(d < n_queue ? (uint64_t)M + 2 : busy_radix[d - n_queue], digit[d]);
+	return key;
+}
 
-	StateEncoder(const MDP& mdp, int M) : M(M) {
-		for (size_t k = 0; k < mdp.server_static_info.size(); ++k) {
-			busy_dims.push_back({});
-			for (size_t j = 0; j < mdp.server_static_info[k].can_serve.size(); ++j)
-				busy_dims[k].push_back((int)mdp.server_static_info[k].servers + 1);
+MDP::RVISymmetry::RVISymmetry(const MDP& mdp) : n_types((size_t)mdp.n_jobs), depth((size_t)mdp.max_queue_depth) {
+	const auto& pools = mdp.server_static_info;
+	row_begin.push_back(n_types * depth);
+	for (const auto& info : pools)
+		row_begin.push_back(row_begin.back() + info.can_serve.size());
+
+	// Types.  A pool that lists a type twice has no single busy digit for it, and
+	// force_late_service breaks ties between late FILs towards the lower type.
+	bool lump_types = !mdp.force_late_service;
+	for (const auto& info : pools)
+		lump_types = lump_types && std::popcount(info.serve_mask) == (int)info.can_serve.size();
+	auto same_type = [&](size_t a, size_t b) {
+		if (mdp.arrival_rates[a] != mdp.arrival_rates[b] || mdp.cost_rates[a] != mdp.cost_rates[b]
+		    || mdp.due_times[a] != mdp.due_times[b])
+			return false;
+		for (const auto& info : pools) {
+			const int ja = info.slot_of_type[a], jb = info.slot_of_type[b];
+			if ((ja < 0) != (jb < 0) || (ja >= 0 && info.mu_kj[(size_t)ja] != info.mu_kj[(size_t)jb]))
+				return false;
 		}
+		return true;
+	};
+	std::vector<std::vector<size_t>> type_classes;
+	std::vector<bool> placed(n_types, false);
+	for (size_t a = 0; a < n_types; ++a) {
+		if (placed[a]) continue;
+		type_classes.push_back({ a });
+		for (size_t b = a + 1; lump_types && b < n_types; ++b)
+			if (!placed[b] && same_type(a, b)) {
+				type_classes.back().push_back(b);
+				placed[b] = true;
+			}
+	}
+	// Every state is canonicalised over all type permutations, so their number is
+	// capped: the largest class gives up members until it fits.
+	const size_t MaxTypePermutations = 720;
+	auto permutations = [&] {
+		size_t n = 1;
+		for (const auto& c : type_classes)
+			for (size_t i = 2; i <= c.size(); ++i) n *= i;
+		return n;
+	};
+	while (permutations() > MaxTypePermutations) {
+		auto largest = std::max_element(type_classes.begin(), type_classes.end(),
+			[](const auto& x, const auto& y) { return x.size() < y.size(); });
+		type_classes.push_back({ largest->back() });
+		largest->pop_back();
 	}
 
-	uint64_t encode(const MDP::State& state) const {
-		uint64_t key = 0, stride = 1;
+	// One digit map per type permutation: the waiting-time digits of type n move to
+	// those of perm[n], and the busy digit of (k, n) to the slot of perm[n] in pool k.
+	std::vector<std::vector<size_t>> images = type_classes;
+	std::vector<size_t> perm(n_types);
+	while (true) {
+		for (size_t c = 0; c < type_classes.size(); ++c)
+			for (size_t i = 0; i < type_classes[c].size(); ++i)
+				perm[type_classes[c][i]] = images[c][i];
+		std::vector<uint16_t> to(row_begin.back());
+		for (size_t n = 0; n < n_types; ++n)
+			for (size_t p = 0; p < depth; ++p)
+				to[n * depth + p] = (uint16_t)(perm[n] * depth + p);
+		for (size_t k = 0; k < pools.size(); ++k)
+			for (size_t j = 0; j < pools[k].can_serve.size(); ++j)
+				to[row_begin[k] + j] = (uint16_t)(row_begin[k] + (size_t)pools[k].slot_of_type[perm[(size_t)pools[k].can_serve[j]]]);
+		digit_of.push_back(std::move(to));
+		size_t c = 0;   // next permutation, odometer-wise over the classes
+		while (c < images.size() && !std::next_permutation(images[c].begin(), images[c].end())) ++c;
+		if (c == images.size()) break;
+	}
+	order = digit_of.size();
 
-		// FIL: clamp to M, shift by 1 so -1 -> 0  (RVI is FIL-projected)
-		for (int64_t fil : state.queue_manager.get_FIL_waiting()) {
-			int64_t v = std::min(fil, (int64_t)M) + 1;
-			key += (uint64_t)v * stride;
-			stride *= (uint64_t)(M + 2);
+	// Pools.
+	placed.assign(pools.size(), false);
+	for (size_t a = 0; a < pools.size(); ++a) {
+		if (placed[a]) continue;
+		std::vector<size_t> same{ a };
+		for (size_t b = a + 1; b < pools.size(); ++b)
+			if (!placed[b] && pools[b].servers == pools[a].servers && pools[b].can_serve == pools[a].can_serve
+			    && pools[b].mu_kj == pools[a].mu_kj) {
+				same.push_back(b);
+				placed[b] = true;
+			}
+		for (size_t i = 2; i <= same.size(); ++i) order *= i;
+		if (same.size() > 1)
+			pool_classes.push_back(std::move(same));
+	}
+}
+
+MDP::RVIKey MDP::RVISymmetry::canonical(const RVIKeyEncoder& encoder, RVIKey key) const {
+	if (trivial()) return key;
+	std::array<uint64_t, RVIKeyEncoder::MaxDigits> digit, image;
+	const size_t n_digits = row_begin.back(), n_queue = row_begin[0];
+	for (size_t d = 0; d < n_digits; ++d)
+		digit[d] = key.pop_digit(d < n_queue ? (uint64_t)encoder.M + 2 : encoder.busy_radix[d - n_queue]);
+	// key now holds the category and action_counter digits, which no permutation moves.
+	RVIKey best(~uint64_t{ 0 }, ~uint64_t{ 0 });
+	for (const auto& to : digit_of) {
+		for (size_t d = 0; d < n_digits; ++d)
+			image[to[d]] = digit[d];
+		for (const auto& same : pool_classes) {   // insertion sort of the pools' busy rows
+			const size_t width = row_begin[same[0] + 1] - row_begin[same[0]];
+			for (size_t i = 1; i < same.size(); ++i)
+				for (size_t m = i; m > 0; --m) {
+					uint64_t* lo = image.data() + row_begin[same[m - 1]];
+					uint64_t* hi = image.data() + row_begin[same[m]];
+					if (!std::lexicographical_compare(hi, hi + width, lo, lo + width)) break;
+					std::swap_ranges(lo, lo + width, hi);
+				}
 		}
+		RVIKey out = key;
+		for (size_t d = n_digits; d-- > 0;)
+			out.push_digit(d < n_queue ? (uint64_t)encoder.M + 2 : encoder.busy_radix[d - n_queue], image[d]);
+		best = std::min(best, out);
+	}
+	return best;
+}
 
-		// busy_on
-		for (size_t k = 0; k < busy_dims.size(); ++k)
-			for (size_t j = 0; j < busy_dims[k].size(); ++j) {
-				key += (uint64_t)state.server_manager.busy_on[k][j] * stride;
-				stride *= (uint64_t)busy_dims[k][j];
-			}
+namespace {
 
-		// state category
-		key += (uint64_t)(state.cat == DynaPlex::StateCategory::AwaitAction() ? 1 : 0) * stride;
-		stride *= 2;
+// The solution's key encoder (see MDP::RVIKeyEncoder) plus the digit arithmetic
+// the solver needs on keys.
+struct StateEncoder : MDP::RVIKeyEncoder {
+	size_t n_queue;   // waiting-time digits: depth per type
 
-		// action_counter
-		key += (uint64_t)state.server_manager.get_action_counter() * stride;
+	StateEncoder(const MDP& mdp, int M) : MDP::RVIKeyEncoder(mdp, M), n_queue((size_t)(mdp.n_jobs * depth)) {}
 
+	// Sum of the encoded (clamped, shifted) waiting times: the leading digits of key.
+	int wait_sum(MDP::RVIKey key) const {
+		int sum = 0;
+		for (size_t d = 0; d < n_queue; ++d)
+			sum += (int)key.pop_digit((uint64_t)M + 2);
+		return sum;
+	}
+
+	// Re-encodes a key made by the encoder of truncation key_M for this one, with
+	// every waiting time clamped to cap: encode(s) from the key of s, clamped to min(M, cap).
+	MDP::RVIKey project(MDP::RVIKey key, int key_M, int cap) const {
+		std::array<uint64_t, MDP::MaxJobTypes * MDP::MaxQueueDepth> age;
+		for (size_t d = 0; d < n_queue; ++d)
+			age[d] = std::min<uint64_t>(key.pop_digit((uint64_t)key_M + 2), (uint64_t)std::min(cap, M) + 1);
+		for (size_t d = n_queue; d-- > 0;)
+			key.push_digit((uint64_t)M + 2, age[d]);
 		return key;
 	}
 };
 
-} // anonymous namespace
+// Fixed team of threads for the Bellman sweep.  run(job) calls job(t) for every
+// member t = 0..size()-1 (the calling thread is member 0) and returns when all
+// have finished.  The threads live for the whole solve: one RVI iteration is far
+// too short to start fresh threads for it, as parallel_compute would.
+class SweepTeam {
+public:
+	explicit SweepTeam(size_t n_threads)
+		: n_threads(n_threads), start(n_threads), done(n_threads) {
+		for (size_t t = 1; t < n_threads; ++t)
+			workers.emplace_back([this, t] {
+				while (true) {
+					start.arrive_and_wait();
+					if (stopping) return;
+					(*job)(t);
+					done.arrive_and_wait();
+				}
+			});
+	}
+	~SweepTeam() {
+		if (n_threads > 1) {
+			stopping = true;
+			start.arrive_and_wait();
+		}
+	}
+	size_t size() const { return n_threads; }
 
-// ---- runRVI(int M, int max_iter): BFS + RVI at a fixed truncation level ----
-MDP::RVISolution MDP::runRVI(int M, int max_iter, bool silent) const {
-	if (max_queue_depth > 1 && !silent)
-		std::cout << "[RVI] WARNING: max_queue_depth=" << max_queue_depth
-		          << " > 1.  RVI operates on FIL projection only.\n"
-		          << "              SIL/TIL state is ignored.  Use RL for multi-position problems.\n";
+	// job must not throw: a worker has nowhere to report it.
+	void run(const std::function<void(size_t)>& f) {
+		if (n_threads == 1) { f(0); return; }
+		job = &f;
+		start.arrive_and_wait();
+		f(0);
+		done.arrive_and_wait();
+	}
+
+private:
+	size_t n_threads;
+	const std::function<void(size_t)>* job = nullptr;
+	bool stopping = false;
+	std::barrier<> start, done;
+	std::vector<std::jthread> workers;   // declared last: joined before the barriers go
+};
+
+// A State kept for expansion at a larger M, with its index in the table.
+struct BoundaryState {
+	uint32_t index;
+	MDP::State state;
+};
 
-	StateEncoder encoder(*this, M);
+// Truncated transition table, in compressed sparse-row form:
+//   rows of state i         : [first_row[i], first_row[i+1]), one per action
+//                             with a non-empty distribution, ascending row_action
+//   transitions of row r    : [row_begin[r], row_begin[r+1]) of next_state / probability
+// State indices are BFS order until a Gauss-Seidel or policy-iteration solve
+// renumbers them into sweep order; ref is the initial (empty) state.  The arrays
+// are on the heap or, with a scratch_dir, in scratch files there (rvi_scratch.h).
+// A state key takes one word, two (state_key_hi) once the table holds a wide key.
+struct TransitionTable {
+	explicit TransitionTable(std::string scratch_dir = {}) : scratch_dir(std::move(scratch_dir)) {
+		first_row.push_back(0);
+		row_begin.push_back(0);
+	}
+	std::string scratch_dir;   // declared first: the arrays below are created in it
+	int M = -1;
+	TableArray<uint64_t> state_key{ scratch_dir };
+	TableArray<uint64_t> state_key_hi{ scratch_dir };   // empty while every key is narrow
+	TableArray<uint8_t>  awaits_action{ scratch_dir };
+	TableArray<double>   immediate_cost{ scratch_dir };
+	TableArray<size_t>   first_row{ scratch_dir };
+	TableArray<int32_t>  row_action{ scratch_dir };
+	TableArray<size_t>   row_begin{ scratch_dir };
+	TableArray<uint32_t> next_state{ scratch_dir };
+	TableArray<double>   probability{ scratch_dir };
+	size_t ref = 0;
+
+	// With keep_boundary, the States with a FIL at the cap M (ascending index),
+	// whose rows are the only ones that change when M grows.
+	bool keep_boundary = false;
+	TableArray<BoundaryState> boundary{ scratch_dir };
+
+	// Non-trivial for a lumped solve: AwaitEvent states are keyed by their orbit, and
+	// the State expanded for an orbit is the first of it the BFS met.
+	MDP::RVISymmetry symmetry;
+
+	MDP::RVIKey key(size_t i) const { return { state_key[i], state_key_hi.empty() ? 0 : state_key_hi[i] }; }
+	void set_key(size_t i, const MDP::RVIKey& key) {
+		if (!key.narrow() && state_key_hi.empty()) state_key_hi.resize(state_key.size(), 0);
+		state_key[i] = key.lo;
+		if (!state_key_hi.empty()) state_key_hi[i] = key.hi;
+	}
+	void push_key(const MDP::RVIKey& key) {
+		state_key.push_back(0);
+		if (!state_key_hi.empty()) state_key_hi.push_back(0);
+		set_key(state_key.size() - 1, key);
+	}
+};
+
+// Enumerates the table at truncation M, or grows an existing table (table.M < M)
+// to M.  Growing keeps every state and the rows of every state with all FILs below
+// the old cap: their successors are never clamped, so those rows do not depend on
+// M.  Only the boundary states are expanded again, followed by a BFS over the
+// states that are new.  If h holds a value per old state, it is extended to the
+// new states with the value of their counterpart under the old clamp_fil.
+void ExpandTable(const MDP& mdp, TransitionTable& table, int M, std::vector<double>& h, bool silent) {
+	if (M <= table.M)
+		throw DynaPlex::Error("queue_mdp::runRVI: the transition table can only grow, M=" + std::to_string(M)
+			+ " after M=" + std::to_string(table.M));
+	const StateEncoder encoder(mdp, M);
+	const int old_M = table.M;
+	const size_t n_old = table.state_key.size();
 
 	// Action-set size per decision state: 2 in candidate-queue mode
-	// (skip/serve), n_jobs+1 in per-event mode (idle / serve type a-1).
-	const int A_max = per_event_mode ? (int)n_jobs + 1 : 2;
+	// (skip/serve), n_jobs+1 in per-event mode (idle / serve type a-1),
+	// joint_action_count in joint mode (one code per assignment).
+	const int A_max = mdp.per_event_mode ? (int)mdp.n_jobs + 1
+	                : mdp.joint_mode ? (int)mdp.joint_action_count : 2;
 
-	std::unordered_map<uint64_t, size_t> state_index;
-	std::vector<MDP::State> states;
-	std::vector<std::vector<std::vector<Transition>>> transitions;
-	std::vector<double> immediate_cost;
-	std::queue<size_t> bfs_queue;
+	// States are expanded in index order, so their rows are appended in order.  A
+	// State only lives from discovery until its expansion (frontier); afterwards
+	// the solve needs just its key, category and immediate cost.
+	MDP::RVIKeyTable<uint32_t> state_index;
+	for (size_t i = 0; i < n_old; ++i) {
+		table.set_key(i, encoder.project(table.key(i), old_M, M));
+		state_index[table.key(i)] = (uint32_t)i;
+	}
+	const std::string& dir = table.scratch_dir;
+	TableArray<MDP::State> frontier(dir);   // frontier[frontier_head..] is still to expand
+	size_t frontier_head = 0;
+	TableArray<size_t>   first_row(dir, 1, 0);
+	TableArray<int32_t>  row_action(dir);
+	TableArray<size_t>   row_begin(dir, 1, 0);
+	TableArray<uint32_t> next_state(dir);
+	TableArray<double>   probability(dir);
+	TableArray<BoundaryState> boundary(dir);
+	if (n_old > 0) {
+		first_row.reserve(table.first_row.size());
+		row_action.reserve(table.row_action.size());
+		row_begin.reserve(table.row_begin.size());
+		next_state.reserve(table.next_state.size());
+		probability.reserve(table.probability.size());
+	}
 
-	auto add_state = [&](MDP::State s) -> size_t {
-		s.queue_manager.clamp_fil(M);
-		uint64_t key = encoder.encode(s);
-		auto it = state_index.find(key);
-		if (it != state_index.end()) return it->second;
-		size_t idx = states.size();
+	// The key is taken from the unclamped state (encode clamps), so a State is only
+	// copied when it is new.
+	auto add_state = [&](const MDP::State& state) -> uint32_t {
+		MDP::RVIKey key = encoder.encode(state);
+		if (state.cat == DynaPlex::StateCategory::AwaitEvent())
+			key = table.symmetry.canonical(encoder, key);
+		if (const uint32_t* known = state_index.find(key)) return *known;
+		if (table.state_key.size() >= std::numeric_limits<uint32_t>::max())
+			throw DynaPlex::Error("queue_mdp::runRVI: more than 2^32 states at M=" + std::to_string(M));
+		const uint32_t idx = (uint32_t)table.state_key.size();
 		state_index[key] = idx;
-		states.push_back(s);
-		transitions.push_back(std::vector<std::vector<Transition>>((size_t)A_max));
+		MDP::State s = state;
+		s.queue_manager.clamp_fil(M);
+		table.push_key(key);
+		table.awaits_action.push_back(s.cat == DynaPlex::StateCategory::AwaitAction() ? 1 : 0);
 
 		// Delegate to ComputeTickCost so reward_type is respected
 		// (reward_type=0 -> binary; reward_type=1 -> queue-lateness).
@@ -96,90 +361,677 @@ MDP::RVISolution MDP::runRVI(int M, int max_iter, bool silent) const {
 		// UNSHAPED base cost (0 resp. 1): shaping preserves the optimal policy
 		// and long-run average, and RVI's state-cost structure cannot
 		// represent the action-tied refund terms.
-		const int64_t rvi_rtype = (reward_type == 2) ? 0
-		                        : (reward_type == 3) ? 1 : reward_type;
+		const int64_t rvi_rtype = (mdp.reward_type == 2) ? 0
+		                        : (mdp.reward_type == 3) ? 1 : mdp.reward_type;
 		if (s.cat == DynaPlex::StateCategory::AwaitEvent())
-			immediate_cost.push_back((tick_rate / uniformization_rate) * ComputeTickCost(s, rvi_rtype));
+			table.immediate_cost.push_back((mdp.tick_rate / mdp.uniformization_rate) * mdp.ComputeTickCost(s, rvi_rtype));
 		else
-			immediate_cost.push_back(0.0);
-		bfs_queue.push(idx);
+			table.immediate_cost.push_back(0.0);
+		frontier.push_back(s);
 		return idx;
 	};
 
-	add_state(GetInitialState());
-
-	while (!bfs_queue.empty()) {
-		size_t i = bfs_queue.front(); bfs_queue.pop();
-		MDP::State s = states[i];
-
+	std::vector<MDP::nextStateProbability> dist;
+	auto expand = [&](uint32_t idx, const MDP::State& s) {
 		// NOTE: RVI deliberately stays on the binary action set {0,1} even when
 		// enable_skip_all adds action 2 for RL.  Skip-all is value-degenerate with a
 		// chain of single skips, so the {0,1}-optimal policy and g* are exactly
 		// optimal in the extended MDP too — the benchmark is unaffected.
-		// In per-event mode the action set is {0..n_jobs} (A_max slots).
+		// In per-event and joint mode the action set is {0..A_max-1}.
 		int n_actions = (s.cat == DynaPlex::StateCategory::AwaitAction()) ? A_max : 1;
 		for (int a = 0; a < n_actions; ++a) {
 			if (s.cat == DynaPlex::StateCategory::AwaitAction() &&
-			    !IsAllowedAction(s, (int64_t)a)) continue;
+			    !mdp.IsAllowedAction(s, (int64_t)a)) continue;
 
-			auto dist = getNextStateProbability(s, (int64_t)a);
+			mdp.getNextStateProbability(s, (int64_t)a, dist);
+			if (dist.empty()) continue;
 			for (const auto& entry : dist) {
-				MDP::State s_prime = entry.next_state;
-				s_prime.queue_manager.clamp_fil(M);
-				size_t j = add_state(s_prime);
-				transitions[i][a].push_back({ j, entry.probability });
+				next_state.push_back(add_state(entry.next_state));
+				probability.push_back(entry.probability);
 			}
+			row_action.push_back(a);
+			row_begin.push_back(next_state.size());
+		}
+		first_row.push_back(row_action.size());
+
+		if (table.keep_boundary)
+			for (int64_t fil : s.queue_manager.get_FIL_waiting())
+				if (fil >= M) { boundary.push_back({ idx, s }); break; }
+	};
+
+	if (n_old == 0)
+		add_state(mdp.GetInitialState());
+
+	// Old states: copy the rows of interior states, expand the old boundary again.
+	size_t n_boundary = 0;
+	for (size_t i = 0; i < n_old; ++i) {
+		if (n_boundary < table.boundary.size() && table.boundary[n_boundary].index == i) {
+			expand((uint32_t)i, table.boundary[n_boundary++].state);
+			continue;
+		}
+		for (size_t r = table.first_row[i]; r < table.first_row[i + 1]; ++r) {
+			next_state.append(table.next_state.begin() + table.row_begin[r],
+			                  table.next_state.begin() + table.row_begin[r + 1]);
+			probability.append(table.probability.begin() + table.row_begin[r],
+			                   table.probability.begin() + table.row_begin[r + 1]);
+			row_action.push_back(table.row_action[r]);
+			row_begin.push_back(next_state.size());
 		}
+		first_row.push_back(row_action.size());
 	}
 
-	// Print BFS stats
-	size_t n_await_event = 0, n_await_action = 0, total_transitions = 0;
-	for (size_t i = 0; i < states.size(); ++i) {
-		(states[i].cat == DynaPlex::StateCategory::AwaitAction()) ? ++n_await_action : ++n_await_event;
-		for (int a = 0; a < A_max; ++a)
-			total_transitions += transitions[i][a].size();
+	while (frontier_head < frontier.size()) {
+		const MDP::State s = frontier[frontier_head++];
+		expand((uint32_t)(first_row.size() - 1), s);
+		// Drop the expanded States once they are the larger half (amortised O(1)).
+		if (frontier_head >= 4096 && 2 * frontier_head >= frontier.size()) {
+			frontier.erase_front(frontier_head);
+			frontier_head = 0;
+		}
+	}
+
+	table.M = M;
+	table.first_row.swap(first_row);
+	table.row_action.swap(row_action);
+	table.row_begin.swap(row_begin);
+	table.next_state.swap(next_state);
+	table.probability.swap(probability);
+	table.boundary.swap(boundary);
+
+	// Warm start: a new state takes the value of the old state it clamps to.
+	const size_t n_states = table.state_key.size();
+	if (!h.empty()) {
+		h.resize(n_states, 0.0);
+		for (size_t i = n_old; i < n_states; ++i) {
+			MDP::RVIKey old_key = encoder.project(table.key(i), M, old_M);
+			if (!table.awaits_action[i])
+				old_key = table.symmetry.canonical(encoder, old_key);   // clamping can leave the orbit's least key
+			const uint32_t* old = state_index.find(old_key);
+			if (old && *old < n_old)
+				h[i] = h[*old];
+		}
+	}
+
+	if (!silent && n_old > 0)
+		std::cout << "\nGrew the transition table from M=" << old_M << " to M=" << M
+		          << ": " << n_states - n_old << " new states, " << n_boundary
+		          << " boundary states expanded again\n";
+}
+
+// ---- Single-precision row kernel (mixed_precision) ----
+// sum_e p[e] * x[j[e]] over the n transitions of one row.  The AVX2 version
+// gathers eight x values per step and takes the row's tail under a mask, so it
+// suits rows of a few to a few dozen transitions; it is picked at run time, and
+// the library still runs on CPUs without it.  Indices are gathered as int32, so
+// it needs fewer than 2^31 states.
+using RowDotKernel = float (*)(const float* p, const uint32_t* j, size_t n, const float* x);
+
+float RowDotScalar(const float* p, const uint32_t* j, size_t n, const float* x) {
+	float sum = 0.0f;
+	for (size_t e = 0; e < n; ++e)
+		sum += p[e] * x[j[e]];
+	return sum;
+}
+
+#ifdef QUEUE_MDP_AVX2_KERNEL
+__attribute__((target("avx2,fma")))
+float RowDotAVX2(const float* p, const uint32_t* j, size_t n, const float* x) {
+	__m256 acc = _mm256_setzero_ps();
+	size_t e = 0;
+	for (; e + 8 <= n; e += 8) {
+		const __m256i idx = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(j + e));
+		acc = _mm256_fmadd_ps(_mm256_loadu_ps(p + e), _mm256_i32gather_ps(x, idx, 4), acc);
+	}
+	if (e < n) {
+		const __m256i mask = _mm256_cmpgt_epi32(_mm256_set1_epi32((int)(n - e)),
+		                                        _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7));
+		const __m256i idx = _mm256_maskload_epi32(reinterpret_cast<const int*>(j + e), mask);
+		const __m256 xv = _mm256_mask_i32gather_ps(_mm256_setzero_ps(), x, idx, _mm256_castsi256_ps(mask), 4);
+		acc = _mm256_fmadd_ps(_mm256_maskload_ps(p + e, mask), xv, acc);
 	}
+	const __m128 half = _mm_add_ps(_mm256_castps256_ps128(acc), _mm256_extractf128_ps(acc, 1));
+	const __m128 pair = _mm_add_ps(half, _mm_movehl_ps(half, half));
+	return _mm_cvtss_f32(_mm_add_ss(pair, _mm_shuffle_ps(pair, pair, 1)));
+}
+#endif
+
+RowDotKernel PickRowDot(size_t n_states, const char*& name) {
+#ifdef QUEUE_MDP_AVX2_KERNEL
+	if (n_states < ((size_t)1 << 31) && __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma")) {
+		name = "AVX2";
+		return RowDotAVX2;
+	}
+#endif
+	(void)n_states;
+	name = "scalar";
+	return RowDotScalar;
+}
+
+// Solves the table by relative value iteration (Jacobi or Gauss-Seidel) or policy
+// iteration, starting from h (empty: all zeros).  Gauss-Seidel and policy
+// iteration renumber the table into sweep order first.  On return h holds the
+// solution's relative values in the table's order, ready to warm-start a larger M.
+// mixed_precision runs the bulk of the value-iteration sweeps in single precision
+// (see Correction rounds below).
+MDP::RVISolution SolveTable(const MDP& mdp, TransitionTable& table, std::vector<double>& h,
+                            const MDP::RVIOptions& options) {
+	const int max_iter              = options.max_iter;
+	const bool silent               = options.silent;
+	int64_t num_threads             = options.num_threads;
+	const bool gauss_seidel         = options.gauss_seidel;
+	const double relaxation         = options.relaxation;
+	const bool policy_iteration     = options.policy_iteration;
+	const int max_krylov            = options.max_krylov;
+	const double rel_gap            = options.rel_gap;
+	const bool mixed_precision      = options.mixed_precision;
+	const int M = table.M;
+	const StateEncoder encoder(mdp, M);
+	const std::string& dir = table.scratch_dir;
+	auto& state_key      = table.state_key;
+	auto& awaits_action  = table.awaits_action;
+	auto& immediate_cost = table.immediate_cost;
+	auto& first_row      = table.first_row;
+	auto& row_action     = table.row_action;
+	auto& row_begin      = table.row_begin;
+	auto& next_state     = table.next_state;
+	auto& probability    = table.probability;
+
+	const size_t n_states = state_key.size();
+	const bool warm = !h.empty();
+	if (!warm)
+		h.assign(n_states, 0.0);
+
+	// Print BFS stats
+	size_t n_await_action = 0;
+	for (uint8_t is_action : awaits_action) n_await_action += is_action;
 	if (!silent) {
 		std::cout << "\n--- Transition table (M=" << M << ") ---\n"
-			      << "Total states     : " << states.size() << "\n"
-			      << "  AwaitEvent     : " << n_await_event << "\n"
+			      << "Total states     : " << n_states << "\n"
+			      << "  AwaitEvent     : " << n_states - n_await_action << "\n"
 			      << "  AwaitAction    : " << n_await_action << "\n"
-			      << "Total transitions: " << total_transitions << "\n";
+			      << "Total transitions: " << next_state.size() << "\n";
+		if (!dir.empty())
+			std::cout << "Out of core      : table in scratch files in " << dir << "\n";
 	}
 
-	// ---- RVI loop ----
-	const size_t ref = 0;
-	const double eps = 1e-10;
-	std::vector<double> h(states.size(), 0.0);
+	// Gauss-Seidel: h is updated in place, h(i) <- h(i) + w * ((T h)(i) - g - h(i)), so
+	// later states in the sweep already see this sweep's values.  Its fixed point
+	// (h(ref) = 0, h = T h - g) is the same average-cost optimality equation as
+	// Jacobi's, hence the same g* and action map.  Ticks only age jobs, so value
+	// flows from high to low waiting times: states are swept by decreasing sum of
+	// the waiting times, and within a sum action states (by decreasing action_counter, the top key
+	// digit) come before the event states whose completions lead to them.  The
+	// ref state (the initial, empty system) goes last and sets g for the next
+	// sweep.  The tables are renumbered into sweep order once, so that the sweep
+	// reads them sequentially.  Policy iteration uses the same order for its
+	// Gauss-Seidel preconditioner.
+	size_t& ref = table.ref;
+	if (gauss_seidel || policy_iteration) {
+		std::vector<int> wait_sum(n_states);
+		for (size_t i = 0; i < n_states; ++i)
+			wait_sum[i] = encoder.wait_sum(table.key(i));
+		std::vector<uint32_t> order;   // sweep position -> current index
+		order.reserve(n_states);
+		for (size_t i = 0; i < n_states; ++i)
+			if (i != ref) order.push_back((uint32_t)i);
+		std::stable_sort(order.begin(), order.end(), [&](uint32_t a, uint32_t b) {
+			if (wait_sum[a] != wait_sum[b]) return wait_sum[a] > wait_sum[b];
+			if (awaits_action[a] != awaits_action[b]) return awaits_action[a] > awaits_action[b];
+			return table.key(a) > table.key(b);
+		});
+		order.push_back((uint32_t)ref);
+		ref = n_states - 1;
+
+		std::vector<uint32_t> position(n_states);
+		for (size_t i = 0; i < n_states; ++i)
+			position[order[i]] = (uint32_t)i;
+		auto permute = [&](auto& values, auto sorted) {
+			for (size_t i = 0; i < n_states; ++i)
+				sorted[i] = values[order[i]];
+			values.swap(sorted);
+		};
+		permute(state_key, TableArray<uint64_t>(dir, n_states, 0));
+		if (!table.state_key_hi.empty())
+			permute(table.state_key_hi, TableArray<uint64_t>(dir, n_states, 0));
+		permute(awaits_action, TableArray<uint8_t>(dir, n_states, 0));
+		permute(immediate_cost, TableArray<double>(dir, n_states, 0.0));
+		permute(h, std::vector<double>(n_states));
+		for (auto& [i, s] : table.boundary)
+			i = position[i];
+		std::sort(table.boundary.begin(), table.boundary.end(),
+		          [](const auto& a, const auto& b) { return a.index < b.index; });
+
+		TableArray<size_t>   sorted_first_row(dir, 1, 0);
+		TableArray<int32_t>  sorted_row_action(dir);
+		TableArray<size_t>   sorted_row_begin(dir, 1, 0);
+		TableArray<uint32_t> sorted_next_state(dir);
+		TableArray<double>   sorted_probability(dir);
+		sorted_row_action.reserve(row_action.size());
+		sorted_row_begin.reserve(row_begin.size());
+		sorted_next_state.reserve(next_state.size());
+		sorted_probability.reserve(probability.size());
+		for (uint32_t i : order) {
+			for (size_t r = first_row[i]; r < first_row[i + 1]; ++r) {
+				for (size_t e = row_begin[r]; e < row_begin[r + 1]; ++e) {
+					sorted_next_state.push_back(position[next_state[e]]);
+					sorted_probability.push_back(probability[e]);
+				}
+				sorted_row_action.push_back(row_action[r]);
+				sorted_row_begin.push_back(sorted_next_state.size());
+			}
+			sorted_first_row.push_back(sorted_row_action.size());
+		}
+		first_row.swap(sorted_first_row);
+		row_action.swap(sorted_row_action);
+		row_begin.swap(sorted_row_begin);
+		next_state.swap(sorted_next_state);
+		probability.swap(sorted_probability);
+	}
+
+	// Expected next-iterate value of row r (Q-value without immediate cost).
+	auto row_value = [&](size_t r, const std::vector<double>& h) {
+		double val = 0.0;
+		for (size_t e = row_begin[r]; e < row_begin[r + 1]; ++e)
+			val += probability[e] * h[next_state[e]];
+		return val;
+	};
+
+	// (T h)(i): immediate cost plus expectation for event states, best row for action states.
+	auto bellman = [&](size_t i, const std::vector<double>& h) {
+		if (!awaits_action[i]) {
+			double val = immediate_cost[i];
+			if (first_row[i] < first_row[i + 1]) {
+				const size_t r = first_row[i];
+				for (size_t e = row_begin[r]; e < row_begin[r + 1]; ++e)
+					val += probability[e] * h[next_state[e]];
+			}
+			return val;
+		}
+		double best = std::numeric_limits<double>::infinity();
+		for (size_t r = first_row[i]; r < first_row[i + 1]; ++r)
+			best = std::min(best, row_value(r, h));
+		return best;
+	};
+
+	// ---- Stranded states ----
+	// Some states cannot reach ref (the empty system) under any policy: with every
+	// type waiting at the FIL cap and no server busy, arrivals and ticks are
+	// self-loops and no decision ever comes.  These stranded states, and those that
+	// cannot avoid them, form closed classes with their own (larger) average cost,
+	// so their h would grow without bound and keep the span, and the g* bounds
+	// below, from converging.  Every solver gives them h = +inf and leaves them out;
+	// g* and the action map elsewhere are unchanged, since no optimal path from ref
+	// enters them.  reach_ref walks the rows into each state backwards from ref,
+	// skipping rows that touch a stranded state.  With any_row it also picks, for
+	// each state it reaches, the first row found, i.e. a shortest way to empty the
+	// system (policy iteration's initial policy).  Otherwise it follows only the
+	// rows in policy_row.
+	std::vector<size_t> policy_row(first_row.begin(), first_row.end() - 1);
+	TableArray<uint32_t> row_state(dir, row_action.size(), 0);
+	TableArray<size_t>   into_begin(dir, n_states + 1, 0);
+	TableArray<size_t>   into_row(dir, next_state.size(), 0);
+	for (size_t i = 0; i < n_states; ++i)
+		for (size_t r = first_row[i]; r < first_row[i + 1]; ++r) {
+			row_state[r] = (uint32_t)i;
+			for (size_t e = row_begin[r]; e < row_begin[r + 1]; ++e)
+				++into_begin[next_state[e] + 1];
+		}
+	for (size_t i = 0; i < n_states; ++i)
+		into_begin[i + 1] += into_begin[i];
+	{
+		std::vector<size_t> fill(into_begin.begin(), into_begin.end() - 1);
+		for (size_t r = 0; r < row_action.size(); ++r)
+			for (size_t e = row_begin[r]; e < row_begin[r + 1]; ++e)
+				into_row[fill[next_state[e]]++] = r;
+	}
+	std::vector<uint8_t>  stranded(n_states, 0);
+	TableArray<uint8_t>   usable_row(dir, row_action.size(), 1);
+	std::vector<uint8_t>  reaches(n_states);
+	std::vector<uint32_t> reach_queue;
+	auto reach_ref = [&](bool any_row) {
+		std::fill(reaches.begin(), reaches.end(), 0);
+		reach_queue.assign(1, (uint32_t)ref);
+		reaches[ref] = 1;
+		for (size_t q = 0; q < reach_queue.size(); ++q) {
+			const uint32_t j = reach_queue[q];
+			for (size_t k = into_begin[j]; k < into_begin[j + 1]; ++k) {
+				const size_t r = into_row[k];
+				const uint32_t i = row_state[r];
+				if (reaches[i] || !usable_row[r] || (!any_row && policy_row[i] != r)) continue;
+				policy_row[i] = r;
+				reaches[i] = 1;
+				reach_queue.push_back(i);
+			}
+		}
+	};
+	size_t n_stranded = 0;
+	while (true) {
+		reach_ref(true);
+		size_t newly = 0;
+		for (size_t i = 0; i < n_states; ++i)
+			if (!reaches[i] && !stranded[i]) { stranded[i] = 1; ++newly; }
+		if (newly == 0) break;
+		n_stranded += newly;
+		for (size_t r = 0; r < row_action.size(); ++r)
+			for (size_t e = row_begin[r]; e < row_begin[r + 1] && usable_row[r]; ++e)
+				if (stranded[next_state[e]]) usable_row[r] = 0;
+	}
+	if (!silent)
+		std::cout << "Stranded states  : " << n_stranded << "\n";
+	if (!policy_iteration) {   // only policy improvement walks the chain backwards again
+		row_state.release();
+		into_begin.release();
+		into_row.release();
+		std::vector<size_t>().swap(policy_row);
+		std::vector<uint8_t>().swap(reaches);
+		std::vector<uint32_t>().swap(reach_queue);
+	}
+
+	// A warm start may carry +inf from states stranded at the previous M into
+	// states that are not stranded now; those start from the largest finite value.
+	const double inf = std::numeric_limits<double>::infinity();
+	double h_max = 0.0;
+	for (size_t i = 0; i < n_states; ++i)
+		if (!stranded[i] && std::isfinite(h[i])) h_max = std::max(h_max, h[i]);
+	for (size_t i = 0; i < n_states; ++i)
+		h[i] = stranded[i] ? inf : std::isfinite(h[i]) ? h[i] : h_max;
+
 	double g_star = 0.0;
-	double g_prev = 0.0;
-	int g_stable_count = 0;
-
-	for (int iter = 0; iter < max_iter; ++iter) {
-		std::vector<double> h_new(states.size());
-
-		for (size_t i = 0; i < states.size(); ++i) {
-			if (states[i].cat == DynaPlex::StateCategory::AwaitEvent()) {
-				double val = immediate_cost[i];
-				for (const auto& t : transitions[i][0])
-					val += t.probability * h[t.next_state_idx];
-				h_new[i] = val;
+
+	// ---- Bounds on g* ----
+	// For any h, min_i ((T h)(i) - h(i)) <= g* <= max_i ((T h)(i) - h(i)) over the
+	// states that are not stranded (Odoni): g* is the average of T h - h under the
+	// optimal policy's stationary distribution, and the average under the policy
+	// greedy on h, which is at least g*, is at most the maximum.  Jacobi gets them
+	// from every sweep; Gauss-Seidel and policy iteration, whose h is not one
+	// sweep's input, from this separate pass.  With rel_gap > 0 the solve stops as
+	// soon as (upper - lower) / lower < rel_gap.  The bounds are on g* of the
+	// truncated chain at this M, not on the truncation error.
+	double g_lower = -inf, g_upper = inf;
+	auto residual_bounds = [&]() {
+		g_lower = inf;
+		g_upper = -inf;
+		for (size_t i = 0; i < n_states; ++i) {
+			if (stranded[i]) continue;
+			const double d = bellman(i, h) - h[i];
+			g_lower = std::min(g_lower, d);
+			g_upper = std::max(g_upper, d);
+		}
+	};
+	// A warm start (h from a smaller M) is off mostly at the old FIL cap, and Jacobi
+	// moves that error one transition per sweep: g* can sit still for many sweeps
+	// before it reaches ref, and the g_stable rule would stop there.  A warm Jacobi
+	// solve therefore stops on the bounds, which every Jacobi sweep provides, at
+	// rel_gap or else at a hundredth of the rel_tol that successive M are compared at.
+	const bool warm_jacobi = warm && !gauss_seidel && !policy_iteration;
+	const double stop_gap = rel_gap > 0.0 ? rel_gap : warm_jacobi ? 0.01 * options.rel_tol : 0.0;
+	auto gap_certified = [&]() {
+		return stop_gap > 0.0 && g_lower > 0.0 && (g_upper - g_lower) / g_lower < stop_gap;
+	};
+
+	// ---- Policy iteration ----
+	// Evaluation solves the Poisson equation of the current policy,
+	//   h(i) + g = c(i) + sum_j P(i,j) h(j),   h(ref) = 0,
+	// as one linear system A x = c, where x is h with x[ref] standing in for g and
+	// A is I - P with column ref replaced by ones.  The system is non-symmetric,
+	// so it is solved by BiCGSTAB, warm-started from the previous policy's values
+	// and preconditioned by one forward Gauss-Seidel sweep: in sweep order the
+	// ticks, which dominate P, sit in the lower triangle.  Improvement moves an
+	// action state to its best row only if that beats the current row by more
+	// than switch_tol, so near-ties cannot make the policy cycle; it stops once
+	// no row changes.  The action map is then extracted from h exactly as for RVI.
+	// An evaluation that does not converge within max_krylov steps hands over to
+	// value iteration, started from the last policy's h: same fixed point.
+	bool value_iteration = !policy_iteration;
+	if (policy_iteration) {
+		const double krylov_tol = 1e-12;   // relative residual ||c - A x|| / ||c||
+		const double switch_tol = 1e-9;
+
+		// (A x)(i) for the current policy; stranded rows are the identity.
+		auto apply = [&](size_t i, const std::vector<double>& x) {
+			if (stranded[i]) return x[i];
+			double val = (i == ref ? 0.0 : x[i]) + x[ref];
+			if (first_row[i] < first_row[i + 1]) {
+				const size_t r = policy_row[i];
+				for (size_t e = row_begin[r]; e < row_begin[r + 1]; ++e)
+					if (next_state[e] != ref)
+						val -= probability[e] * x[next_state[e]];
 			}
-			else {
-				double best = std::numeric_limits<double>::infinity();
-				for (int a = 0; a < A_max; ++a) {
-					if (transitions[i][a].empty()) continue;
-					double val = 0.0;
-					for (const auto& t : transitions[i][a])
-						val += t.probability * h[t.next_state_idx];
-					best = std::min(best, val);
+			return val;
+		};
+		// y = L^-1 p, L the lower triangle of A (ref is last, so column ref is not in it).
+		auto precondition = [&](const std::vector<double>& p, std::vector<double>& y) {
+			for (size_t i = 0; i < n_states; ++i) {
+				double val = p[i], diag = 1.0;
+				if (!stranded[i] && first_row[i] < first_row[i + 1]) {
+					const size_t r = policy_row[i];
+					for (size_t e = row_begin[r]; e < row_begin[r + 1]; ++e) {
+						const size_t j = next_state[e];
+						if (j < i) val += probability[e] * y[j];
+						else if (j == i && i != ref) diag -= probability[e];
+					}
+				}
+				y[i] = val / (diag > 1e-12 ? diag : 1.0);
+			}
+		};
+		auto dot = [&](const std::vector<double>& a, const std::vector<double>& b) {
+			double sum = 0.0;
+			for (size_t i = 0; i < n_states; ++i) sum += a[i] * b[i];
+			return sum;
+		};
+
+		std::vector<double> c(immediate_cost.begin(), immediate_cost.end());
+		for (size_t i = 0; i < n_states; ++i)
+			if (stranded[i]) c[i] = 0.0;
+		const double target = krylov_tol * std::max(std::sqrt(dot(c, c)), 1e-300);
+
+		// Right-preconditioned BiCGSTAB on A x = c, starting from x.  Returns the
+		// number of steps, or -1 if the tolerance was not reached.
+		std::vector<double> x(n_states, 0.0), r(n_states), r_hat(n_states), p(n_states),
+		                    v(n_states), s(n_states), t(n_states), y(n_states), z(n_states);
+		for (size_t i = 0; i < n_states; ++i)
+			if (i != ref && !stranded[i] && std::isfinite(h[i])) x[i] = h[i];
+		auto evaluate = [&]() -> int {
+			double rho = 1.0, alpha = 1.0, omega = 1.0;
+			bool restart = true;
+			for (int step = 0; step < max_krylov; ++step) {
+				if (restart) {   // (re)start from the true residual, e.g. after a breakdown
+					for (size_t i = 0; i < n_states; ++i)
+						r[i] = c[i] - apply(i, x);
+					if (std::sqrt(dot(r, r)) <= target) return step;
+					r_hat = r;
+					std::fill(p.begin(), p.end(), 0.0);
+					std::fill(v.begin(), v.end(), 0.0);
+					rho = alpha = omega = 1.0;
+					restart = false;
+				}
+				const double rho_next = dot(r_hat, r);
+				if (rho_next == 0.0 || omega == 0.0) { restart = true; continue; }
+				const double beta = (rho_next / rho) * (alpha / omega);
+				rho = rho_next;
+				for (size_t i = 0; i < n_states; ++i)
+					p[i] = r[i] + beta * (p[i] - omega * v[i]);
+				precondition(p, y);
+				for (size_t i = 0; i < n_states; ++i)
+					v[i] = apply(i, y);
+				const double r_hat_v = dot(r_hat, v);
+				if (r_hat_v == 0.0) { restart = true; continue; }
+				alpha = rho / r_hat_v;
+				for (size_t i = 0; i < n_states; ++i)
+					s[i] = r[i] - alpha * v[i];
+				if (std::sqrt(dot(s, s)) <= target) {
+					for (size_t i = 0; i < n_states; ++i) x[i] += alpha * y[i];
+					return step + 1;
+				}
+				precondition(s, z);
+				for (size_t i = 0; i < n_states; ++i)
+					t[i] = apply(i, z);
+				const double t_t = dot(t, t);
+				omega = t_t > 0.0 ? dot(t, s) / t_t : 0.0;
+				for (size_t i = 0; i < n_states; ++i) {
+					x[i] += alpha * y[i] + omega * z[i];
+					r[i] = s[i] - omega * t[i];
 				}
-				h_new[i] = best;
+				if (!std::isfinite(x[ref]))
+					throw DynaPlex::Error("queue_mdp::runRVI: policy evaluation diverged at M=" + std::to_string(M));
+				if (std::sqrt(dot(r, r)) <= target) return step + 1;
+			}
+			return -1;
+		};
+
+		// Improves policy_row greedily on h; returns the number of rows changed.
+		std::vector<size_t> previous_row;
+		auto improve = [&]() -> size_t {
+			previous_row = policy_row;
+			for (size_t i = 0; i < n_states; ++i) {
+				if (!awaits_action[i] || stranded[i]) continue;
+				double best_q = row_value(policy_row[i], h);
+				const double bar = best_q - switch_tol * (1.0 + std::abs(best_q));
+				for (size_t r = first_row[i]; r < first_row[i + 1]; ++r) {
+					const double q = row_value(r, h);
+					if (q < bar && q < best_q) { best_q = q; policy_row[i] = r; }
+				}
+			}
+			// States cut off from ref keep their previous row.  Their old paths to ref
+			// run through reverted states or states that reach ref anyway, so the
+			// repaired policy reaches ref everywhere; its recurrent class lies among
+			// improved states, so g* does not increase.
+			reach_ref(false);
+			size_t changed = 0;
+			for (size_t i = 0; i < n_states; ++i) {
+				if (!reaches[i]) policy_row[i] = previous_row[i];
+				changed += (policy_row[i] != previous_row[i]);
+			}
+			return changed;
+		};
+
+		// A warm start (h from a smaller M) begins with the policy that is greedy on it.
+		if (warm)
+			improve();
+		for (int iter = 0; iter < max_iter; ++iter) {
+			const int steps = evaluate();
+			if (steps < 0) {
+				if (!silent)
+					std::cout << "[RVI] WARNING: PI iter " << iter << ": BiCGSTAB did not converge in "
+					          << max_krylov << " steps; continuing with value iteration.\n";
+				value_iteration = true;
+				break;
+			}
+			g_star = x[ref];
+			for (size_t i = 0; i < n_states; ++i)
+				h[i] = stranded[i] ? inf : x[i];
+			h[ref] = 0.0;
+
+			residual_bounds();
+			const bool certified = gap_certified();
+			const size_t changed = certified ? 0 : improve();
+			if (!silent)
+				std::cout << "PI iter " << std::setw(4) << iter
+				          << "  g*=" << std::setprecision(10) << g_star
+				          << "  BiCGSTAB steps=" << steps
+				          << "  changed=" << changed << "\n";
+			if (changed == 0) {
+				if (!silent)
+					std::cout << "\nConverged at PI iter " << iter << (certified ? "  [bounds]" : "")
+					          << "  g* = " << std::setprecision(12) << g_star << "\n";
+				break;
 			}
 		}
+	}
+	if (value_iteration) {
+		// ---- Threads: contiguous state ranges of about equal transition count ----
+		// Every h_new[i] depends only on h, and min/max are exact, so neither the
+		// split nor the thread count can change a single bit of the result.
+		if (num_threads <= 0)
+			num_threads = (int64_t)std::thread::hardware_concurrency();
+		if (gauss_seidel)
+			num_threads = 1;   // in-place sweep: each update reads the ones before it
+		const size_t MinStatesPerThread = 1 << 14;
+		const size_t n_threads = std::clamp<size_t>(n_states / MinStatesPerThread, 1,
+		                                            (size_t)std::max<int64_t>(num_threads, 1));
+		std::vector<size_t> range_begin(n_threads + 1, n_states);
+		range_begin[0] = 0;
+		for (size_t t = 1; t < n_threads; ++t) {
+			const size_t target = next_state.size() * t / n_threads;
+			size_t lo = range_begin[t - 1], hi = n_states;
+			while (lo < hi) {   // first state whose transitions start at or after target
+				const size_t mid = lo + (hi - lo) / 2;
+				if (row_begin[first_row[mid]] < target) lo = mid + 1; else hi = mid;
+			}
+			range_begin[t] = lo;
+		}
+		SweepTeam team(n_threads);
+		if (!silent && n_threads > 1)
+			std::cout << "Bellman sweep on " << n_threads << " threads\n";
+
+		// ---- RVI loop ----
+		const double eps = 1e-10;
+		const int BoundInterval = 10;   // Gauss-Seidel sweeps per bounds pass when rel_gap is set
+		std::vector<double> h_new(gauss_seidel ? 0 : n_states);   // Gauss-Seidel works in h alone
+		double g_prev = 0.0;
+		int g_stable_count = 0;
+
+		// ---- Suspended rows (per-event and joint modes) ----
+		// With n_jobs + 1 or more rows per action state, most of a sweep goes into
+		// rows nowhere near the minimum.  Every row of P is a probability vector, so
+		// between two evaluations of state i, Q(i,a) - Q(i,b) shrinks by at most the
+		// span of the change in h.  A row that exceeded the state's minimum by a slack
+		// s is skipped until the spans summed since then reach s: span_sum is that
+		// running sum and suspended_until[r] the level it has to pass for row r to be
+		// evaluated again.  Rows into stranded states (Q = inf) stay suspended.
+		// Permanent (MacQueen) elimination would need a bound on sp(h* - h), which
+		// average-cost RVI does not have, so rows are suspended rather than removed
+		// from the CSR arrays.  A skipped row cannot hold the minimum, hence every
+		// iterate is bit-identical to a full sweep.  In Gauss-Seidel a state also
+		// sees the part of the current sweep before it: a row is tested against
+		// span_sum plus the running span of this sweep, but suspended relative to
+		// span_sum alone.
+		const bool suspend = mdp.per_event_mode || mdp.joint_mode;
+		TableArray<double> suspended_until(dir, suspend ? row_action.size() : 0, -inf);
+		double span_sum = 0.0;
+		size_t rows_per_state = 0;
+		for (size_t i = 0; suspend && i < n_states; ++i)
+			rows_per_state = std::max(rows_per_state, first_row[i + 1] - first_row[i]);
+		std::vector<std::vector<double>> row_q(n_threads, std::vector<double>(rows_per_state));
+		std::vector<size_t> rows_visited(n_threads, 0), rows_evaluated(n_threads, 0);
+
+		// min over the rows r of action state i that are not suspended at level of
+		// value(r), its Q; base is the span_sum the new suspensions are measured from
+		// and margin the relative rounding error of Q.
+		auto min_unsuspended = [&](size_t i, const auto& value, double level, double base, double margin, size_t t) {
+			std::vector<double>& q = row_q[t];
+			const size_t r0 = first_row[i];
+			double best = inf;
+			for (size_t r = r0; r < first_row[i + 1]; ++r) {
+				if (suspended_until[r] > level) continue;
+				q[r - r0] = value(r);
+				best = std::min(best, q[r - r0]);
+				++rows_evaluated[t];
+			}
+			rows_visited[t] += first_row[i + 1] - r0;
+			for (size_t r = r0; r < first_row[i + 1]; ++r) {
+				if (suspended_until[r] > level) continue;
+				const double qr = q[r - r0];
+				// The margin covers rounding in Q and in the summed spans.
+				const double slack = qr - best - margin * (std::abs(qr) + std::abs(best));
+				suspended_until[r] = qr == inf ? inf : slack > 0.0 ? base + slack : -inf;
+			}
+			return best;
+		};
+
+		// (T h)(i) over the rows of i that are not suspended at level.
+		auto bellman_suspended = [&](size_t i, const std::vector<double>& h, double level, double base, size_t t) {
+			if (!awaits_action[i])
+				return bellman(i, h);
+			return min_unsuspended(i, [&](size_t r) { return row_value(r, h); }, level, base, 1e-12, t);
+		};
 
-		g_star = h_new[ref];
-		for (auto& v : h_new) v -= g_star;
+		const std::function<void(size_t)> sweep = [&](size_t t) {
+			for (size_t i = range_begin[t]; i < range_begin[t + 1]; ++i)
+				h_new[i] = stranded[i] ? inf
+				         : suspend ? bellman_suspended(i, h, span_sum, span_sum, t)
+				         : bellman(i, h);
+		};
 
 		// Span seminorm: max(h_new[i] - h[i]) - min(h_new[i] - h[i]).
 		// This is the theoretically correct RVI convergence criterion.
@@ -188,110 +1040,408 @@ MDP::RVISolution MDP::runRVI(int M, int max_iter, bool silent) const {
 		// shift all residuals by the same amount, leaving the span unchanged.
 		// It is also scale-invariant: QL reward inflates h-values by ~100x
 		// vs. binary reward, but the span converges to zero at the same rate.
-		double max_diff = -std::numeric_limits<double>::infinity();
-		double min_diff =  std::numeric_limits<double>::infinity();
-		for (size_t i = 0; i < states.size(); ++i) {
-			const double d = h_new[i] - h[i];
-			if (d > max_diff) max_diff = d;
-			if (d < min_diff) min_diff = d;
-		}
-		const double span = max_diff - min_diff;
-
-		std::swap(h, h_new);
-
-		if (!silent && iter % 500 == 0)
-			std::cout << "iter " << std::setw(6) << iter
-				      << "  g*=" << std::setprecision(10) << g_star
-				      << "  span=" << std::setprecision(6) << span << "\n";
-
-		// Primary criterion: span < eps (theoretically correct for ergodic MDPs).
-		// Fallback: g_stable_count -- span does NOT converge to zero for truncated
-		// MDPs (the self-loop at FIL=M permanently offsets some Bellman residuals),
-		// but g* converges reliably and quickly.  Five consecutive stable g*
-		// iterations is sufficient in practice.
-		if (iter > 0 && g_star > eps && std::abs(g_star - g_prev) < eps)
-			++g_stable_count;
-		else
-			g_stable_count = 0;
-		g_prev = g_star;
+		// Each thread normalises its range by g* and reduces it to one (max, min).
+		// In Jacobi, g* + min and g* + max are also the bounds on g*.
+		std::vector<double> range_max(n_threads), range_min(n_threads);
+		const std::function<void(size_t)> normalise = [&](size_t t) {
+			double max_diff = -std::numeric_limits<double>::infinity();
+			double min_diff =  std::numeric_limits<double>::infinity();
+			for (size_t i = range_begin[t]; i < range_begin[t + 1]; ++i) {
+				if (stranded[i]) continue;
+				h_new[i] -= g_star;
+				const double d = h_new[i] - h[i];
+				if (d > max_diff) max_diff = d;
+				if (d < min_diff) min_diff = d;
+			}
+			range_max[t] = max_diff;
+			range_min[t] = min_diff;
+		};
+
+		// ---- Correction rounds (mixed_precision) ----
+		// Single-precision sweeps move 8 bytes per transition instead of 12 and gather
+		// 4-byte values, but a float h would stall at a relative error of about 1e-7.
+		// The float sweeps therefore solve for a correction d to the double h:
+		//   h + d = T(h + d) - g   <=>   d(i) = min_r (c_r + sum_e p_e d(j_e)) - g_d,
+		// with c_r = c(i) + sum_e p_e h(j_e) - h(i) - g_h the residual of row r, made in
+		// double once per round, and g_h = (T h)(ref) - h(ref).  A round runs value
+		// iteration on d (Jacobi or Gauss-Seidel, rows suspended as above) until its
+		// span is down to float resolution of d or stops improving, then adds d to h.
+		// c and d shrink with the error of h, so every round gains some five digits.
+		// The rounds end once a correction is that close to eps, or once the sweeps on
+		// d meet the stopping rules below.  g_d is a float sum of terms as large as d,
+		// so g_stable counts only once d is small enough for a change of eps in g to
+		// show.  The double sweeps then take over and stop by those rules themselves,
+		// so g* and its bounds keep double accuracy.
+		if (mixed_precision) {
+			const int    MaxRounds   = 4;
+			const double RoundTol    = 1e-5;   // a round's span target, relative to max |d|
+			const int    StallSweeps = 50;     // sweeps without a new smallest span
+			const char* kernel = nullptr;
+			const RowDotKernel row_dot = PickRowDot(n_states, kernel);
+			TableArray<float> probability32(dir, next_state.size(), 0.0f);
+			for (size_t e = 0; e < next_state.size(); ++e)
+				probability32[e] = (float)probability[e];
+			TableArray<float> row_residual(dir, row_action.size(), 0.0f);
+			std::vector<float> d(n_states), d_new(gauss_seidel ? 0 : n_states);
+			std::vector<double> range_abs(n_threads);
+			double g_h = 0.0, g_d = 0.0;
+
+			const std::function<void(size_t)> residuals = [&](size_t t) {
+				for (size_t i = range_begin[t]; i < range_begin[t + 1]; ++i) {
+					if (stranded[i]) continue;
+					const double c = (awaits_action[i] ? 0.0 : immediate_cost[i]) - h[i] - g_h;
+					for (size_t r = first_row[i]; r < first_row[i + 1]; ++r)
+						row_residual[r] = (float)(c + row_value(r, h));
+				}
+			};
+			auto row_correction = [&](size_t r, const std::vector<float>& x) {
+				const size_t e = row_begin[r];
+				return row_residual[r] + row_dot(probability32.begin() + e, next_state.begin() + e,
+				                                 row_begin[r + 1] - e, x.data());
+			};
+			// min_r (c_r + sum_e p_e x(j_e)) over the rows of i; a state without rows
+			// contributes its cost alone, as in bellman.
+			auto correction_bellman = [&](size_t i, const std::vector<float>& x, double level, double base, size_t t) -> double {
+				const size_t r0 = first_row[i];
+				if (r0 == first_row[i + 1])
+					return awaits_action[i] ? inf : immediate_cost[i] - h[i] - g_h;
+				if (!awaits_action[i])
+					return row_correction(r0, x);
+				if (suspend)   // float Q: a wider rounding margin
+					return min_unsuspended(i, [&](size_t r) { return (double)row_correction(r, x); }, level, base, 1e-5, t);
+				float best = std::numeric_limits<float>::infinity();
+				for (size_t r = r0; r < first_row[i + 1]; ++r)
+					best = std::min(best, row_correction(r, x));
+				return best;
+			};
+			const std::function<void(size_t)> correction_sweep = [&](size_t t) {
+				for (size_t i = range_begin[t]; i < range_begin[t + 1]; ++i)
+					d_new[i] = stranded[i] ? 0.0f : (float)correction_bellman(i, d, span_sum, span_sum, t);
+			};
+			const std::function<void(size_t)> correction_normalise = [&](size_t t) {
+				double max_diff = -inf, min_diff = inf, max_abs = 0.0;
+				for (size_t i = range_begin[t]; i < range_begin[t + 1]; ++i) {
+					if (stranded[i]) continue;
+					d_new[i] -= (float)g_d;
+					const double diff = (double)d_new[i] - d[i];
+					max_diff = std::max(max_diff, diff);
+					min_diff = std::min(min_diff, diff);
+					max_abs = std::max(max_abs, (double)std::abs(d_new[i]));
+				}
+				range_max[t] = max_diff;
+				range_min[t] = min_diff;
+				range_abs[t] = max_abs;
+			};
 
-		if (span < eps || g_stable_count >= 5) {
+			int sweeps = 0, rounds = 0;
+			bool converged = false;
+			while (!converged && rounds < MaxRounds && sweeps < max_iter) {
+				++rounds;
+				g_h = bellman(ref, h) - h[ref];
+				team.run(residuals);
+				std::fill(d.begin(), d.end(), 0.0f);
+				std::fill(suspended_until.begin(), suspended_until.end(), -inf);
+				span_sum = 0.0;
+				g_d = 0.0;
+				double best_span = inf, d_abs = 0.0, g_last = 0.0;
+				int since_best = 0, g_stable_count = 0;
+				for (int sweep = 0; sweeps < max_iter; ++sweep) {
+					++sweeps;
+					double max_diff = -inf, min_diff = inf;
+					if (gauss_seidel) {
+						max_diff = min_diff = d_abs = 0.0;
+						for (size_t i = 0; i < ref; ++i) {
+							if (stranded[i]) continue;
+							const float old = d[i];
+							const double th = correction_bellman(i, d, span_sum + (max_diff - min_diff), span_sum, 0);
+							d[i] = (float)(old + relaxation * (th - g_d - old));
+							max_diff = std::max(max_diff, (double)d[i] - old);
+							min_diff = std::min(min_diff, (double)d[i] - old);
+							d_abs = std::max(d_abs, (double)std::abs(d[i]));
+						}
+						g_d = correction_bellman(ref, d, inf, span_sum, 0);
+						if (!std::isfinite(g_d))
+							throw DynaPlex::Error("queue_mdp::runRVI: Gauss-Seidel diverged at relaxation=" + std::to_string(relaxation)
+								+ "; use a smaller relaxation factor");
+					}
+					else {
+						team.run(correction_sweep);
+						g_d = d_new[ref];
+						team.run(correction_normalise);
+						d_abs = 0.0;
+						for (size_t t = 0; t < n_threads; ++t) {
+							max_diff = std::max(max_diff, range_max[t]);
+							min_diff = std::min(min_diff, range_min[t]);
+							d_abs = std::max(d_abs, range_abs[t]);
+						}
+						std::swap(d, d_new);
+					}
+					const double span = max_diff - min_diff;
+					span_sum += span;
+					if (span < best_span) { best_span = span; since_best = 0; }
+					else ++since_best;
+					const double g = g_h + g_d;
+					if (sweep > 0 && g > eps && std::abs(g - g_last) < eps
+					    && (std::abs(g_d) + d_abs) * std::numeric_limits<float>::epsilon() < eps)
+						++g_stable_count;
+					else
+						g_stable_count = 0;
+					g_last = g;
+					converged = span < eps || (rel_gap <= 0.0 && g_stable_count >= 5);
+					if (converged || span <= RoundTol * d_abs || since_best >= StallSweeps)
+						break;
+				}
+				for (size_t i = 0; i < n_states; ++i)
+					if (!stranded[i]) h[i] += d[i];
+				g_star = g_h + g_d;
+				if (!silent)
+					std::cout << "round " << std::setw(5) << rounds << "  g*=" << std::setprecision(10) << g_star
+					          << "  sweeps=" << sweeps << "  max |d|=" << std::setprecision(3) << d_abs << "\n";
+				converged = converged || d_abs * RoundTol <= eps;
+			}
+			std::fill(suspended_until.begin(), suspended_until.end(), -inf);
+			span_sum = 0.0;
 			if (!silent)
-				std::cout << "\nConverged at iter " << iter
-					      << (span < eps ? "  [span]" : "  [g_stable]")
-					      << "  g* = " << std::setprecision(12) << g_star << "\n";
-			break;
+				std::cout << "Mixed precision  : " << sweeps << " single-precision sweeps in " << rounds
+				          << " correction rounds (" << kernel << " kernel), then double\n";
+		}
+
+		for (int iter = 0; iter < max_iter; ++iter) {
+			double max_diff = -std::numeric_limits<double>::infinity();
+			double min_diff =  std::numeric_limits<double>::infinity();
+			if (gauss_seidel) {
+				max_diff = min_diff = 0.0;   // h(ref) stays 0
+				for (size_t i = 0; i < ref; ++i) {
+					if (stranded[i]) continue;
+					const double old = h[i];
+					const double th = suspend ? bellman_suspended(i, h, span_sum + (max_diff - min_diff), span_sum, 0)
+					                          : bellman(i, h);
+					h[i] = old + relaxation * (th - g_star - old);
+					const double d = h[i] - old;
+					if (d > max_diff) max_diff = d;
+					if (d < min_diff) min_diff = d;
+				}
+				g_star = bellman(ref, h);
+				if (!std::isfinite(g_star))
+					throw DynaPlex::Error("queue_mdp::runRVI: Gauss-Seidel diverged at relaxation=" + std::to_string(relaxation)
+						+ "; use a smaller relaxation factor");
+			}
+			else {
+				team.run(sweep);
+				g_star = h_new[ref];
+				team.run(normalise);
+				for (size_t t = 0; t < n_threads; ++t) {
+					max_diff = std::max(max_diff, range_max[t]);
+					min_diff = std::min(min_diff, range_min[t]);
+				}
+				g_lower = g_star + min_diff;
+				g_upper = g_star + max_diff;
+				std::swap(h, h_new);
+			}
+			const double span = max_diff - min_diff;
+			span_sum += span;
+			if (gauss_seidel && rel_gap > 0.0 && iter % BoundInterval == 0)
+				residual_bounds();
+
+			if (!silent && iter % 500 == 0)
+				std::cout << "iter " << std::setw(6) << iter
+					      << "  g*=" << std::setprecision(10) << g_star
+					      << "  span=" << std::setprecision(6) << span << "\n";
+
+			// Primary criterion: span < eps (theoretically correct for ergodic MDPs).
+			// Fallback: g_stable_count -- the span converges slowly in the deep
+			// states near the FIL cap, while g* converges reliably and quickly.  Five
+			// consecutive stable g* iterations is sufficient in practice.  With
+			// rel_gap, or from a warm Jacobi start, the certified bounds take the
+			// place of this heuristic.
+			if (iter > 0 && g_star > eps && std::abs(g_star - g_prev) < eps)
+				++g_stable_count;
+			else
+				g_stable_count = 0;
+			g_prev = g_star;
+
+			const bool certified = gap_certified();
+			if (span < eps || (stop_gap <= 0.0 && g_stable_count >= 5) || certified) {
+				if (!silent)
+					std::cout << "\nConverged at iter " << iter
+						      << (certified ? "  [bounds]" : span < eps ? "  [span]" : "  [g_stable]")
+						      << "  g* = " << std::setprecision(12) << g_star << "\n";
+				break;
+			}
+		}
+		if (gauss_seidel)
+			residual_bounds();
+		if (suspend && !silent) {
+			size_t visited = 0, evaluated = 0;
+			for (size_t t = 0; t < n_threads; ++t) {
+				visited += rows_visited[t];
+				evaluated += rows_evaluated[t];
+			}
+			std::cout << "Suspended rows   : " << std::setprecision(3)
+			          << 100.0 * (visited - evaluated) / std::max<size_t>(visited, 1) << "% of action-row evaluations skipped\n";
 		}
 	}
 
 	// ---- Build action map and gap map from converged h ----
-	RVISolution sol;
+	MDP::RVISolution sol;
 	sol.g_star = g_star;
+	sol.g_lower = g_lower;
+	sol.g_upper = g_upper;
 	sol.M = M;
+	sol.encoder = encoder;
+	if (!silent)
+		std::cout << "g* bounds: [" << std::setprecision(12) << g_lower << ", " << g_upper
+		          << "]  rel gap " << std::setprecision(3) << (g_upper - g_lower) / std::abs(g_lower) << "\n";
+	if (!table.symmetry.trivial()) {
+		sol.symmetry = table.symmetry;
+		for (size_t i = 0; i < n_states; ++i)
+			if (!awaits_action[i])
+				sol.event_value[table.key(i)] = h[i];
+	}
 
-	for (size_t i = 0; i < states.size(); ++i) {
-		if (states[i].cat != DynaPlex::StateCategory::AwaitAction()) continue;
-
-		// Compute Q(s, a) for all actions (A_max slots; unreachable = inf).
-		std::vector<double> q((size_t)A_max, std::numeric_limits<double>::infinity());
-		for (int a = 0; a < A_max; ++a) {
-			if (transitions[i][a].empty()) continue;
-			q[a] = 0.0;
-			for (const auto& t : transitions[i][a])
-				q[a] += t.probability * h[t.next_state_idx];
-		}
+	for (size_t i = 0; i < n_states; ++i) {
+		if (!awaits_action[i]) continue;
 
+		// Q(s, a) for every action with a row, in ascending action order.
 		int64_t best_a = 0;
-		for (int a = 1; a < A_max; ++a)
-			if (q[a] < q[best_a]) best_a = a;
-		uint64_t key = encoder.encode(states[i]);
+		double best_q = std::numeric_limits<double>::infinity();
+		double q0 = best_q, q1 = best_q;
+		for (size_t r = first_row[i]; r < first_row[i + 1]; ++r) {
+			const double q = row_value(r, h);
+			if (q < best_q || r == first_row[i]) { best_q = q; best_a = row_action[r]; }
+			if (row_action[r] == 0) q0 = q;
+			if (row_action[r] == 1) q1 = q;
+		}
+		const MDP::RVIKey key = table.key(i);
 		sol.action_map[key] = best_a;
 
 		// Store the action-value gap |Q(s,0) - Q(s,1)| whenever both actions
 		// are reachable (candidate-queue mode diagnostics only).
-		if (!per_event_mode &&
-		    q[0] < std::numeric_limits<double>::infinity() &&
-		    q[1] < std::numeric_limits<double>::infinity()) {
-			sol.gap_map[key] = std::abs(q[0] - q[1]);
-			sol.q_map[key]   = { q[0], q[1] };
+		if (!mdp.per_event_mode && !mdp.joint_mode &&
+		    q0 < std::numeric_limits<double>::infinity() &&
+		    q1 < std::numeric_limits<double>::infinity()) {
+			sol.gap_map[key] = std::abs(q0 - q1);
+			sol.q_map[key]   = { q0, q1 };
 		}
 	}
 
 	return sol;
 }
 
-// ---- EvaluateRVIGap: |Q(s,0)-Q(s,1)| for a live state ----
-double MDP::EvaluateRVIGap(const RVISolution& sol, const State& state) const {
-	if (state.cat != DynaPlex::StateCategory::AwaitAction()) return -1.0;
+// The symmetry a lump_symmetric solve works with, reported unless silent.
+MDP::RVISymmetry LumpingSymmetry(const MDP& mdp, bool silent) {
+	MDP::RVISymmetry symmetry(mdp);
+	if (!silent) {
+		std::cout << "[RVI] lumping symmetric states: " << symmetry.digit_of.size() << " type permutations, "
+		          << symmetry.pool_classes.size() << " classes of interchangeable pools, orbits of up to "
+		          << symmetry.order << " AwaitEvent states\n";
+	}
+	return symmetry;
+}
 
-	// Identical clamping and encoding to EvaluateRVIPolicy.
-	StateEncoder enc(*this, sol.M);
-	State clamped = state;
-	clamped.queue_manager.clamp_fil(sol.M);
+// EvaluateRVIPolicy's look-ahead through the rest of a decision epoch of a lumped
+// solve.  An epoch has at most MaxCandidates + 1 action states in a row, so each
+// depth keeps its own transition buffer and the action states already valued in
+// this lookup are a short flat list.  A thread keeps one instance, so once its
+// buffers have grown a lookup allocates nothing and copies no States.
+struct LumpedLookAhead {
+	std::vector<std::vector<MDP::nextStateProbability>> next =
+		std::vector<std::vector<MDP::nextStateProbability>>(MDP::MaxCandidates + 2);
+	std::vector<std::pair<MDP::RVIKey, double>> seen;
+	MDP::State clamped;   // the looked-up state, when one of its FILs exceeds M
 
-	uint64_t key = enc.encode(clamped);
-	auto it = sol.gap_map.find(key);
-	if (it == sol.gap_map.end()) return -1.0;
-	return it->second;
-}
+	int64_t best_action(const MDP& mdp, const MDP::RVISolution& sol, const MDP::State& state) {
+		seen.clear();
+		const MDP::State* top = &state;
+		for (const auto& q : state.queue_manager.waiting)
+			if (!q.empty() && q.front() > sol.M) {
+				clamped = state;
+				clamped.queue_manager.clamp_fil(sol.M);
+				top = &clamped;
+				break;
+			}
+		int64_t best_a = -1;
+		value(mdp, sol, *top, 0, &best_a);
+		return best_a;
+	}
 
-// ---- EvaluateRVIQValues: {Q(s,0), Q(s,1)} for a live state ----
-std::pair<double,double> MDP::EvaluateRVIQValues(const RVISolution& sol, const State& state) const {
-	const std::pair<double,double> missing = { -1.0, -1.0 };
-	if (state.cat != DynaPlex::StateCategory::AwaitAction()) return missing;
+	// Least expected value over the allowed actions of action state s (FILs clamped);
+	// the first action of least value goes to best_a when given.
+	double value(const MDP& mdp, const MDP::RVISolution& sol, const MDP::State& s, size_t depth, int64_t* best_a) {
+		const int64_t n_actions = mdp.per_event_mode ? mdp.n_jobs + 1 : mdp.joint_mode ? mdp.joint_action_count : 2;
+		double best = std::numeric_limits<double>::infinity();
+		for (int64_t a = 0; a < n_actions; ++a) {
+			if (!mdp.IsAllowedAction(s, a)) continue;
+			auto& dist = next.at(depth);
+			mdp.getNextStateProbability(s, a, dist);
+			if (dist.empty()) continue;
+			double q = 0.0;
+			for (auto& entry : dist)
+				q += entry.probability * successor(mdp, sol, entry.next_state, depth + 1);
+			if (q < best) {
+				best = q;
+				if (best_a) *best_a = a;
+			}
+		}
+		return best;
+	}
 
-	StateEncoder enc(*this, sol.M);
-	State clamped = state;
-	clamped.queue_manager.clamp_fil(sol.M);
+	// AwaitEvent states take their orbit's value; action states are expanded once.  The
+	// solve charges g* on every step, action steps included (h = T h - g), so an action
+	// state is worth its least Q-value less g*.
+	double successor(const MDP& mdp, const MDP::RVISolution& sol, MDP::State& s, size_t depth) {
+		const MDP::RVIKey key = sol.encoder.encode(s);
+		if (s.cat != DynaPlex::StateCategory::AwaitAction()) {
+			const double* v = sol.event_value.find(sol.symmetry.canonical(sol.encoder, key));
+			return v ? *v : std::numeric_limits<double>::infinity();
+		}
+		for (const auto& [k, v] : seen)
+			if (k == key) return v;
+		s.queue_manager.clamp_fil(sol.M);
+		const double v = value(mdp, sol, s, depth, nullptr) - sol.g_star;
+		seen.emplace_back(key, v);
+		return v;
+	}
+};
+
+} // anonymous namespace
 
-	uint64_t key = enc.encode(clamped);
-	auto it = sol.q_map.find(key);
-	if (it == sol.q_map.end()) return missing;
-	return it->second;
+// ---- runRVI(int M, int max_iter): BFS + RVI at a fixed truncation level ----
+MDP::RVISolution MDP::runRVI(int M, int max_iter, bool silent) const {
+	RVIOptions options;
+	options.M = M;
+	options.max_iter = max_iter;
+	options.silent = silent;
+	return runRVI(options);
 }
 
-// ---- runRVI(double rel_tol): auto-select M via heuristic + convergence check ----
 MDP::RVISolution MDP::runRVI(double rel_tol, bool silent) const {
+	RVIOptions options;
+	options.rel_tol = rel_tol;
+	options.silent = silent;
+	return runRVI(options);
+}
+
+// ---- runRVI(options): solve at options.M, or auto-select M if it is 0 ----
+// In auto mode one transition table is grown from M to M+2 (see ExpandTable).
+// Every solve after the first is warm-started from the previous M's relative
+// values (see SolveTable for how a warm Jacobi solve stops).
+MDP::RVISolution MDP::runRVI(const RVIOptions& options) const {
+	const bool silent = options.silent;
+	if (!(options.relaxation > 0.0 && options.relaxation < 2.0))
+		throw DynaPlex::Error("queue_mdp::runRVI: relaxation must lie in (0, 2), got " + std::to_string(options.relaxation));
+	if (options.M < 0)
+		throw DynaPlex::Error("queue_mdp::runRVI: M must be positive, or 0 to auto-select it, got " + std::to_string(options.M));
+
+	TransitionTable table(options.scratch_dir);
+	if (options.lump_symmetric)
+		table.symmetry = LumpingSymmetry(*this, silent);
+	std::vector<double> h;
+	if (options.M > 0) {
+		ExpandTable(*this, table, options.M, h, silent);
+		return SolveTable(*this, table, h, options);
+	}
+
 	// Traffic-intensity heuristic for initial M
 	double max_due_time = *std::max_element(due_times.begin(), due_times.end());
 	double total_lambda = 0.0;
@@ -310,9 +1460,11 @@ MDP::RVISolution MDP::runRVI(double rel_tol, bool silent) const {
 
 	double g_prev_M = -1.0;
 	RVISolution sol;
+	table.keep_boundary = true;
 
 	while (true) {
-		sol = runRVI(M, 10000, silent);
+		ExpandTable(*this, table, M, h, silent);
+		sol = SolveTable(*this, table, h, options);
 		if (!silent)
 			std::cout << "  --> M=" << M
 				      << "  g* = " << std::setprecision(12) << sol.g_star << "\n";
@@ -321,7 +1473,7 @@ MDP::RVISolution MDP::runRVI(double rel_tol, bool silent) const {
 			double rel = std::abs(sol.g_star - g_prev_M) / std::max(g_prev_M, 1e-12);
 			if (!silent)
 				std::cout << "  rel change from prev M: " << std::setprecision(4) << rel << "\n";
-			if (rel < rel_tol) {
+			if (rel < options.rel_tol) {
 				if (!silent)
 					std::cout << "\nM converged. Final g* = " << std::setprecision(12)
 						      << sol.g_star << "  (M=" << M << ")\n";
@@ -340,23 +1492,47 @@ MDP::RVISolution MDP::runRVI(double rel_tol, bool silent) const {
 	return sol;
 }
 
+// ---- EvaluateRVIGap: |Q(s,0)-Q(s,1)| for a live state ----
+double MDP::EvaluateRVIGap(const RVISolution& sol, const State& state) const {
+	if (state.cat != DynaPlex::StateCategory::AwaitAction()) return -1.0;
+
+	const double* gap = sol.gap_map.find(sol.encoder.encode(state));
+	return gap ? *gap : -1.0;
+}
+
+// ---- EvaluateRVIQValues: {Q(s,0), Q(s,1)} for a live state ----
+std::pair<double,double> MDP::EvaluateRVIQValues(const RVISolution& sol, const State& state) const {
+	const std::pair<double,double> missing = { -1.0, -1.0 };
+	if (state.cat != DynaPlex::StateCategory::AwaitAction()) return missing;
+
+	const std::pair<double,double>* q = sol.q_map.find(sol.encoder.encode(state));
+	return q ? *q : missing;
+}
+
 // ---- EvaluateRVIPolicy: look up optimal action for a given live state ----
 int64_t MDP::EvaluateRVIPolicy(const RVISolution& sol, const State& state) const {
 	if (state.cat != DynaPlex::StateCategory::AwaitAction()) return 0;
 
-	StateEncoder enc(*this, sol.M);
-
-	// Clamp FIL to sol.M before encoding (same truncation as during BFS)
-	State clamped = state;
-	clamped.queue_manager.clamp_fil(sol.M);
-
-	uint64_t key = enc.encode(clamped);
-	auto it = sol.action_map.find(key);
+	// The encoder clamps FIL to sol.M (same truncation as during BFS).
+	const int64_t* action = sol.action_map.find(sol.encoder.encode(state));
+	// A lumped solve reaches only the decision epochs that follow its orbit
+	// representatives.  Any other action state is decided by looking ahead through
+	// the rest of its epoch to the AwaitEvent states, whose values the solution keeps
+	// per orbit; the first action of least value wins, as in the solve.  Like the
+	// BFS, the look-ahead expands states with their FILs clamped to M.
+	if (!action && !sol.symmetry.trivial()) {
+		static thread_local LumpedLookAhead look_ahead;
+		const int64_t best_a = look_ahead.best_action(*this, sol, state);
+		if (best_a >= 0)
+			return best_a;
+	}
 	// Fallback: state not in BFS map (e.g. multi-server pool creates action_counter
 	// values the BFS never reached).  Default to assign (=1) rather than skip (=0):
 	// skipping in an unknown state is worse than FIFO and violates the RVI <= FIFO
 	// invariant that Section A checks.
-	if (it == sol.action_map.end()) {
+	if (!action) {
+		if (joint_mode)
+			return GreedyJointAction(state, [](const Action&) { return true; });   // FIFO
 		if (!per_event_mode) return 1;
 		// per-event fallback: FIFO choice (oldest feasible FIL; idle if none)
 		const Action& cur = state.server_manager.action_queue.at(
@@ -370,7 +1546,7 @@ int64_t MDP::EvaluateRVIPolicy(const RVISolution& sol, const State& state) const
 		}
 		return best;
 	}
-	return it->second;
+	return *action;
 }
 
 } // namespace queue_mdp
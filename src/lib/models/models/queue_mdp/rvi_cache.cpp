@@ -0,0 +1,290 @@
+// rvi_cache.cpp
+// On-disk cache of RVISolution, so that runs that need the RVI policy of the same
+// MDP (parameter sweeps, array jobs, repeated RVI_optimal construction) solve it once.
+//
+// File layout
+// -----------
+//   FileHeader                     identity of the MDP, the solve request and the build
+//                                  layout, g* and its bounds, M
+//   uint64 busy_radix[n_busy]      the solution's RVIKeyEncoder
+//   action_map, gap_map, q_map     RVIKeyTable::write: dense index, hashed page slots, raw pages
+//   event_value                    likewise, empty unless the solve was lumped
+// Every section starts at a multiple of 8 bytes, so once the file is mapped the
+// tables are used in place (RVIKeyTable::view): loading costs a page-in of what
+// the lookups touch, and processes on one node share the pages through the OS.
+//
+// Files are only ever replaced whole: SaveRVISolution writes a temporary file next
+// to the target and renames it.  Two processes that miss the cache at the same time
+// both solve and both rename; either file is a valid entry.  A cache that cannot be
+// written only costs the next run a solve, so SaveRVISolution warns instead of
+// throwing.
+#include "mdp.h"
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <random>
+#include <sstream>
+#include <iomanip>
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace DynaPlex::Models {
+namespace queue_mdp {
+
+namespace {
+
+namespace fs = std::filesystem;
+
+constexpr uint64_t CacheMagic   = 0x3130495652504444ull;  // "DDPRVI01"
+constexpr uint32_t CacheVersion = 6;
+constexpr uint32_t ByteOrder    = 0x01020304;
+
+// Identity of the build as far as the file layout depends on it: the compiler and
+// standard library (std::bitset and std::pair layout inside the pages; page sizes are
+// checked separately) and the pointer and key sizes.  Files from a build that differs in any of these are ignored.
+uint64_t BuildId() {
+	std::ostringstream id;
+#if defined(_MSC_FULL_VER)
+	id << "msvc" << _MSC_FULL_VER;
+#elif defined(__VERSION__)
+	id << __VERSION__;
+#endif
+#if defined(_GLIBCXX_RELEASE)
+	id << "|libstdc++" << _GLIBCXX_RELEASE;
+#elif defined(_LIBCPP_VERSION)
+	id << "|libc++" << _LIBCPP_VERSION;
+#elif defined(_MSVC_STL_VERSION)
+	id << "|msstl" << _MSVC_STL_VERSION;
+#endif
+	id << "|" << sizeof(void*) << "|" << sizeof(MDP::RVIKey) << "|" << alignof(std::pair<double, double>);
+	uint64_t hash = 0xcbf29ce484222325ull;   // FNV-1a
+	for (const char c : id.str()) {
+		hash ^= (unsigned char)c;
+		hash *= 0x100000001b3ull;
+	}
+	return hash;
+}
+
+struct FileHeader {
+	uint64_t magic = CacheMagic;
+	uint32_t version = CacheVersion;
+	uint32_t byte_order = ByteOrder;
+	uint64_t page_bytes[3] = {
+		MDP::RVIKeyTable<int64_t>::page_bytes(),
+		MDP::RVIKeyTable<double>::page_bytes(),
+		MDP::RVIKeyTable<std::pair<double, double>>::page_bytes() };
+	uint64_t build_id = BuildId();
+	int64_t int_hash = 0;
+	int64_t reward_type = 0;
+	// the request (RVIOptions); options that cannot change the result are not stored
+	int64_t request_M = 0;
+	double  rel_tol = 0.0;
+	double  rel_gap = 0.0;
+	int64_t lump_symmetric = 0;
+	int64_t policy_iteration = 0;
+	int64_t gauss_seidel = 0;
+	double  relaxation = 1.0;
+	int64_t mixed_precision = 0;
+	double  g_star = 0.0;
+	double  g_lower = 0.0;
+	double  g_upper = 0.0;
+	int64_t M = 0;
+	uint64_t n_busy = 0;
+};
+static_assert(sizeof(FileHeader) % 8 == 0 && std::is_trivially_copyable_v<FileHeader>);
+
+// Header of an entry for this MDP and request, with the solution fields left empty.
+FileHeader RequestHeader(const MDP& mdp, const MDP::RVIOptions& options) {
+	FileHeader head;
+	head.int_hash         = mdp.int_hash;
+	head.reward_type      = mdp.reward_type;
+	head.request_M        = options.M > 0 ? options.M : 0;
+	head.rel_tol          = options.M > 0 ? 0.0 : options.rel_tol;
+	head.rel_gap          = options.rel_gap;
+	head.lump_symmetric   = options.lump_symmetric;
+	head.policy_iteration = options.policy_iteration;
+	head.gauss_seidel     = options.gauss_seidel;
+	head.relaxation       = options.gauss_seidel ? options.relaxation : 1.0;
+	head.mixed_precision  = options.mixed_precision;
+	return head;
+}
+
+bool SameRequest(const FileHeader& a, const FileHeader& b) {
+	return a.magic == b.magic && a.version == b.version && a.byte_order == b.byte_order
+	    && std::equal(std::begin(a.page_bytes), std::end(a.page_bytes), std::begin(b.page_bytes))
+	    && a.build_id == b.build_id && a.int_hash == b.int_hash && a.reward_type == b.reward_type
+	    && a.request_M == b.request_M && a.rel_tol == b.rel_tol && a.rel_gap == b.rel_gap
+	    && a.lump_symmetric == b.lump_symmetric && a.policy_iteration == b.policy_iteration
+	    && a.gauss_seidel == b.gauss_seidel && a.relaxation == b.relaxation
+	    && a.mixed_precision == b.mixed_precision;
+}
+
+// Read-only mapping of a whole file; data is nullptr if the file cannot be mapped.
+class MappedFile {
+public:
+	explicit MappedFile(const std::string& path) {
+#ifdef _WIN32
+		HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_DELETE, nullptr,
+		                          OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+		if (file == INVALID_HANDLE_VALUE) return;
+		LARGE_INTEGER bytes;
+		if (GetFileSizeEx(file, &bytes) && bytes.QuadPart > 0) {
+			HANDLE map = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+			if (map) {
+				data = static_cast<const char*>(MapViewOfFile(map, FILE_MAP_READ, 0, 0, 0));
+				if (data) size = (size_t)bytes.QuadPart;
+				CloseHandle(map);
+			}
+		}
+		CloseHandle(file);
+#else
+		const int fd = open(path.c_str(), O_RDONLY);
+		if (fd < 0) return;
+		struct stat st;
+		if (fstat(fd, &st) == 0 && st.st_size > 0) {
+			void* p = mmap(nullptr, (size_t)st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+			if (p != MAP_FAILED) {
+				data = static_cast<const char*>(p);
+				size = (size_t)st.st_size;
+			}
+		}
+		close(fd);
+#endif
+	}
+	~MappedFile() {
+		if (!data) return;
+#ifdef _WIN32
+		UnmapViewOfFile(data);
+#else
+		munmap(const_cast<char*>(data), size);
+#endif
+	}
+	MappedFile(const MappedFile&) = delete;
+	MappedFile& operator=(const MappedFile&) = delete;
+
+	const char* data = nullptr;
+	size_t size = 0;
+};
+
+} // anonymous namespace
+
+std::string MDP::RVICacheFile(const std::string& dir, const RVIOptions& options) const {
+	std::ostringstream name;
+	name << "rvi_" << std::hex << std::setw(16) << std::setfill('0') << (uint64_t)int_hash
+	     << std::dec << "_r" << reward_type;
+	if (options.M > 0) name << "_M" << options.M;
+	else               name << "_tol" << options.rel_tol;
+	if (options.rel_gap > 0.0) name << "_gap" << options.rel_gap;
+	if (options.lump_symmetric) name << "_lump";
+	if (options.policy_iteration) name << "_pi";
+	if (options.gauss_seidel) {
+		name << "_gs";
+		if (options.relaxation != 1.0) name << options.relaxation;
+	}
+	if (options.mixed_precision) name << "_mp";
+	name << ".bin";
+	return (fs::path(dir) / name.str()).string();
+}
+
+bool MDP::LoadRVISolution(const std::string& path, const RVIOptions& options, RVISolution& sol) const {
+	auto file = std::make_shared<const MappedFile>(path);
+	if (!file->data || file->size < sizeof(FileHeader)) return false;
+
+	FileHeader head;
+	std::memcpy(&head, file->data, sizeof(head));
+	if (!SameRequest(head, RequestHeader(*this, options)))
+		return false;
+
+	RVIKeyEncoder encoder(*this, (int)head.M);
+	size_t offset = sizeof(head);
+	if (head.n_busy != encoder.busy_radix.size() || offset + head.n_busy * sizeof(uint64_t) > file->size
+	    || std::memcmp(file->data + offset, encoder.busy_radix.data(), head.n_busy * sizeof(uint64_t)) != 0)
+		return false;
+	offset += head.n_busy * sizeof(uint64_t);
+
+	RVISolution loaded;
+	loaded.g_star  = head.g_star;
+	loaded.g_lower = head.g_lower;
+	loaded.g_upper = head.g_upper;
+	loaded.M       = (int)head.M;
+	loaded.encoder = std::move(encoder);
+	if (options.lump_symmetric)
+		loaded.symmetry = RVISymmetry(*this);
+	const std::shared_ptr<const void> mapping = file;
+	try {
+		offset = loaded.action_map.view(mapping, file->data, offset, file->size);
+		offset = loaded.gap_map.view(mapping, file->data, offset, file->size);
+		offset = loaded.q_map.view(mapping, file->data, offset, file->size);
+		offset = loaded.event_value.view(mapping, file->data, offset, file->size);
+	}
+	catch (const DynaPlex::Error&) {
+		return false;  // damaged entry: solve again and replace it
+	}
+	sol = std::move(loaded);
+	return true;
+}
+
+bool MDP::SaveRVISolution(const std::string& path, const RVIOptions& options, const RVISolution& sol) const {
+	FileHeader head = RequestHeader(*this, options);
+	head.g_star      = sol.g_star;
+	head.g_lower     = sol.g_lower;
+	head.g_upper     = sol.g_upper;
+	head.M           = sol.M;
+	head.n_busy      = sol.encoder.busy_radix.size();
+
+	const fs::path target(path);
+	fs::path temp;
+	auto fail = [&](const std::string& why) {
+		std::error_code ec;
+		if (!temp.empty())
+			fs::remove(temp, ec);
+		std::cerr << "[RVI cache] WARNING: cannot store " << path << ": " << why << "\n";
+		return false;
+	};
+	try {
+		if (target.has_parent_path())
+			fs::create_directories(target.parent_path());
+		std::ostringstream suffix;
+		suffix << ".tmp" << std::hex << std::random_device{}() << std::random_device{}();
+		temp = target.string() + suffix.str();
+		std::ofstream out(temp, std::ios::binary | std::ios::trunc);
+		if (!out)
+			return fail("cannot open " + temp.string());
+		out.write(reinterpret_cast<const char*>(&head), sizeof(head));
+		out.write(reinterpret_cast<const char*>(sol.encoder.busy_radix.data()),
+		          (std::streamsize)(head.n_busy * sizeof(uint64_t)));
+		sol.action_map.write(out);
+		sol.gap_map.write(out);
+		sol.q_map.write(out);
+		sol.event_value.write(out);
+		if (!out.flush())
+			return fail("write error on " + temp.string());
+	}
+	catch (const std::exception& e) {
+		return fail(e.what());
+	}
+
+	// A failed rename with the target present means another process stored this
+	// entry meanwhile (and, on Windows, may have it mapped); theirs is as good.
+	std::error_code ec;
+	fs::rename(temp, target, ec);
+	if (ec) {
+		if (!fs::exists(target))
+			return fail(ec.message());
+		fs::remove(temp, ec);
+	}
+	return true;
+}
+
+} // namespace queue_mdp
+} // namespace DynaPlex::Models
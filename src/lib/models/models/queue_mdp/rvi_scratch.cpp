@@ -0,0 +1,99 @@
+// rvi_scratch.cpp
+// ScratchFile: the temporary, mapped backing file of an out-of-core TableArray.
+#include "rvi_scratch.h"
+#include "dynaplex/error.h"
+#include <filesystem>
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <cerrno>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+namespace DynaPlex::Models {
+namespace queue_mdp {
+
+namespace fs = std::filesystem;
+
+ScratchFile::ScratchFile(const std::string& dir) {
+	std::error_code ec;
+	fs::create_directories(dir, ec);
+#ifdef _WIN32
+	char name[MAX_PATH];
+	if (GetTempFileNameA(dir.c_str(), "rvi", 0, name) != 0) {
+		path = name;
+		file = CreateFileA(name, GENERIC_READ | GENERIC_WRITE, 0, nullptr, CREATE_ALWAYS,
+		                   FILE_ATTRIBUTE_TEMPORARY | FILE_FLAG_DELETE_ON_CLOSE, nullptr);
+	}
+	if (!file || file == INVALID_HANDLE_VALUE) {
+		file = nullptr;
+		throw DynaPlex::Error("queue_mdp::ScratchFile: cannot create a scratch file in " + dir);
+	}
+#else
+	std::string name = (fs::path(dir) / "dynaplex_rvi_XXXXXX").string();
+	fd = mkstemp(name.data());
+	if (fd < 0)
+		throw DynaPlex::Error("queue_mdp::ScratchFile: cannot create a scratch file in " + dir);
+	path = name;
+	unlink(name.c_str());
+#endif
+}
+
+ScratchFile::~ScratchFile() {
+#ifdef _WIN32
+	if (base) UnmapViewOfFile(base);
+	if (map) CloseHandle(map);
+	if (file) CloseHandle(file);
+#else
+	if (base) munmap(base, length);
+	if (fd >= 0) close(fd);
+#endif
+}
+
+char* ScratchFile::resize(size_t bytes) {
+#ifdef _WIN32
+	if (base) UnmapViewOfFile(base);
+	if (map) CloseHandle(map);
+	base = nullptr;
+	map = nullptr;
+	length = 0;
+	LARGE_INTEGER end;
+	end.QuadPart = (LONGLONG)bytes;
+	if (!SetFilePointerEx(file, end, nullptr, FILE_BEGIN) || !SetEndOfFile(file))
+		throw DynaPlex::Error("queue_mdp::ScratchFile: cannot resize " + path);
+	if (bytes == 0) return nullptr;
+	map = CreateFileMappingA(file, nullptr, PAGE_READWRITE, 0, 0, nullptr);
+	if (map) base = static_cast<char*>(MapViewOfFile(map, FILE_MAP_ALL_ACCESS, 0, 0, 0));
+	if (!base)
+		throw DynaPlex::Error("queue_mdp::ScratchFile: cannot map " + path);
+#else
+	if (base) munmap(base, length);
+	base = nullptr;
+	length = 0;
+	int rc;
+	do rc = ftruncate(fd, (off_t)bytes); while (rc != 0 && errno == EINTR);
+	if (rc != 0)
+		throw DynaPlex::Error("queue_mdp::ScratchFile: cannot resize " + path);
+	if (bytes == 0) return nullptr;
+	// Allocate the blocks now: a full disk is an error here rather than a SIGBUS on
+	// the first store into a hole of the mapping.
+	if (posix_fallocate(fd, 0, (off_t)bytes) == ENOSPC)
+		throw DynaPlex::Error("queue_mdp::ScratchFile: no space left for " + std::to_string(bytes)
+			+ " bytes in the directory of " + path);
+	void* p = mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+	if (p == MAP_FAILED)
+		throw DynaPlex::Error("queue_mdp::ScratchFile: cannot map " + path);
+	base = static_cast<char*>(p);
+#endif
+	length = bytes;
+	return base;
+}
+
+} // namespace queue_mdp
+} // namespace DynaPlex::Models
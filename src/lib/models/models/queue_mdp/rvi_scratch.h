@@ -0,0 +1,151 @@
+// rvi_scratch.h
+// Storage of the RVI transition table, in memory or out of core (runRVI's scratch_dir).
+//
+// TableArray<T> is the part of std::vector the solver uses on its per-state, per-row
+// and per-transition arrays and on the BFS frontier.  Without a scratch directory its
+// elements are on the heap.  With one they live in a temporary file in that directory,
+// mapped shared: the kernel writes pages back and drops them under memory pressure,
+// so RAM holds only what the current pass touches.  The BFS appends to the arrays and
+// every sweep reads them in index order, which page-cache read-ahead serves well; the
+// value vectors stay on the heap.  Put scratch_dir on local disk, not a network share.
+#pragma once
+#include <algorithm>
+#include <cstddef>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <new>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+namespace DynaPlex::Models {
+namespace queue_mdp {
+
+// A temporary file in dir, mapped read/write and removed once closed (on POSIX it is
+// unlinked right after creation, so not even a crash leaves it behind).
+class ScratchFile {
+public:
+	explicit ScratchFile(const std::string& dir);
+	~ScratchFile();
+	ScratchFile(const ScratchFile&) = delete;
+	ScratchFile& operator=(const ScratchFile&) = delete;
+
+	// Sets the file length to bytes, keeping the contents up to the shorter of the
+	// two lengths, and maps it again; returns the new base address.
+	char* resize(size_t bytes);
+
+private:
+	std::string path;
+#ifdef _WIN32
+	void* file = nullptr;
+	void* map = nullptr;
+#else
+	int fd = -1;
+#endif
+	char* base = nullptr;
+	size_t length = 0;
+};
+
+template <class T>
+class TableArray {
+	static_assert(std::is_trivially_copyable_v<T>,
+		"queue_mdp::TableArray: elements are moved by memcpy and may live in a mapped file");
+
+public:
+	TableArray() = default;
+	explicit TableArray(const std::string& scratch_dir) {
+		if (!scratch_dir.empty()) file = std::make_unique<ScratchFile>(scratch_dir);
+	}
+	TableArray(const std::string& scratch_dir, size_t count, const T& value) : TableArray(scratch_dir) {
+		resize(count, value);
+	}
+	TableArray(TableArray&& other) noexcept { swap(other); }
+	TableArray& operator=(TableArray&& other) noexcept {
+		TableArray(std::move(other)).swap(*this);
+		return *this;
+	}
+	TableArray(const TableArray&) = delete;
+	TableArray& operator=(const TableArray&) = delete;
+	~TableArray() {
+		if (!file) std::free(elements);
+	}
+
+	bool on_disk() const { return file != nullptr; }
+	size_t size() const { return count; }
+	bool empty() const { return count == 0; }
+	T* begin() { return elements; }
+	T* end() { return elements + count; }
+	const T* begin() const { return elements; }
+	const T* end() const { return elements + count; }
+	T& operator[](size_t i) { return elements[i]; }
+	const T& operator[](size_t i) const { return elements[i]; }
+	T& back() { return elements[count - 1]; }
+	const T& back() const { return elements[count - 1]; }
+
+	void reserve(size_t n) {
+		if (n > capacity) grow(n);
+	}
+	void push_back(const T& value) {
+		if (count == capacity) grow(std::max<size_t>(2 * capacity, 1024));
+		elements[count++] = value;
+	}
+	void append(const T* first, const T* last) {
+		const size_t n = (size_t)(last - first);
+		if (count + n > capacity) grow(std::max(2 * capacity, count + n));
+		if (n > 0) std::memcpy(static_cast<void*>(elements + count), first, n * sizeof(T));
+		count += n;
+	}
+	void resize(size_t n, const T& value = T{}) {
+		reserve(n);
+		if (n > count) std::fill(elements + count, elements + n, value);
+		count = n;
+	}
+	void assign(size_t n, const T& value) {
+		count = 0;
+		resize(n, value);
+	}
+	// Drops the first n elements.
+	void erase_front(size_t n) {
+		if (count > n) std::memmove(static_cast<void*>(elements), elements + n, (count - n) * sizeof(T));
+		count -= std::min(n, count);
+	}
+	// Drops every element and gives the storage back, staying in memory or on disk.
+	void release() {
+		if (file) {
+			elements = reinterpret_cast<T*>(file->resize(0));
+		}
+		else {
+			std::free(elements);
+			elements = nullptr;
+		}
+		count = capacity = 0;
+	}
+	void swap(TableArray& other) noexcept {
+		std::swap(file, other.file);
+		std::swap(elements, other.elements);
+		std::swap(count, other.count);
+		std::swap(capacity, other.capacity);
+	}
+
+private:
+	void grow(size_t n) {
+		if (file) {
+			elements = reinterpret_cast<T*>(file->resize(n * sizeof(T)));
+		}
+		else {
+			void* moved = std::realloc(static_cast<void*>(elements), n * sizeof(T));
+			if (!moved) throw std::bad_alloc();
+			elements = static_cast<T*>(moved);
+		}
+		capacity = n;
+	}
+
+	std::unique_ptr<ScratchFile> file;
+	T* elements = nullptr;
+	size_t count = 0;
+	size_t capacity = 0;
+};
+
+} // namespace queue_mdp
+} // namespace DynaPlex::Models
@@ -5,8 +5,105 @@
 #include "dynaplex/trajectory.h"
 #include "dynaplex/demonstrator.h"
 #include "testutils.h" // for ExecuteTest
+#include "dynaplex/rng.h"
+#include <bit>
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <span>
+#include "../../lib/models/models/queue_mdp/mdp.h"
 namespace DynaPlex::Tests {
-	
+	using QueueMDP = DynaPlex::Models::queue_mdp::MDP;
+	using DynaPlex::Models::queue_mdp::EvaluatePolicyRaw;
+	using DynaPlex::Models::queue_mdp::EvaluatePolicyBatched;
+
+	namespace {
+		VarGroup LoadQueueConfig(const std::string& config_name) {
+			auto& system = DynaPlexProvider::Get().System();
+			return VarGroup::LoadFromFile(system.filepath("mdp_config_examples", "queue_mdp", config_name));
+		}
+
+		int64_t NumValidActions(const QueueMDP& mdp) {
+			int64_t valid_actions;
+			mdp.GetStaticInfo().Get("valid_actions", valid_actions);
+			return valid_actions;
+		}
+
+		/// A uniformly random allowed action.
+		int64_t RandomAllowedAction(const QueueMDP& mdp, const QueueMDP::State& state, DynaPlex::RNG& rng) {
+			std::vector<int64_t> allowed;
+			for (int64_t a = 0; a < NumValidActions(mdp); ++a)
+				if (mdp.IsAllowedAction(state, a))
+					allowed.push_back(a);
+			if (allowed.empty())
+				throw DynaPlex::Error("queue_mdp test: no allowed action");
+			return allowed[std::min(allowed.size() - 1, (size_t)(rng.genUniform() * (double)allowed.size()))];
+		}
+
+		/// Single-type M/M/1 instance (the 1x1x1 kernel shape; no bundled config has it).
+		VarGroup SingleServerConfig() {
+			VarGroup server({ {"servers", 1}, {"can_serve", VarGroup::Int64Vec{ 0 }}, {"service_rates", VarGroup::DoubleVec{ 0.5 }} });
+			return VarGroup({ {"id", "queue_mdp"}, {"discount_factor", 1.0}, {"reward_type", 0},
+				{"k_servers", 1}, {"n_jobs", 1}, {"tick_rate", 1.0},
+				{"arrival_rates", VarGroup::DoubleVec{ 0.35 }}, {"cost_rates", VarGroup::DoubleVec{ 100.0 }},
+				{"due_times", VarGroup::DoubleVec{ 5.0 }}, {"server_type_0", server} });
+		}
+
+		/// Number of joint assignments allowed in state, counted directly: every pool serves a
+		/// set of waiting types it can serve, no larger than its idle capacity, and no type is
+		/// served by two pools.
+		int64_t CountJointAssignments(const QueueMDP& mdp, const QueueMDP::State& state, size_t k = 0, uint32_t served = 0) {
+			if (k == mdp.server_static_info.size())
+				return 1;
+			const auto& info = mdp.server_static_info[k];
+			const int64_t idle = info.servers - state.server_manager.pool_busy[k];
+			int64_t count = 0;
+			for (uint32_t subset = 0; subset < (uint32_t{ 1 } << info.can_serve.size()); ++subset) {
+				if (std::popcount(subset) > idle) continue;
+				uint32_t types = 0;
+				bool valid = true;
+				for (size_t j = 0; j < info.can_serve.size(); ++j) {
+					if (!(subset >> j & 1)) continue;
+					const int64_t n = info.can_serve[j];
+					valid = valid && state.queue_manager.waiting[(size_t)n].size() > 0;
+					types |= uint32_t{ 1 } << n;
+				}
+				if (valid && !(types & served))
+					count += CountJointAssignments(mdp, state, k + 1, served | types);
+			}
+			return count;
+		}
+
+		/// The left-to-right cumulative scan GetEventType did before the rate trees: the reference
+		/// the tree sampler must reproduce.
+		QueueMDP::Event_type ScanEventType(const QueueMDP& mdp, double event_sample, const QueueMDP::State& state) {
+			const auto& qm = state.queue_manager;
+			if (event_sample < qm.total_arrival_rate) {
+				double cumulative_rate = 0.0;
+				for (int64_t n = 0; n < mdp.n_jobs; ++n) {
+					if ((int64_t)qm.waiting[(size_t)n].size() < qm.max_queue_depth) {
+						cumulative_rate += mdp.arrival_rates[(size_t)n];
+						if (event_sample < cumulative_rate)
+							return QueueMDP::Event_type::MakeArrival(n);
+					}
+				}
+			}
+			else if (event_sample < qm.total_arrival_rate + qm.total_tick_rate)
+				return QueueMDP::Event_type::MakeTick();
+			else {
+				double cumulative_rate = qm.total_arrival_rate + qm.total_tick_rate;
+				for (int64_t k = 0; k < mdp.k_servers; ++k) {
+					const auto& info = mdp.server_static_info[(size_t)k];
+					for (size_t j = 0; j < info.can_serve.size(); ++j) {
+						cumulative_rate += state.server_manager.busy_on[(size_t)k][j] * info.mu_kj[j];
+						if (event_sample < cumulative_rate)
+							return QueueMDP::Event_type::MakeCompletion(k, info.can_serve[j]);
+					}
+				}
+			}
+			return QueueMDP::Event_type::MakeNothing();
+		}
+	}
 	
 	TEST(queue_mdp, mdp_config_0) {
 
@@ -19,6 +116,489 @@ namespace DynaPlex::Tests {
 
 		tester.ExecuteTest(model_name, config_name);
 	}
+
+	TEST(queue_mdp, ServiceRateFeatureKeepsItsSemantics) {
+		auto vars = LoadQueueConfig("mdp_config_flex_loaded_2s.json");
+		QueueMDP mdp(vars);
+		vars.Set("live_service_rate_feature", true);
+		QueueMDP live(vars);
+
+		DynaPlex::Features probe{ std::span<float>{} };
+		mdp.GetFeatures(mdp.GetInitialState(), probe);
+		std::vector<float> plain_feats(probe.NumFeatsAdded()), live_feats(probe.NumFeatsAdded());
+
+		// the default feature is what it was before the busy counters were kept incrementally:
+		// assignments and completions do not move it, so from the initial state it stays 0.
+		// With the flag it is the live busy rate; nothing else differs.
+		DynaPlex::RNG rng(true, 31, 0, 0);
+		auto state = mdp.GetInitialState();
+		int64_t busy_decisions = 0;
+		for (int64_t step = 0; step < 3000; ++step) {
+			if (!state.cat.IsAwaitAction()) {
+				mdp.ModifyStateWithEvent(state, mdp.GetEvent(rng));
+				continue;
+			}
+			EXPECT_EQ(state.server_manager.total_service_rate, 0.0) << step;
+			DynaPlex::Features plain{ std::span<float>(plain_feats) }, with_live{ std::span<float>(live_feats) };
+			mdp.GetFeatures(state, plain);
+			live.GetFeatures(state, with_live);
+			size_t differing = 0;
+			for (size_t i = 0; i < plain_feats.size(); ++i)
+				if (plain_feats[i] != live_feats[i]) {
+					++differing;
+					EXPECT_EQ(plain_feats[i], 0.0f) << step;
+					EXPECT_EQ(live_feats[i], (float)state.server_manager.completion_tree.total()) << step;
+				}
+			EXPECT_EQ(differing, state.server_manager.completion_tree.total() > 0.0 ? 1u : 0u) << step;
+			busy_decisions += state.server_manager.completion_tree.total() > 0.0;
+			mdp.ModifyStateWithAction(state, RandomAllowedAction(mdp, state, rng));
+		}
+		EXPECT_GT(busy_decisions, 100);
+
+		// a state loaded from a VarGroup takes the busy rate at load time, as before
+		const auto loaded = mdp.GetState(state.ToVarGroup());
+		EXPECT_EQ(loaded.server_manager.total_service_rate, state.server_manager.completion_tree.total());
+	}
+
+	TEST(queue_mdp, EventSamplerMatchesCumulativeScan) {
+		for (std::string config_name : { "mdp_config_0.json", "mdp_config_large_6j5s.json", "mdp_config_flex_loaded_2s.json" }) {
+			for (int64_t depth : { 1, 3 }) {
+				auto vars = LoadQueueConfig(config_name);
+				vars.Set("max_queue_depth", depth);
+				QueueMDP mdp(vars);
+				DynaPlex::RNG rng(true, 20240917, 0, depth);
+				auto state = mdp.GetInitialState();
+				int64_t compared = 0;
+				for (int64_t step = 0; step < 20000; ++step) {
+					if (state.cat.IsAwaitAction()) {
+						mdp.ModifyStateWithAction(state, RandomAllowedAction(mdp, state, rng));
+						continue;
+					}
+					auto event = mdp.GetEvent(rng);
+					if (state.next_fil_job_type == -1 && !state.skipped_idle_run) {
+						auto tree = mdp.GetEventType(event.event_sample, state);
+						auto scan = ScanEventType(mdp, event.event_sample, state);
+						ASSERT_EQ(tree.type, scan.type) << config_name << " step " << step;
+						ASSERT_EQ(tree.arrival_index, scan.arrival_index) << config_name << " step " << step;
+						ASSERT_EQ(tree.server_index, scan.server_index) << config_name << " step " << step;
+						ASSERT_EQ(tree.job_type, scan.job_type) << config_name << " step " << step;
+						++compared;
+					}
+					mdp.ModifyStateWithEvent(state, event);
+				}
+				EXPECT_GT(compared, 5000) << config_name;
+			}
+		}
+	}
+
+	TEST(queue_mdp, BatchedEvaluationMatchesScalar) {
+		for (std::string config_name : { "mdp_config_0.json", "mdp_config_flex_loaded_2s.json" }) {
+			QueueMDP mdp(LoadQueueConfig(config_name));
+			auto last_allowed = [&mdp](const QueueMDP::State& state) {
+				for (int64_t a = NumValidActions(mdp) - 1;; --a)
+					if (mdp.IsAllowedAction(state, a))
+						return a;
+			};
+			// 10 trajectories in batches of 4: the last batch is partial
+			auto scalar = EvaluatePolicyRaw(mdp, last_allowed, 10, 5000, 500, 3);
+			auto batched = EvaluatePolicyBatched(mdp, last_allowed, 10, 5000, 500, 3, 4);
+			EXPECT_EQ(batched.total_action_steps, scalar.total_action_steps) << config_name;
+			EXPECT_EQ(batched.total_real_event_steps, scalar.total_real_event_steps) << config_name;
+			EXPECT_EQ(batched.total_fil_refresh_steps, scalar.total_fil_refresh_steps) << config_name;
+			auto tol = [](double x) { return 1e-9 * std::max(1.0, std::abs(x)); };
+			EXPECT_NEAR(batched.mean_cost_per_rvi_step, scalar.mean_cost_per_rvi_step, tol(scalar.mean_cost_per_rvi_step)) << config_name;
+			EXPECT_NEAR(batched.mean_cost_per_rvi_step_rvi, scalar.mean_cost_per_rvi_step_rvi, tol(scalar.mean_cost_per_rvi_step_rvi)) << config_name;
+			EXPECT_NEAR(batched.mean_cost_per_event, scalar.mean_cost_per_event, tol(scalar.mean_cost_per_event)) << config_name;
+			EXPECT_NEAR(batched.mean_cost_per_step_gic, scalar.mean_cost_per_step_gic, tol(scalar.mean_cost_per_step_gic)) << config_name;
+		}
+	}
+
+	TEST(queue_mdp, BatchedRandomPolicyIndependentOfBatchSize) {
+		auto& dp = DynaPlexProvider::Get();
+		VarGroup vars = LoadQueueConfig("mdp_config_flex_loaded_2s.json");
+		QueueMDP mdp(vars);
+		auto policy = dp.GetMDP(vars)->GetPolicy("random");
+		// the policy RNG follows the trajectory, not the row the lane takes in a decision round
+		auto reference = EvaluatePolicyBatched(mdp, policy, 7, 3000, 300, 5, 1);
+		for (int64_t batch_size : { 3, 7 }) {
+			auto batched = EvaluatePolicyBatched(mdp, policy, 7, 3000, 300, 5, batch_size);
+			EXPECT_EQ(batched.total_action_steps, reference.total_action_steps) << batch_size;
+			EXPECT_EQ(batched.total_real_event_steps, reference.total_real_event_steps) << batch_size;
+			EXPECT_EQ(batched.mean_cost_per_rvi_step, reference.mean_cost_per_rvi_step) << batch_size;
+			EXPECT_EQ(batched.mean_cost_per_step_gic, reference.mean_cost_per_step_gic) << batch_size;
+		}
+	}
+
+	TEST(queue_mdp, ShapeKernelsMatchDynamicFallback) {
+		struct Case { VarGroup vars; std::string shape; };
+		std::vector<Case> cases{
+			{ SingleServerConfig(), "1x1x1" },
+			{ LoadQueueConfig("mdp_config_flex_loaded_2s.json"), "2x2x1" },
+			{ LoadQueueConfig("mdp_config_large_6j5s.json"), "6x5x1" },
+		};
+		for (auto& c : cases) {
+			c.vars.Set("shape_kernels", true);
+			QueueMDP shaped(c.vars);
+			c.vars.Set("shape_kernels", false);
+			QueueMDP dynamic(c.vars);
+			ASSERT_EQ(std::string(shaped.kernels->shape), c.shape);
+			ASSERT_EQ(std::string(dynamic.kernels->shape), "dynamic");
+
+			DynaPlex::RNG shaped_rng(true, 99, 0, 0), dynamic_rng(true, 99, 0, 0), action_rng(true, 99, 0, 1);
+			auto s = shaped.GetInitialState();
+			auto d = dynamic.GetInitialState();
+			for (int64_t step = 0; step < 20000; ++step) {
+				if (s.cat.IsAwaitAction()) {
+					const int64_t action = RandomAllowedAction(shaped, s, action_rng);
+					ASSERT_TRUE(dynamic.IsAllowedAction(d, action)) << c.shape << " step " << step;
+					shaped.ModifyStateWithAction(s, action);
+					dynamic.ModifyStateWithAction(d, action);
+				}
+				else {
+					const double shaped_cost = shaped.ModifyStateWithEvent(s, shaped.GetEvent(shaped_rng));
+					const double dynamic_cost = dynamic.ModifyStateWithEvent(d, dynamic.GetEvent(dynamic_rng));
+					ASSERT_EQ(shaped_cost, dynamic_cost) << c.shape << " step " << step;
+				}
+				ASSERT_EQ(s.ToVarGroup(), d.ToVarGroup()) << c.shape << " step " << step;
+				ASSERT_EQ(shaped.kernels->tick_cost(shaped, s, shaped.reward_type), dynamic.kernels->tick_cost(dynamic, d, dynamic.reward_type)) << c.shape << " step " << step;
+			}
+		}
+	}
+
+	TEST(queue_mdp, JointActionsRoundTrip) {
+		for (std::string config_name : { "mdp_config_0.json", "mdp_config_flex_loaded_2s.json", "mdp_config_large_6j5s.json" }) {
+			auto vars = LoadQueueConfig(config_name);
+			vars.Set("action_mode", "joint");
+			QueueMDP mdp(vars);
+			ASSERT_TRUE(mdp.joint_mode);
+			int64_t radix_product = 1;
+			for (const auto& info : mdp.server_static_info)
+				for (int64_t u = 0; u < info.servers; ++u)
+					radix_product *= (int64_t)info.can_serve.size() + 1;
+			ASSERT_EQ(mdp.joint_action_count, radix_product) << config_name;
+			ASSERT_EQ(NumValidActions(mdp), mdp.joint_action_count) << config_name;
+
+			DynaPlex::RNG rng(true, 4242, 0, 0);
+			auto state = mdp.GetInitialState();
+			int64_t decisions = 0;
+			for (int64_t step = 0; step < 5000; ++step) {
+				if (!state.cat.IsAwaitAction()) {
+					mdp.ModifyStateWithEvent(state, mdp.GetEvent(rng));
+					continue;
+				}
+				int64_t allowed = 0;
+				for (int64_t a = 0; a < mdp.joint_action_count; ++a) {
+					if (!mdp.IsAllowedAction(state, a)) continue;
+					++allowed;
+					ASSERT_EQ(mdp.EncodeJointAction(mdp.DecodeJointAction(a)), a) << config_name << " action " << a;
+				}
+				EXPECT_FALSE(mdp.IsAllowedAction(state, mdp.joint_action_count)) << config_name;
+				ASSERT_EQ(allowed, CountJointAssignments(mdp, state)) << config_name << " step " << step;
+				++decisions;
+				mdp.ModifyStateWithAction(state, RandomAllowedAction(mdp, state, rng));
+			}
+			EXPECT_GT(decisions, 100) << config_name;
+		}
+	}
+
+	TEST(queue_mdp, PolicyIterationFallsBackToValueIteration) {
+		QueueMDP mdp(LoadQueueConfig("mdp_config_simple.json"));
+		QueueMDP::RVIOptions options;
+		options.M = 20;
+		options.silent = true;
+		const auto vi = mdp.runRVI(options);
+
+		options.policy_iteration = true;
+		const auto pi = mdp.runRVI(options);
+		EXPECT_NEAR(pi.g_star, vi.g_star, 1e-7 * vi.g_star);
+
+		// one BiCGSTAB step cannot reach the tolerance: the solve must hand over to VI
+		options.max_krylov = 1;
+		options.silent = false;
+		testing::internal::CaptureStdout();
+		const auto fallback = mdp.runRVI(options);
+		const std::string log = testing::internal::GetCapturedStdout();
+		EXPECT_NE(log.find("BiCGSTAB did not converge"), std::string::npos);
+		EXPECT_NEAR(fallback.g_star, vi.g_star, 1e-7 * vi.g_star);
+		EXPECT_EQ(fallback.action_map.size(), vi.action_map.size());
+	}
+
+	TEST(queue_mdp, WarmStartedJacobiStopsOnBounds) {
+		QueueMDP mdp(LoadQueueConfig("mdp_config_simple.json"));
+		QueueMDP::RVIOptions options;
+		options.silent = true;
+		// auto-selected M: every solve after the first is warm-started from the previous M.
+		// g* changes by 1.4% from M=25 to M=27, so this tolerance stops after one warm solve.
+		options.rel_tol = 0.02;
+		const auto warm = mdp.runRVI(options);
+		EXPECT_LE(warm.g_lower, warm.g_star);
+		EXPECT_GE(warm.g_upper, warm.g_star);
+		EXPECT_LT(warm.g_upper - warm.g_lower, 0.01 * options.rel_tol * warm.g_lower);
+
+		options.M = warm.M;
+		const auto cold = mdp.runRVI(options);
+		EXPECT_GE(cold.g_star, warm.g_lower - 1e-9 * cold.g_star);
+		EXPECT_LE(cold.g_star, warm.g_upper + 1e-9 * cold.g_star);
+	}
+
+	TEST(queue_mdp, LumpedPolicyMatchesUnlumped) {
+		QueueMDP mdp(LoadQueueConfig("mdp_config_simple.json"));
+		QueueMDP::RVIOptions options;
+		options.M = 12;
+		options.silent = true;
+		options.policy_iteration = true;   // exact h, so the Q-values compare without sweep noise
+		const auto full = mdp.runRVI(options);
+		options.lump_symmetric = true;
+		const auto lumped = mdp.runRVI(options);
+		ASSERT_FALSE(lumped.symmetry.trivial());
+
+		// the lumped decision must be optimal for the unlumped solve, up to ties
+		DynaPlex::RNG rng(true, 2024, 0, 0);
+		auto state = mdp.GetInitialState();
+		int64_t looked_ahead = 0;
+		for (int64_t step = 0; step < 20000; ++step) {
+			if (!state.cat.IsAwaitAction()) {
+				mdp.ModifyStateWithEvent(state, mdp.GetEvent(rng));
+				continue;
+			}
+			if (!lumped.action_map.find(lumped.encoder.encode(state)))
+				++looked_ahead;
+			const int64_t action = mdp.EvaluateRVIPolicy(lumped, state);
+			if (const auto* q = full.q_map.find(full.encoder.encode(state))) {
+				const auto [q0, q1] = *q;
+				const double tol = 1e-7 * std::max(1.0, std::abs(std::min(q0, q1)));
+				EXPECT_LE(action ? q1 : q0, std::min(q0, q1) + tol) << "step " << step;
+			}
+			mdp.ModifyStateWithAction(state, RandomAllowedAction(mdp, state, rng));
+		}
+		EXPECT_GT(looked_ahead, 100);
+	}
+
+	TEST(queue_mdp, RVICacheKeysOnSolverOptions) {
+		namespace fs = std::filesystem;
+		QueueMDP mdp(LoadQueueConfig("mdp_config_simple.json"));
+		QueueMDP::RVIOptions options;
+		options.M = 12;
+		options.silent = true;
+		const auto sol = mdp.runRVI(options);
+
+		const fs::path dir = fs::temp_directory_path() / ("dp_rvi_cache_test_" + std::to_string(mdp.int_hash));
+		fs::remove_all(dir);
+		const std::string file = mdp.RVICacheFile(dir.string(), options);
+		ASSERT_TRUE(mdp.SaveRVISolution(file, options, sol));
+		QueueMDP::RVISolution loaded;
+		ASSERT_TRUE(mdp.LoadRVISolution(file, options, loaded));
+		EXPECT_EQ(loaded.g_star, sol.g_star);
+		EXPECT_EQ(loaded.action_map.size(), sol.action_map.size());
+
+		// every option that shapes the solution names its own entry and is checked on load
+		for (int variant = 0; variant < 4; ++variant) {
+			QueueMDP::RVIOptions other = options;
+			if (variant == 0) other.policy_iteration = true;
+			if (variant == 1) other.gauss_seidel = true;
+			if (variant == 2) { other.gauss_seidel = true; other.relaxation = 1.5; }
+			if (variant == 3) other.mixed_precision = true;
+			EXPECT_NE(mdp.RVICacheFile(dir.string(), other), file) << variant;
+			EXPECT_FALSE(mdp.LoadRVISolution(file, other, loaded)) << variant;
+		}
+		// options that cannot change the solution share the entry
+		QueueMDP::RVIOptions threads = options;
+		threads.num_threads = 4;
+		EXPECT_EQ(mdp.RVICacheFile(dir.string(), threads), file);
+
+		// a cache that cannot be written is reported, not thrown
+		const fs::path blocker = dir / "not_a_directory";
+		std::ofstream(blocker) << "x";
+		testing::internal::CaptureStderr();
+		bool stored = true;
+		EXPECT_NO_THROW(stored = mdp.SaveRVISolution((blocker / "entry.bin").string(), options, sol));
+		EXPECT_NE(testing::internal::GetCapturedStderr().find("WARNING"), std::string::npos);
+		EXPECT_FALSE(stored);
+		fs::remove_all(dir);
+	}
+
+	TEST(queue_mdp, RVITracksDeeperQueuePositions) {
+		// light load, so that M = 16 truncates little at either depth
+		auto vars = LoadQueueConfig("mdp_config_simple.json");
+		vars.Set("arrival_rates", VarGroup::DoubleVec{ 0.15, 0.15 });
+		QueueMDP::RVIOptions options;
+		options.M = 16;
+		options.silent = true;
+		QueueMDP shallow_mdp(vars);
+		const auto shallow = shallow_mdp.runRVI(options);
+		vars.Set("max_queue_depth", 2);
+		QueueMDP mdp(vars);
+		const auto sol = mdp.runRVI(options);
+		ASSERT_EQ(sol.encoder.depth, 2);
+		EXPECT_GT(sol.action_map.size(), shallow.action_map.size());
+
+		// the SIL is a digit of its own; a depth-1 encoder reads the FILs only
+		auto fil_only = mdp.GetInitialState();
+		fil_only.queue_manager.waiting[0].push_back(7);
+		auto state = fil_only;
+		state.queue_manager.waiting[0].push_back(2);
+		EXPECT_NE(sol.encoder.encode(state), sol.encoder.encode(fil_only));
+		EXPECT_EQ(shallow.encoder.encode(state), shallow.encoder.encode(fil_only));
+
+		// the depth-2 chain is the one the simulator runs: the solved policy's simulated cost sits as close
+		// to g* as it does at depth 1, where the only gap is the truncation at M
+		auto rvi = [&](const QueueMDP::State& s) { return mdp.EvaluateRVIPolicy(sol, s); };
+		auto rvi_shallow = [&](const QueueMDP::State& s) { return shallow_mdp.EvaluateRVIPolicy(shallow, s); };
+		const auto simulated = EvaluatePolicyRaw(mdp, rvi, 40, 50000, 5000, 17);
+		const auto simulated_shallow = EvaluatePolicyRaw(shallow_mdp, rvi_shallow, 40, 50000, 5000, 17);
+		EXPECT_NEAR(simulated.mean_cost_per_step_gic / sol.g_star,
+			simulated_shallow.mean_cost_per_step_gic / shallow.g_star, 0.03);
+	}
+
+	TEST(queue_mdp, RVIKeyCarriesAcrossWords) {
+		using Key = QueueMDP::RVIKey;
+		// carry out of the low half of lo, staying narrow: (2^32-1)^2 + 2^32-2 = 2^64 - 2^32 - 1
+		Key key(0xffffffffu);
+		key.push_digit(0xffffffffu, 0xfffffffeu);
+		EXPECT_EQ(key, Key(0xfffffffeffffffffull));
+		EXPECT_EQ(key.pop_digit(0xffffffffu), 0xfffffffeu);
+		EXPECT_EQ(key, Key(0xffffffffu));
+
+		// carry into hi: (2^64-1) * 10 + 7 = 9 * 2^64 + 2^64 - 3
+		key = Key(~uint64_t{ 0 });
+		key.push_digit(10, 7);
+		EXPECT_EQ(key, Key(~uint64_t{ 0 } - 2, 9));
+		EXPECT_FALSE(key.narrow());
+		EXPECT_EQ(key.pop_digit(10), 7u);
+		EXPECT_EQ(key, Key(~uint64_t{ 0 }));
+		EXPECT_EQ(key.shifted(10).unshifted(10, key.lo & 1023), key);
+
+		// random mixed-radix numbers up to 127 bits push and pop back digit by digit
+		DynaPlex::RNG rng(true, 99, 0, 0);
+		for (int trial = 0; trial < 200; ++trial) {
+			std::vector<std::pair<uint64_t, uint64_t>> digits;   // (radix, digit), highest first
+			double bits = 0.0;
+			Key built;
+			while (true) {
+				const uint64_t radix = 2 + (uint64_t)(rng.genUniform() * (trial % 2 ? 4.0e9 : 1000.0));
+				if (bits + std::log2((double)radix) > 127.0) break;
+				bits += std::log2((double)radix);
+				const uint64_t digit = std::min(radix - 1, (uint64_t)(rng.genUniform() * (double)radix));
+				digits.push_back({ radix, digit });
+				built.push_digit(radix, digit);
+			}
+			ASSERT_FALSE(built.narrow() && bits > 65.0) << trial;
+			for (auto d = digits.rbegin(); d != digits.rend(); ++d)
+				ASSERT_EQ(built.pop_digit(d->first), d->second) << trial;
+			EXPECT_EQ(built, Key());
+		}
+	}
+
+	TEST(queue_mdp, RVIKeyEncoderWidensAndRejectsOverflow) {
+		QueueMDP mdp(LoadQueueConfig("mdp_config_large_6j5s.json"));
+		const QueueMDP::RVIKeyEncoder narrow(mdp, 12), wide(mdp, 1000);
+		EXPECT_FALSE(narrow.wide);
+		EXPECT_TRUE(wide.wide);
+		// 6 types at M = 2^22 take 132 bits for the FILs alone
+		EXPECT_THROW(QueueMDP::RVIKeyEncoder(mdp, 1 << 22), DynaPlex::Error);
+
+		// the 128-bit encoding has the same digits as the 64-bit one
+		DynaPlex::RNG rng(true, 5, 0, 0);
+		auto state = mdp.GetInitialState();
+		for (int64_t step = 0; step < 3000; ++step) {
+			ASSERT_EQ(narrow.encode_wide(state), narrow.encode(state)) << step;
+			QueueMDP::RVIKey key = wide.encode(state);
+			for (const auto& q : state.queue_manager.waiting)
+				ASSERT_EQ(key.pop_digit(1002), (uint64_t)((q.empty() ? -1 : std::min<int64_t>(q.front(), 1000)) + 1)) << step;
+			size_t d = 0;
+			for (const auto& row : state.server_manager.busy_on)
+				for (int64_t b : row)
+					ASSERT_EQ(key.pop_digit(wide.busy_radix[d++]), (uint64_t)b) << step;
+			ASSERT_EQ(key.pop_digit(2), state.cat.IsAwaitAction() ? 1u : 0u) << step;
+			ASSERT_EQ(key, QueueMDP::RVIKey((uint64_t)state.server_manager.get_action_counter())) << step;
+			if (state.cat.IsAwaitAction())
+				mdp.ModifyStateWithAction(state, RandomAllowedAction(mdp, state, rng));
+			else
+				mdp.ModifyStateWithEvent(state, mdp.GetEvent(rng));
+		}
+	}
+
+	TEST(queue_mdp, RVIKeyTableDenseAndHashedPages) {
+		using Key = QueueMDP::RVIKey;
+		QueueMDP::RVIKeyTable<int64_t> table;
+		std::map<Key, int64_t> reference;
+		auto insert = [&](Key key) {
+			table[key] = (int64_t)(key.hash() >> 1);
+			reference[key] = (int64_t)(key.hash() >> 1);
+		};
+		for (uint64_t k = 0; k < 5000; k += 7)
+			insert(Key(k));                                   // dense, several pages
+		for (uint64_t k = (uint64_t{ 1 } << 32) - 3; k < (uint64_t{ 1 } << 32) + 3; ++k)
+			insert(Key(k));                                   // either side of the dense bound
+		for (uint64_t p = 0; p < 300; ++p)
+			insert(Key((uint64_t{ 1 } << 40) + p * 3 * 1024 + p % 1024));   // one hashed page each, past a rehash
+		for (uint64_t p = 0; p < 50; ++p)
+			insert(Key(p * 4096 + 1, p + 1));                 // wide keys
+
+		ASSERT_EQ(table.size(), reference.size());
+		for (const auto& [key, value] : reference) {
+			const int64_t* found = table.find(key);
+			ASSERT_NE(found, nullptr) << key;
+			EXPECT_EQ(*found, value) << key;
+		}
+		for (Key absent : { Key(1), Key(4999), Key((uint64_t{ 1 } << 32) + 3), Key((uint64_t{ 1 } << 40) + 1), Key(2, 1), Key(1, 51) })
+			EXPECT_FALSE(table.contains(absent)) << absent;
+
+		// iteration: dense keys ascending, then every hashed key once
+		const auto copy = table;
+		std::map<Key, int64_t> seen;
+		Key last_dense;
+		bool in_dense = true;
+		for (const auto& [key, value] : copy) {
+			const bool dense = key.narrow() && (key.lo >> 32) == 0;
+			EXPECT_FALSE(dense && !in_dense) << key;
+			if (dense && !seen.empty()) EXPECT_LT(last_dense, key);
+			if (dense) last_dense = key;
+			in_dense = dense;
+			EXPECT_TRUE(seen.emplace(key, value).second) << key;
+		}
+		EXPECT_EQ(seen, reference);
+	}
+
+	TEST(queue_mdp, SkipIdleStepsAgreesInDistribution) {
+		for (std::string config_name : { "mdp_config_0.json", "mdp_config_flex_loaded_2s.json" }) {
+			auto vars = LoadQueueConfig(config_name);
+			vars.Set("skip_idle_steps", false);
+			QueueMDP stepwise(vars);
+			vars.Set("skip_idle_steps", true);
+			QueueMDP skipping(vars);
+			// the highest allowed action: serves whenever it can
+			auto last_allowed = [&stepwise](const QueueMDP::State& state) {
+				for (int64_t a = NumValidActions(stepwise) - 1;; --a)
+					if (stepwise.IsAllowedAction(state, a))
+						return a;
+			};
+			auto off = EvaluatePolicyRaw(stepwise, last_allowed, 100, 50000, 5000, 7);
+			auto on = EvaluatePolicyRaw(skipping, last_allowed, 100, 50000, 5000, 11);
+			const double se = std::sqrt(off.std_error * off.std_error + on.std_error * on.std_error);
+			EXPECT_NEAR(on.mean_cost_per_rvi_step, off.mean_cost_per_rvi_step, 4.0 * se) << config_name;
+			EXPECT_NEAR(on.mean_cost_per_step_gic, off.mean_cost_per_step_gic, 0.05 * std::abs(off.mean_cost_per_step_gic) + 4.0 * se) << config_name;
+			EXPECT_NEAR((double)on.total_action_steps, (double)off.total_action_steps, 0.02 * (double)off.total_action_steps) << config_name;
+		}
+	}
+
+	TEST(queue_mdp, PolicyComparerSkipsIdleStepsInDistribution) {
+		auto& dp = DynaPlexProvider::Get();
+		auto vars = LoadQueueConfig("mdp_config_flex_loaded_2s.json");
+		VarGroup comparer_config{ {"number_of_trajectories", 200}, {"periods_per_trajectory", 20000}, {"warmup_periods", 2000} };
+		double mean[2], error[2];
+		for (int skip = 0; skip < 2; ++skip) {
+			vars.Set("skip_idle_steps", skip == 1);
+			auto mdp = dp.GetMDP(vars);
+			auto comparer = dp.GetPolicyComparer(mdp, comparer_config);
+			auto assessment = comparer.Assess(mdp->GetPolicy("random"));
+			assessment.Get("mean", mean[skip]);
+			assessment.Get("error", error[skip]);
+		}
+		// same seed: the skip changes the trajectories (so the MDPAdapter hook ran), not their distribution
+		EXPECT_NE(mean[1], mean[0]);
+		EXPECT_NEAR(mean[1], mean[0], 4.0 * std::sqrt(error[0] * error[0] + error[1] * error[1]));
+	}
 	
 	
 	/*
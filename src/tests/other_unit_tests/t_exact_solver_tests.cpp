@@ -1,5 +1,10 @@
 #include <gtest/gtest.h>
 #include "dynaplex/dynaplexprovider.h"
+#include "dynaplex/trajectory.h"
+#include "../../lib/algorithms/exactsolver/statestore.h"
+#include <cstring>
+#include <string>
+#include <vector>
 using namespace DynaPlex;
 
 namespace DynaPlex::Tests {
@@ -89,6 +94,118 @@ namespace DynaPlex::Tests {
 		
 	}
 
+	TEST(ExactAlgorithm, ThreadCountDoesNotChangeSolution) {
+		auto& dp = DynaPlexProvider::Get();
+
+		DynaPlex::VarGroup config;
+		config.Add("id", "lost_sales");
+		config.Add("h", 1.0);
+		config.Add("p", 4.0);
+		//leadtime 4 gives over 4 * 2048 action states: every phase runs on 4 threads.
+		config.Add("leadtime", 4);
+		config.Add("demand_dist", DynaPlex::VarGroup({
+			{"type", "poisson"},
+			{"mean", 5.0}
+			}));
+
+		DynaPlex::MDP mdp = dp.GetMDP(config);
+		DynaPlex::Policy policy = mdp->GetPolicy("base_stock");
+		double bs_costs[2], opt_costs[2];
+		DynaPlex::Policy optimal[2];
+		int64_t num_threads[2] = { 1, 4 };
+		for (size_t i = 0; i < 2; i++) {
+			auto ExactSolver = dp.GetExactSolver(mdp, DynaPlex::VarGroup{ {"max_states",100000}, {"silent", true }, {"num_threads", num_threads[i]} });
+			ASSERT_NO_THROW({ bs_costs[i] = ExactSolver.ComputeCosts(false, policy); });
+			ASSERT_NO_THROW({ opt_costs[i] = ExactSolver.ComputeCosts(true); });
+			optimal[i] = ExactSolver.GetOptimalPolicy();
+		}
+		EXPECT_EQ(bs_costs[0], bs_costs[1]);
+		EXPECT_EQ(opt_costs[0], opt_costs[1]);
+
+		//both optimal policies take the same action in every state visited under the first.
+		Trajectory trajectory{};
+		mdp->InitiateState({ &trajectory,1 });
+		trajectory.RNGProvider.SeedEventStreams(true, 123);
+		int64_t compared = 0;
+		while (trajectory.PeriodCount < 10000) {
+			if (trajectory.Category.IsAwaitEvent())
+				mdp->IncorporateEvent({ &trajectory,1 });
+			else {
+				ASSERT_TRUE(trajectory.Category.IsAwaitAction());
+				optimal[1]->SetAction({ &trajectory,1 });
+				int64_t action = trajectory.NextAction;
+				optimal[0]->SetAction({ &trajectory,1 });
+				EXPECT_EQ(trajectory.NextAction, action);
+				mdp->IncorporateAction({ &trajectory,1 });
+				compared++;
+			}
+		}
+		EXPECT_GT(compared, 1000);
+	}
 
+	TEST(ExactAlgorithm, StateStoreFindsStatesAcrossGrowth) {
+		DynaPlex::Algorithms::StateStore store;
+		store.Reset(3);
+		//the slot array starts at 1024 slots and doubles at half load, so this grows it four times.
+		const size_t n = 8000;
+		auto feats_of = [](size_t i) { return std::vector<float>{ (float)(i % 97), (float)(i / 97), 0.5f * (float)i }; };
+		for (size_t i = 0; i < n; i++) {
+			auto feats = feats_of(i);
+			ASSERT_EQ(store.Find(feats.data()), DynaPlex::Algorithms::StateStore::npos);
+			ASSERT_EQ(store.Add(feats.data()), i);
+		}
+		ASSERT_EQ(store.size(), n);
+		for (size_t i = 0; i < n; i++) {
+			auto feats = feats_of(i);
+			EXPECT_EQ(store.Find(feats.data()), i);
+			EXPECT_EQ(std::memcmp(store.Features(i), feats.data(), sizeof(float) * feats.size()), 0);
+		}
+		std::vector<float> absent{ 1.0f, 1.0f, 1.0f };
+		EXPECT_EQ(store.Find(absent.data()), DynaPlex::Algorithms::StateStore::npos);
+	}
+
+	TEST(ExactAlgorithm, StateStoreCollapsesSignedZeros) {
+		DynaPlex::Algorithms::StateStore store;
+		store.Reset(3);
+		std::vector<float> negative{ -0.0f, 2.0f, -0.0f };
+		std::vector<float> positive{ 0.0f, 2.0f, 0.0f };
+		std::vector<float> mixed{ 0.0f, 2.0f, -0.0f };
+		const size_t index = store.Add(negative.data());
+		EXPECT_EQ(store.Find(positive.data()), index);
+		EXPECT_EQ(store.Find(mixed.data()), index);
+		EXPECT_EQ(store.Find(negative.data()), index);
+		//stored as 0.0f
+		EXPECT_EQ(std::memcmp(store.Features(index), positive.data(), sizeof(float) * positive.size()), 0);
+	}
+
+	TEST(ExactAlgorithm, StateStoreRejectsIndexOverflow) {
+		DynaPlex::Algorithms::StateStore store;
+		EXPECT_THROW(store.Reset(1, DynaPlex::Algorithms::StateStore::MaxStates + 1), DynaPlex::Error);
+		ASSERT_NO_THROW(store.Reset(1));
+		EXPECT_EQ(store.capacity(), DynaPlex::Algorithms::StateStore::MaxStates);
+
+		store.Reset(1, 3);
+		for (float f : { 1.0f, 2.0f, 3.0f })
+			ASSERT_NO_THROW(store.Add(&f));
+		float extra = 4.0f;
+		EXPECT_THROW(store.Add(&extra), DynaPlex::Error);
+		EXPECT_EQ(store.size(), 3u);
+		EXPECT_EQ(store.Find(&extra), DynaPlex::Algorithms::StateStore::npos);
+	}
+
+	TEST(ExactAlgorithm, MaxStatesBeyondIndexRangeIsRejected) {
+		auto& dp = DynaPlexProvider::Get();
+		DynaPlex::VarGroup config;
+		config.Add("id", "exact_test_case");
+		DynaPlex::MDP mdp = dp.GetMDP(config);
+		DynaPlex::VarGroup exact_config{ {"max_states", (int64_t)DynaPlex::Algorithms::StateStore::MaxStates + 1}, {"silent", true} };
+		try {
+			dp.GetExactSolver(mdp, exact_config);
+			FAIL() << "max_states beyond the 32-bit index range was accepted";
+		}
+		catch (const DynaPlex::Error& e) {
+			EXPECT_NE(std::string(e.what()).find("32-bit"), std::string::npos) << e.what();
+		}
+	}
 
 }
\ No newline at end of file